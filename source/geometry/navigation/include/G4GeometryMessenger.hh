@@ -73,10 +73,11 @@ class G4GeometryMessenger : public G4UImessenger
     void SetVerbosity(G4String newValue);
     void SetCheckMode(G4String newValue);
     void SetPushFlag(G4String newValue);
+    void SetParallelSafety(G4String newValue);
     void RecursiveOverlapTest();
 
     G4UIdirectory             *geodir, *navdir, *testdir;
-    G4UIcmdWithABool          *chkCmd, *pchkCmd, *verCmd;
+    G4UIcmdWithABool          *chkCmd, *pchkCmd, *psfCmd, *verCmd;
     G4UIcmdWithoutParameter   *recCmd, *resCmd;
     G4UIcmdWithADoubleAndUnit *tolCmd;
     G4UIcmdWithAnInteger      *verbCmd, *rslCmd, *rcsCmd, *rcdCmd, *errCmd;
@@ -36,6 +36,7 @@
 
 // History:
 // - Created. John Apostolakis, November 2006
+// - October 2026: skip parallel navigators whose safety exceeds the step
 // *********************************************************************
 
 #ifndef G4MULTINAVIGATOR_HH
@@ -136,6 +137,12 @@ class G4MultiNavigator : public G4Navigator
     // Restriction:
     //   Normals are not available for replica volumes (returns obtained= false)
 
+ inline void SetUseSafetyForOptimization( G4bool value )
+  { fUseSafetyForOptimization= value; }
+    // Whether to use the safety of each parallel geometry to avoid calling
+    // its navigator in ComputeStep() when the step cannot reach a boundary.
+    // The mass navigator is always called.
+
  public:  // without description
 
   G4Navigator* GetNavigator(G4int n) const
@@ -193,6 +200,8 @@ class G4MultiNavigator : public G4Navigator
    G4ThreeVector fPreStepLocation;      //  point where last ComputeStep called
    G4double      fMinSafety_PreStepPt;  //   /\ corresponding value of safety
 
+   G4bool        fUseSafetyForOptimization; // Skip parallel navigators in safety
+
    G4TransportationManager* pTransportManager; // Cache for frequent use
 };
 
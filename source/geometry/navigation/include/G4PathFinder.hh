@@ -40,6 +40,7 @@
 // -------
 //  7.10.05 John Apostolakis,  Draft design 
 // 26.04.06 John Apostolakis,  Revised design and first implementation 
+// 19.10.26 Skip parallel navigators whose safety exceeds the proposed step
 // ---------------------------------------------------------------------------
 #ifndef G4PATHFINDER_HH 
 #define G4PATHFINDER_HH  1
@@ -144,6 +145,13 @@ class G4PathFinder
 
    inline G4int  SetVerboseLevel(G4int lev=-1);
 
+   inline G4bool UseSafetyForOptimization( G4bool );
+     //
+     // Whether to use the safety of each parallel geometry to avoid calls
+     // to its navigator when the step cannot reach a boundary of that
+     // geometry. The mass navigator is always called. Default is true.
+     // Returns the previous value.
+
  public:  // with description
 
    inline G4int   GetMaxLoopCount() const;
@@ -189,10 +197,6 @@ class G4PathFinder
   //
   // Clear all the State of this class and its current associates
 
-  inline G4bool UseSafetyForOptimization( G4bool );
-  //
-  // Whether use safety to discard unneccesary calls to navigator
-
   void ReportMove( const G4ThreeVector& OldV, const G4ThreeVector& NewV, const G4String& Quantity ) const; 
   // Helper method to report movement (likely of initial point)
 
@@ -274,6 +278,8 @@ class G4PathFinder
 
    G4double kCarTolerance;
 
+   G4bool   fUseSafetyForOptimization; // Skip parallel navigators in safety
+
    static G4ThreadLocal G4PathFinder* fpPathFinder;
 };
 
@@ -293,6 +299,14 @@ inline G4int  G4PathFinder::SetVerboseLevel(G4int newLevel)
   G4int old= fVerboseLevel;  fVerboseLevel= newLevel; return old;
 }
 
+inline G4bool G4PathFinder::UseSafetyForOptimization( G4bool value )
+{
+  G4bool old= fUseSafetyForOptimization;
+  fUseSafetyForOptimization= value;
+  fpMultiNavigator->SetUseSafetyForOptimization( value );
+  return old;
+}
+
 inline G4double G4PathFinder::GetMinimumStep() const
 { 
   return fMinStep; 
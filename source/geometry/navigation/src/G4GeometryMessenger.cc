@@ -43,6 +43,7 @@
 #include "G4GeometryManager.hh"
 #include "G4VPhysicalVolume.hh"
 #include "G4Navigator.hh"
+#include "G4PathFinder.hh"
 
 #include "G4UIdirectory.hh"
 #include "G4UIcommand.hh"
@@ -111,6 +112,16 @@ G4GeometryMessenger::G4GeometryMessenger(G4TransportationManager* tman)
   pchkCmd->SetDefaultValue(true);
   pchkCmd->AvailableForStates(G4State_Idle);
 
+  psfCmd = new G4UIcmdWithABool( "/geometry/navigator/parallel_safety", this );
+  psfCmd->SetGuidance( "Use the safety of each parallel geometry to skip" );
+  psfCmd->SetGuidance( "its navigator when the step cannot reach one of its" );
+  psfCmd->SetGuidance( "boundaries. The mass navigator is always called." );
+  psfCmd->SetGuidance( "Active by default; switching it off allows to" );
+  psfCmd->SetGuidance( "measure the cost of parallel worlds without it." );
+  psfCmd->SetParameterName("safetyFlag",true);
+  psfCmd->SetDefaultValue(true);
+  psfCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
   //
   // Geometry verification test commands
   //
@@ -181,7 +192,7 @@ G4GeometryMessenger::~G4GeometryMessenger()
   delete verCmd; delete recCmd; delete rslCmd;
   delete resCmd; delete rcsCmd; delete rcdCmd; delete errCmd;
   delete tolCmd;
-  delete verbCmd; delete pchkCmd; delete chkCmd;
+  delete verbCmd; delete pchkCmd; delete psfCmd; delete chkCmd;
   delete geodir; delete navdir; delete testdir;
   delete tvolume;
 }
@@ -222,6 +233,9 @@ G4GeometryMessenger::SetNewValue( G4UIcommand* command, G4String newValues )
   else if (command == chkCmd) {
     SetCheckMode( newValues );
   }
+  else if (command == psfCmd) {
+    SetParallelSafety( newValues );
+  }
   else if (command == tolCmd) {
     Init();
     tol = tolCmd->GetNewDoubleValue( newValues )
@@ -332,6 +346,16 @@ G4GeometryMessenger::SetPushFlag(G4String input)
   navigator->SetPushVerbosity(mode);
 }
 
+//
+// Set use of the safety of parallel navigators
+//
+void
+G4GeometryMessenger::SetParallelSafety(G4String input)
+{
+  G4bool mode = psfCmd->GetNewBoolValue(input);
+  G4PathFinder::GetInstance()->UseSafetyForOptimization(mode);
+}
+
 //
 // Recursive Overlap Test
 //
@@ -48,7 +48,7 @@ class G4FieldManager;
 // ********************************************************************
 //
 G4MultiNavigator::G4MultiNavigator() 
-  : G4Navigator(), fLastMassWorld(0)
+  : G4Navigator(), fLastMassWorld(0), fUseSafetyForOptimization(true)
 {
   fNoActiveNavigators= 0; 
   G4ThreeVector Big3Vector( kInfinity, kInfinity, kInfinity ); 
@@ -119,14 +119,33 @@ G4double G4MultiNavigator::ComputeStep(const G4ThreeVector &pGlobalPoint,
   G4ThreeVector initialPosition = pGlobalPoint;
   G4ThreeVector initialDirection= pDirection;
 
+  // Move from the point of the last ComputeStep, for which the safety of
+  // each geometry is known. It is used to skip parallel geometries which
+  // cannot limit this step (eg. for each chord of a curved track)
+  //
+  G4double moveLen= kInfinity;
+  if( fUseSafetyForOptimization && (fNoActiveNavigators > 1) )
+  {
+     moveLen= (initialPosition - fPreStepLocation).mag();
+  }
+
   for( G4int num=0; num< fNoActiveNavigators; ++pNavigatorIter,++num )
   {
      safety= kInfinity;
 
-     step= (*pNavigatorIter)->ComputeStep( initialPosition, 
-                                           initialDirection,
-                                           proposedStepLength,
-                                           safety ); 
+     G4double estSafety= (num != 0) ? fNewSafety[num] - moveLen : -1.0;
+     if( proposedStepLength < estSafety )
+     {
+        step= kInfinity;     // Cannot reach a boundary of this geometry
+        safety= estSafety;   // Shrunk safety sphere, valid at this point
+     }
+     else
+     {
+        step= (*pNavigatorIter)->ComputeStep( initialPosition, 
+                                              initialDirection,
+                                              proposedStepLength,
+                                              safety ); 
+     }
      if( safety < minSafety ){ minSafety = safety; } 
      if( step < minStep )    { minStep= step; } 
 
@@ -285,6 +304,7 @@ void G4MultiNavigator::PrepareNavigators()
      fLimitTruth[num] = false;
      fLimitedStep[num] = kDoNot;
      fCurrentStepSize[num] = 0.0; 
+     fNewSafety[num] = -1.0;     // Safety of previous track is not reused
      fLocatedVolume[num] = 0; 
   }
   fWasLimitedByGeometry = false; 
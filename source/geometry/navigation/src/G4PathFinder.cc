@@ -71,7 +71,8 @@ G4PathFinder::G4PathFinder()
     fFieldExertedForce(false),
     fRelocatedPoint(true),
     fLastStepNo(-1), fCurrentStepNo(-1),
-    fVerboseLevel(0)
+    fVerboseLevel(0),
+    fUseSafetyForOptimization(true)
 {
    fpMultiNavigator= new G4MultiNavigator(); 
 
@@ -509,12 +510,32 @@ G4PathFinder::Locate( const   G4ThreeVector& position,
   }
 #endif
 
+  G4double moveSafetySq= -1.0;  // Move from the pre-safety location
+  if( fUseSafetyForOptimization && relative && !fNewTrack )
+  {
+     moveSafetySq= (position - fPreSafetyLocation).mag2();
+  }
+
   for ( G4int num=0; num< fNoActiveNavigators ; ++pNavIter,++num )
   {
      //  ... who limited the step ....
 
      if( fLimitTruth[num] ) { (*pNavIter)->SetGeometricallyLimitedStep(); }
 
+     // A parallel geometry which did not limit the step, and whose safety
+     //   sphere contains the new point, cannot have changed volume:
+     //   relocate it within the volume only (as ReLocate does)
+     //
+     if( (num != 0) && (!fLimitTruth[num]) && (fLocatedVolume[num] != 0)
+         && (moveSafetySq >= 0.0)
+         && (moveSafetySq < sqr(fPreSafetyValues[num])) )
+     {
+        (*pNavIter)->LocateGlobalPointWithinVolume( position );
+        fLimitedStep[num]   = kDoNot; 
+        fCurrentStepSize[num] = 0.0;      
+        continue;
+     }
+
      G4VPhysicalVolume *pLocated= 
      (*pNavIter)->LocateGlobalPointAndSetup( position, &direction,
                                              relative,  
@@ -901,6 +922,13 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack &initialState,
 
 #ifdef G4PATHFINDER_OPTIMISATION
         if( proposedStepLength <= safety )  // Should be just < safety ?
+#else
+        // A parallel geometry cannot limit a step shorter than its safety:
+        //   its navigator is not called, and its safety sphere is shrunk.
+        //   The mass navigator is always called (as G4Transportation does).
+        if( fUseSafetyForOptimization && (num != IdTransport)
+            && (proposedStepLength < safety) )
+#endif
         {
            // The Step is guaranteed to be taken
 
@@ -915,7 +943,6 @@ G4PathFinder::DoNextLinearStep( const G4FieldTrack &initialState,
 #endif
         }
         else
-#endif   // End of G4PATHFINDER_OPTIMISATION 2
         {
 #ifdef G4DEBUG_PATHFINDER
            G4double previousSafety= safety; 
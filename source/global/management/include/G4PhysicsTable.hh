@@ -114,6 +114,7 @@ class G4PhysicsTable : public std::vector<G4PhysicsVector*>
   
   G4bool RetrievePhysicsTable(const G4String& filename, G4bool ascii=false);
     // Retrieves Physics from a file (returns false in case of failure).
+    // In binary mode files written by G4PhysicsTableArchive are accepted.
 
   void ResetFlagArray();
     // Reset the array of flags and all flags are set "true" 
@@ -123,6 +124,10 @@ class G4PhysicsTable : public std::vector<G4PhysicsVector*>
   G4bool GetFlag(size_t i) const;
   void   ClearFlag(size_t i);
     // Get/Clear the flag for the 'i-th' physics vector    
+
+  void   PackData();
+    // Build the interleaved data of all physics vectors of the table,
+    // should be called when the table is filled
    
   friend std::ostream& operator<<(std::ostream& out, G4PhysicsTable& table);
 
@@ -0,0 +1,101 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// 
+// ------------------------------------------------------------
+//      GEANT 4 class header file
+//
+// Class description:
+//
+// G4PhysicsTableArchive provides storage of a G4PhysicsTable in a 
+// versioned and checksummed binary archive, which is retrieved by
+// mapping the file read-only in memory. The retrieved physics vectors
+// keep no private copy of their nodes: Value() and all accessors read
+// the interleaved data directly in the mapping, so that all threads and
+// all jobs using the same archive on a node share the pages of the file.
+// A private copy is made only for a vector which is modified. Each file
+// is mapped once per process and mapping is kept until the end of the
+// process.
+//
+// Layout of the archive (native byte order, checked at retrieval):
+//   header : magic "G4PTARCH", version, byte order mark, 
+//            number of vectors, payload size, FNV-1a checksum of payload
+//   vector : type, spline flag, number of nodes, edgeMin, edgeMax,
+//            dBin, baseBin, followed by (energy, value, second
+//            derivative) of each node; type -1 marks a null entry
+//
+// G4PhysicsTable::RetrievePhysicsTable() in binary mode recognises
+// archives automatically.
+// ------------------------------------------------------------
+//
+// History:
+// -------
+// - 19 October 2026, first implementation
+//-------------------------------------
+
+#ifndef G4PhysicsTableArchive_h
+#define G4PhysicsTableArchive_h 1
+
+#include "globals.hh"
+
+class G4PhysicsTable;
+class G4PhysicsVector;
+
+class G4PhysicsTableArchive
+{
+ public: // with description
+
+  static G4bool Store(const G4PhysicsTable* table, const G4String& fileName);
+    // Stores the table in an archive (returns false in case of failure);
+    // packed and mapped vectors are stored from their packed data;
+    // the file is written under a temporary name and renamed at the end,
+    // so that processes which have mapped a previous version are not 
+    // affected.
+
+  static G4bool Retrieve(G4PhysicsTable* table, const G4String& fileName);
+    // Fills the table with vectors using the mapped data of the archive
+    // (returns false if the file is not a valid archive, in which case
+    // the table is not modified).
+
+  static G4bool IsArchive(const G4String& fileName);
+    // Checks if the file starts with the magic word of an archive
+
+  static const G4int version = 1;
+
+ private:
+
+  G4PhysicsTableArchive();
+  ~G4PhysicsTableArchive();
+
+  static G4PhysicsVector* CreatePhysicsVector(G4int type);
+
+  static const char* MapFile(const G4String& fileName, size_t& length);
+    // Returns the validated content of the file, mapped once per process
+};
+
+#endif
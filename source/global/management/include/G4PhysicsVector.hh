@@ -186,11 +186,31 @@ class G4PhysicsVector
     inline void SetSpline(G4bool);
          // Activate/deactivate Spline interpolation.
 
+    void PackData();
+    inline void UnpackData();
+    inline G4bool IsPacked() const;
+    inline G4bool IsMapped() const;
+         // Build/remove an interleaved copy of the vector in which energy,
+         // value and second derivative of each node are contiguous. 
+         // If it exists, Value() uses this copy, so that one lookup touches
+         // one or two cache lines instead of three separate arrays.
+         // Results are identical to the ones of the unpacked vector.
+         // The copy is kept consistent by the methods modifying the vector.
+         // The separate node arrays are released after packing, so that
+         // memory is not doubled; IsMapped() is then true and all accessors
+         // read the packed data. Node arrays are made again by UnmapData()
+         // if the vector is modified, and released at the next PackData().
+         // Packed data may also be located in a read-only memory mapped
+         // archive (see G4PhysicsTableArchive). Such a mapped vector keeps
+         // no private node arrays, all accessors read the mapped data;
+         // private arrays and packed data are made only if it is modified.
+
     virtual G4bool Store(std::ofstream& fOut, G4bool ascii=false);
     virtual G4bool Retrieve(std::ifstream& fIn, G4bool ascii=false);
          // To store/retrieve persistent data to/from file streams.
 
     friend std::ostream& operator<<(std::ostream&, const G4PhysicsVector&);
+    friend class G4PhysicsTableArchive;
 
     inline void SetVerboseLevel(G4int value);
     inline G4int GetVerboseLevel(G4int);
@@ -202,6 +222,15 @@ class G4PhysicsVector
     void CopyData(const G4PhysicsVector& vec);
          // Internal methods for allowing copy of objects
 
+    inline void UpdatePackedData();
+    inline void UpdatePackedNode(size_t index);
+         // To be called by derived classes after modification of the 
+         // data of the vector or of a node of the vector
+
+    void UnmapData();
+         // Fills the node arrays of a mapped vector from the mapped data;
+         // to be called by derived classes before modification of arrays
+
   protected:
 
     G4PhysicsVectorType type;   // The type of PhysicsVector (enumerator)
@@ -214,11 +243,16 @@ class G4PhysicsVector
     G4PVDataVector  dataVector;    // Vector to keep the crossection/energyloss
     G4PVDataVector  binVector;     // Vector to keep energy
     G4PVDataVector  secDerivative; // Vector to keep second derivatives 
+    G4PVDataVector  packedVector;  // Interleaved (energy,value,2nd derivative)
+    const G4double* packedData;    // packedVector or data of a mapped archive
 
   private:
 
     G4bool SplinePossible();
 
+    void FillPackedData();
+         // Fill packedVector from the node arrays
+
     inline G4double LinearInterpolation(size_t idx, G4double energy) const;
          // Linear interpolation function
     inline G4double SplineInterpolation(size_t idx, G4double energy) const;
@@ -229,6 +263,10 @@ class G4PhysicsVector
     inline size_t FindBinLocation(G4double theEnergy) const;
          // Find the bin# in which theEnergy belongs 
 
+    inline size_t FindPackedBin(G4double energy, size_t idx) const;
+    inline G4double PackedInterpolation(size_t idx, G4double energy) const;
+         // Same as FindBin() and Interpolation() using packed data
+
     G4bool     useSpline;
 
   protected:
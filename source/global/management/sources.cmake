@@ -59,6 +59,7 @@ GEANT4_DEFINE_MODULE(NAME G4globman
         G4PhysicsOrderedFreeVector.hh
         G4PhysicsOrderedFreeVector.icc
         G4PhysicsTable.hh
+        G4PhysicsTableArchive.hh
         G4PhysicsTable.icc
         G4PhysicsVector.hh
         G4PhysicsVector.icc
@@ -118,6 +119,7 @@ GEANT4_DEFINE_MODULE(NAME G4globman
         G4PhysicsModelCatalog.cc
         G4PhysicsOrderedFreeVector.cc
         G4PhysicsTable.cc
+        G4PhysicsTableArchive.cc
         G4PhysicsVector.cc
         G4Physics2DVector.cc
         G4Pow.cc
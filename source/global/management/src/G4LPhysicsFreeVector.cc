@@ -85,7 +85,7 @@ void G4LPhysicsFreeVector::DumpValues()
 {
    for (size_t i = 0; i < numberOfNodes; i++)
    {
-      G4cout << binVector[i] << "   " << dataVector[i]/millibarn << G4endl;
+      G4cout << Energy(i) << "   " << (*this)[i]/millibarn << G4endl;
    }
 }
 
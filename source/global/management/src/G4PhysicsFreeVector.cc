@@ -95,8 +95,10 @@ void G4PhysicsFreeVector::PutValue( size_t theBinNumber,
 				    G4double theBinValue, 
                                     G4double theDataValue )
 {
+  UnmapData();
   binVector[theBinNumber]  = theBinValue;
   dataVector[theBinNumber] = theDataValue;
+  UpdatePackedNode(theBinNumber);
 
   if( theBinNumber == numberOfNodes-1 )
   {
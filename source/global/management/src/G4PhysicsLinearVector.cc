@@ -98,8 +98,8 @@ G4bool G4PhysicsLinearVector::Retrieve(std::ifstream& fIn, G4bool ascii)
   G4bool success = G4PhysicsVector::Retrieve(fIn, ascii);
   if (success)
   {
-    G4double theEmin = binVector[0];
-    dBin = binVector[1]-theEmin;
+    G4double theEmin = Energy(0);
+    dBin = Energy(1)-theEmin;
     baseBin = theEmin/dBin;
   }
   return success;
@@ -108,8 +108,8 @@ G4bool G4PhysicsLinearVector::Retrieve(std::ifstream& fIn, G4bool ascii)
 void G4PhysicsLinearVector::ScaleVector(G4double factorE, G4double factorV)
 {
   G4PhysicsVector::ScaleVector(factorE, factorV);
-  G4double theEmin = binVector[0];
-  dBin = binVector[1]-theEmin;
+  G4double theEmin = Energy(0);
+  dBin = Energy(1)-theEmin;
   baseBin = theEmin/dBin;
 }
 
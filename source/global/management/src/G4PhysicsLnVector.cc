@@ -97,8 +97,8 @@ G4bool G4PhysicsLnVector::Retrieve(std::ifstream& fIn, G4bool ascii)
   G4bool success = G4PhysicsVector::Retrieve(fIn, ascii);
   if (success)
   {
-    G4double theEmin = binVector[0];
-    dBin = G4Log(binVector[1]/theEmin);
+    G4double theEmin = Energy(0);
+    dBin = G4Log(Energy(1)/theEmin);
     baseBin = G4Log(theEmin)/dBin;
   }
   return success;
@@ -107,8 +107,8 @@ G4bool G4PhysicsLnVector::Retrieve(std::ifstream& fIn, G4bool ascii)
 void G4PhysicsLnVector::ScaleVector(G4double factorE, G4double factorV)
 {
   G4PhysicsVector::ScaleVector(factorE, factorV);
-  G4double theEmin = binVector[0];
-  dBin = G4Log(binVector[1]/theEmin);
+  G4double theEmin = Energy(0);
+  dBin = G4Log(Energy(1)/theEmin);
   baseBin = G4Log(theEmin)/dBin;
 }
 
@@ -44,6 +44,8 @@
 //              2009-06-19 by V.Ivanchenko 
 //              > removed hidden bin 
 //              2013-10-02 by V.Ivanchenko removed FindBinLocation   
+//              2026-10-19 node values are taken by accessors, so that
+//              > packed vectors without node arrays may be used
 //
 // mail:        gum@triumf.ca
 //
@@ -90,6 +92,7 @@ G4PhysicsOrderedFreeVector::~G4PhysicsOrderedFreeVector() {}
   
 void G4PhysicsOrderedFreeVector::InsertValues(G4double energy, G4double value)
 {
+        UnmapData();
         std::vector<G4double>::iterator binLoc =
                  std::lower_bound(binVector.begin(), binVector.end(), energy);
 
@@ -103,6 +106,7 @@ void G4PhysicsOrderedFreeVector::InsertValues(G4double energy, G4double value)
         ++numberOfNodes;
         edgeMin = binVector.front();
         edgeMax = binVector.back();
+        UpdatePackedData();
 }
 
 G4double G4PhysicsOrderedFreeVector::GetEnergy(G4double aValue)
@@ -121,8 +125,25 @@ G4double G4PhysicsOrderedFreeVector::GetEnergy(G4double aValue)
 
 size_t G4PhysicsOrderedFreeVector::FindValueBinLocation(G4double aValue)
 {
-        size_t bin = std::lower_bound(dataVector.begin(), dataVector.end(), aValue)
-                   - dataVector.begin() - 1;
+        size_t bin;
+        if(IsMapped()) {
+          // lower_bound on the values of the packed data
+          size_t first = 0;
+          size_t count = numberOfNodes;
+          while(count > 0) {
+            size_t step = count/2;
+            if((*this)[first + step] < aValue) {
+              first += step + 1;
+              count -= step + 1;
+            } else {
+              count = step;
+            }
+          }
+          bin = first - 1;
+        } else {
+          bin = std::lower_bound(dataVector.begin(), dataVector.end(), aValue)
+              - dataVector.begin() - 1;
+        }
         bin = std::min(bin, numberOfNodes-2);
         return bin;
 }
@@ -130,10 +151,11 @@ size_t G4PhysicsOrderedFreeVector::FindValueBinLocation(G4double aValue)
 G4double G4PhysicsOrderedFreeVector::LinearInterpolationOfEnergy(G4double aValue,
 								 size_t bin)
 {
-        G4double res = binVector[bin];
-        G4double del = dataVector[bin+1] - dataVector[bin];
+        const G4PhysicsVector& v = *this;
+        G4double res = Energy(bin);
+        G4double del = v[bin+1] - v[bin];
         if(del > 0.0) { 
-          res += (aValue - dataVector[bin])*(binVector[bin+1] - res)/del;  
+          res += (aValue - v[bin])*(Energy(bin+1) - res)/del;  
         }
         return res;
 }
@@ -142,6 +164,6 @@ void G4PhysicsOrderedFreeVector::DumpValues()
 {
         for (size_t i = 0; i < numberOfNodes; i++)
         {
-          G4cout << binVector[i] << "\t" << dataVector[i] << G4endl;
+          G4cout << Energy(i) << "\t" << (*this)[i] << G4endl;
         }
 }
@@ -47,6 +47,7 @@
 #include "G4PhysicsOrderedFreeVector.hh"
 #include "G4PhysicsLinearVector.hh"
 #include "G4PhysicsLnVector.hh"
+#include "G4PhysicsTableArchive.hh"
  
 G4PhysicsTable::G4PhysicsTable()
   : G4PhysCollection()
@@ -165,6 +166,12 @@ G4bool G4PhysicsTable::ExistPhysicsTable(const G4String& fileName) const
 G4bool G4PhysicsTable::RetrievePhysicsTable(const G4String& fileName,
                                             G4bool          ascii)
 {
+  // memory mapped archive
+  if (!ascii && G4PhysicsTableArchive::IsArchive(fileName))
+  {
+    return G4PhysicsTableArchive::Retrieve(this, fileName);
+  }
+
   std::ifstream fIn;  
   // open input file
   if (ascii)
@@ -0,0 +1,390 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// 
+// ------------------------------------------------------------
+//      GEANT 4 class implementation
+//
+//      G4PhysicsTableArchive
+//
+// ------------------------------------------------------------
+
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <map>
+#include <vector>
+#include <stdint.h>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+#include "G4PhysicsTableArchive.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsVector.hh"
+#include "G4PhysicsVectorType.hh"
+#include "G4LPhysicsFreeVector.hh"
+#include "G4PhysicsLogVector.hh"
+#include "G4PhysicsFreeVector.hh"
+#include "G4PhysicsOrderedFreeVector.hh"
+#include "G4PhysicsLinearVector.hh"
+#include "G4PhysicsLnVector.hh"
+#include "G4AutoLock.hh"
+
+namespace
+{
+  G4Mutex archiveMutex = G4MUTEX_INITIALIZER;
+
+  const char     archiveMagic[8] = {'G','4','P','T','A','R','C','H'};
+  const uint32_t byteOrderMark   = 0x01020304;
+
+  struct ArchiveHeader
+  {
+    char     magic[8];
+    uint32_t version;
+    uint32_t byteOrder;
+    uint64_t nVectors;
+    uint64_t payloadSize;
+    uint64_t checksum;
+  };
+
+  struct VectorHeader
+  {
+    int32_t  type;
+    int32_t  spline;
+    uint64_t nNodes;
+    double   edgeMin;
+    double   edgeMax;
+    double   dBin;
+    double   baseBin;
+  };
+
+  struct MappedFile
+  {
+    const char* data;
+    size_t      length;
+  };
+
+  // files mapped in this process; mappings are never released as
+  // physics vectors may refer to them until the end of the job
+  std::map<G4String,MappedFile>* mappedFiles = 0;
+
+  uint64_t Checksum(const char* p, size_t n)
+  {
+    // FNV-1a 64 bit
+    uint64_t h = 14695981039346656037ULL;
+    for(size_t i=0; i<n; ++i) 
+    {
+      h ^= (unsigned char)(p[i]);
+      h *= 1099511628211ULL;
+    }
+    return h;
+  }
+}
+
+G4bool G4PhysicsTableArchive::Store(const G4PhysicsTable* table,
+                                    const G4String& fileName)
+{
+  if(!table) { return false; }
+
+  // payload
+  std::vector<char> payload;
+  for (G4PhysicsTable::const_iterator itr=table->begin(); 
+       itr!=table->end(); ++itr)
+  {
+    const G4PhysicsVector* pv = *itr;
+    VectorHeader vh;
+    std::memset(&vh, 0, sizeof vh);
+    vh.type = -1;
+    if(pv)
+    {
+      vh.type    = pv->GetType();
+      vh.spline  = pv->useSpline ? 1 : 0;
+      vh.nNodes  = pv->numberOfNodes;
+      vh.edgeMin = pv->edgeMin;
+      vh.edgeMax = pv->edgeMax;
+      vh.dBin    = pv->dBin;
+      vh.baseBin = pv->baseBin;
+    }
+    size_t offset = payload.size();
+    size_t n = (size_t)vh.nNodes;
+    payload.resize(offset + sizeof vh + 3*n*sizeof(G4double));
+    std::memcpy(&payload[offset], &vh, sizeof vh);
+    G4double* p = reinterpret_cast<G4double*>(&payload[offset + sizeof vh]);
+    if(n > 0 && pv->packedData)
+    {
+      // packed and mapped vectors may have no node arrays
+      std::memcpy(p, pv->packedData, 3*n*sizeof(G4double));
+    }
+    else
+    {
+      G4bool hasDerivatives = (n > 0 && pv->secDerivative.size() == n);
+      for(size_t i=0; i<n; ++i)
+      {
+        p[3*i]   = pv->Energy(i);
+        p[3*i+1] = (*pv)[i];
+        p[3*i+2] = hasDerivatives ? pv->secDerivative[i] : 0.0;
+      }
+    }
+  }
+
+  ArchiveHeader header;
+  std::memset(&header, 0, sizeof header);
+  std::memcpy(header.magic, archiveMagic, sizeof archiveMagic);
+  header.version     = version;
+  header.byteOrder   = byteOrderMark;
+  header.nVectors    = table->size();
+  header.payloadSize = payload.size();
+  header.checksum    = Checksum(payload.empty() ? 0 : &payload[0], 
+                                payload.size());
+
+  G4String tmpName = fileName + ".tmp";
+  std::ofstream fOut(tmpName, std::ios::out|std::ios::binary);
+  if (!fOut)
+  {
+#ifdef G4VERBOSE  
+    G4cerr << "G4PhysicsTableArchive::Store():";
+    G4cerr << " Cannot open file: " << tmpName << G4endl;
+#endif
+    return false;
+  }
+  fOut.write((const char*)(&header), sizeof header);
+  if(!payload.empty()) { fOut.write(&payload[0], payload.size()); }
+  fOut.close();
+  if(fOut.fail() || 0 != std::rename(tmpName.c_str(), fileName.c_str()))
+  {
+#ifdef G4VERBOSE  
+    G4cerr << "G4PhysicsTableArchive::Store():";
+    G4cerr << " Cannot write file: " << fileName << G4endl;
+#endif
+    std::remove(tmpName.c_str());
+    return false;
+  }
+
+  // a new version of the file has to be mapped again
+  G4AutoLock l(&archiveMutex);
+  if(mappedFiles) { mappedFiles->erase(fileName); }
+  return true;
+}
+
+G4bool G4PhysicsTableArchive::IsArchive(const G4String& fileName)
+{
+  std::ifstream fIn(fileName, std::ios::in|std::ios::binary);
+  if (!fIn) { return false; }
+  char magic[8];
+  fIn.read(magic, sizeof magic);
+  return (fIn.gcount() == G4int(sizeof magic) &&
+          0 == std::memcmp(magic, archiveMagic, sizeof magic));
+}
+
+const char* G4PhysicsTableArchive::MapFile(const G4String& fileName,
+                                           size_t& length)
+{
+  G4AutoLock l(&archiveMutex);
+  if(!mappedFiles) { mappedFiles = new std::map<G4String,MappedFile>; }
+  std::map<G4String,MappedFile>::const_iterator itr = 
+    mappedFiles->find(fileName);
+  if(itr != mappedFiles->end())
+  {
+    length = itr->second.length;
+    return itr->second.data;
+  }
+
+  const char* data = 0;
+  length = 0;
+#ifndef WIN32
+  G4int fd = open(fileName.c_str(), O_RDONLY);
+  if(fd < 0) { return 0; }
+  struct stat st;
+  if(0 == fstat(fd, &st) && st.st_size >= G4int(sizeof(ArchiveHeader)))
+  {
+    length = st.st_size;
+    void* p = mmap(0, length, PROT_READ, MAP_SHARED, fd, 0);
+    if(p != MAP_FAILED) { data = static_cast<const char*>(p); }
+  }
+  close(fd);
+#else
+  // no mapping available, keep the content of the file in memory
+  std::ifstream fIn(fileName, std::ios::in|std::ios::binary);
+  if(!fIn) { return 0; }
+  fIn.seekg(0, std::ios::end);
+  length = fIn.tellg();
+  fIn.seekg(0, std::ios::beg);
+  if(length >= sizeof(ArchiveHeader))
+  {
+    // G4double buffer to keep the alignment of the data
+    G4double* buf = new G4double[(length + sizeof(G4double) - 1)/
+                                 sizeof(G4double)];
+    fIn.read((char*)(buf), length);
+    if(G4int(fIn.gcount()) == G4int(length)) { data = (const char*)(buf); }
+    else { delete [] buf; }
+  }
+#endif
+  if(!data) { return 0; }
+
+  // validation of the header and of the checksum
+  ArchiveHeader header;
+  std::memcpy(&header, data, sizeof header);
+  G4bool valid = 
+    (0 == std::memcmp(header.magic, archiveMagic, sizeof archiveMagic)) &&
+    (header.version == uint32_t(version)) &&
+    (header.byteOrder == byteOrderMark) &&
+    (header.payloadSize + sizeof header == length) &&
+    (header.checksum == Checksum(data + sizeof header, 
+                                 (size_t)header.payloadSize));
+  if(!valid)
+  {
+#ifdef G4VERBOSE  
+    G4cerr << "G4PhysicsTableArchive::Retrieve():";
+    G4cerr << " Invalid or corrupted archive: " << fileName << G4endl;
+#endif
+#ifndef WIN32
+    munmap(const_cast<char*>(data), length);
+#else
+    delete [] (const G4double*)(data);
+#endif
+    length = 0;
+    return 0;
+  }
+  MappedFile mf;
+  mf.data = data;
+  mf.length = length;
+  (*mappedFiles)[fileName] = mf;
+  return data;
+}
+
+G4bool G4PhysicsTableArchive::Retrieve(G4PhysicsTable* table,
+                                       const G4String& fileName)
+{
+  if(!table) { return false; }
+  size_t length = 0;
+  const char* data = MapFile(fileName, length);
+  if(!data) { return false; }
+
+  ArchiveHeader header;
+  std::memcpy(&header, data, sizeof header);
+  const char* p = data + sizeof header;
+  const char* end = data + length;
+
+  // vectors are collected first, the table is modified only if
+  // the whole archive is read successfully
+  std::vector<G4PhysicsVector*> vectors;
+  vectors.reserve((size_t)header.nVectors);
+  G4bool ok = true;
+  for(uint64_t idx=0; idx<header.nVectors; ++idx)
+  {
+    if(p + sizeof(VectorHeader) > end) 
+    { 
+      ok = false; 
+      break;
+    }
+    VectorHeader vh;
+    std::memcpy(&vh, p, sizeof vh);
+    p += sizeof vh;
+    if(vh.type < 0)
+    {
+      vectors.push_back(0);
+      continue;
+    }
+    size_t n = (size_t)vh.nNodes;
+    const G4double* packed = reinterpret_cast<const G4double*>(p);
+    p += 3*n*sizeof(G4double);
+    G4PhysicsVector* pv = CreatePhysicsVector(vh.type);
+    if(!pv || p > end)
+    {
+#ifdef G4VERBOSE  
+      G4cerr << "G4PhysicsTableArchive::Retrieve():";
+      G4cerr << " Illegal " << idx << "-th Physics Vector in: ";
+      G4cerr << fileName << G4endl;
+#endif          
+      delete pv;
+      ok = false;
+      break;
+    }
+    pv->numberOfNodes = n;
+    pv->edgeMin = vh.edgeMin;
+    pv->edgeMax = vh.edgeMax;
+    pv->dBin    = vh.dBin;
+    pv->baseBin = vh.baseBin;
+    pv->useSpline = (1 == vh.spline);
+
+    // the vector keeps no private copy of the nodes, all its accessors
+    // read the mapping
+    if(n > 0) { pv->packedData = packed; }
+    vectors.push_back(pv);
+  }
+  if(!ok)
+  {
+    for(size_t i=0; i<vectors.size(); ++i) { delete vectors[i]; }
+    return false;
+  }
+
+  table->clearAndDestroy();
+  table->reserve(vectors.size());
+  for(size_t i=0; i<vectors.size(); ++i) { table->push_back(vectors[i]); }
+  return true;
+}
+
+G4PhysicsVector* G4PhysicsTableArchive::CreatePhysicsVector(G4int type)
+{
+  G4PhysicsVector* pVector=0;
+  switch (type)
+  {
+  case T_G4PhysicsLinearVector: 
+    pVector = new G4PhysicsLinearVector();
+    break;
+
+  case T_G4PhysicsLogVector: 
+    pVector = new G4PhysicsLogVector();
+    break;
+
+  case T_G4PhysicsLnVector: 
+    pVector = new G4PhysicsLnVector();
+    break;
+
+  case T_G4PhysicsFreeVector: 
+    pVector = new G4PhysicsFreeVector();
+    break;
+
+  case T_G4PhysicsOrderedFreeVector: 
+    pVector = new G4PhysicsOrderedFreeVector();
+    break;
+
+  case T_G4LPhysicsFreeVector: 
+    pVector = new G4LPhysicsFreeVector();
+    break;
+  
+  default:
+    break;
+  }
+  return pVector;
+}
@@ -51,6 +51,8 @@
 //    04 May  2010  H.Kurashige   : use G4PhyscisVectorCache
 //    28 May  2010  H.Kurashige  : Stop using  pointers to G4PVDataVector
 //    16 Aug. 2011  H.Kurashige  : Add dBin, baseBin and verboseLevel
+//    19 Oct. 2026  Added optional interleaved packed data for Value()
+//    19 Oct. 2026  Node arrays are released after packing
 // --------------------------------------------------------------
 
 #include <iomanip>
@@ -61,6 +63,7 @@
 G4PhysicsVector::G4PhysicsVector(G4bool)
  : type(T_G4PhysicsVector),
    edgeMin(0.), edgeMax(0.), numberOfNodes(0),
+   packedData(0),
    useSpline(false), 
    dBin(0.), baseBin(0.),
    verboseLevel(0)
@@ -119,6 +122,8 @@ void G4PhysicsVector::DeleteData()
 {
   useSpline = false;
   secDerivative.clear();
+  packedVector.clear();
+  packedData = 0;
 }
 
 // --------------------------------------------------------------
@@ -131,6 +136,17 @@ void G4PhysicsVector::CopyData(const G4PhysicsVector& vec)
   numberOfNodes = vec.numberOfNodes;
   useSpline = vec.useSpline;
 
+  // a copy of a vector without node arrays copies its packed data,
+  // or uses the same data if they are located in a mapped archive
+  if(vec.IsMapped()) {
+    dataVector.clear();
+    binVector.clear();
+    secDerivative.clear();
+    packedVector = vec.packedVector;
+    packedData = packedVector.empty() ? vec.packedData : &packedVector[0];
+    return;
+  }
+
   size_t i;
   dataVector.resize(numberOfNodes);
   for(i=0; i<numberOfNodes; ++i) { 
@@ -146,13 +162,69 @@ void G4PhysicsVector::CopyData(const G4PhysicsVector& vec)
       secDerivative[i] = (vec.secDerivative)[i];
     }
   }
+  packedVector = vec.packedVector;
+  packedData = 0;
+  if(!packedVector.empty())  { packedData = &packedVector[0]; }
+  else if(vec.packedData)    { packedData = vec.packedData; }
+}
+
+// --------------------------------------------------------------
+
+void G4PhysicsVector::PackData()
+{
+  // data located in a mapped archive are already packed
+  if(packedData && packedVector.empty()) { return; }
+  FillPackedData();
+}
+
+// --------------------------------------------------------------
+
+void G4PhysicsVector::FillPackedData()
+{
+  if(2 > numberOfNodes) { 
+    UnpackData();
+    return; 
+  }
+  packedVector.resize(3*numberOfNodes);
+  G4bool hasDerivatives = (secDerivative.size() == numberOfNodes);
+  for(size_t i=0; i<numberOfNodes; ++i) {
+    packedVector[3*i]   = binVector[i];
+    packedVector[3*i+1] = dataVector[i];
+    packedVector[3*i+2] = hasDerivatives ? secDerivative[i] : 0.0;
+  }
+  packedData = &packedVector[0];
+
+  // node arrays are released, as for a mapped vector, so that
+  // packing does not double the memory of the vector
+  G4PVDataVector().swap(binVector);
+  G4PVDataVector().swap(dataVector);
+  G4PVDataVector().swap(secDerivative);
+}
+
+// --------------------------------------------------------------
+
+void G4PhysicsVector::UnmapData()
+{
+  if(!IsMapped()) { return; }
+  binVector.resize(numberOfNodes);
+  dataVector.resize(numberOfNodes);
+  for(size_t i=0; i<numberOfNodes; ++i) {
+    binVector[i]  = packedData[3*i];
+    dataVector[i] = packedData[3*i+1];
+  }
+  if(useSpline) {
+    secDerivative.resize(numberOfNodes);
+    for(size_t i=0; i<numberOfNodes; ++i) { 
+      secDerivative[i] = packedData[3*i+2]; 
+    }
+  }
 }
 
 // --------------------------------------------------------------
 
 G4double G4PhysicsVector::GetLowEdgeEnergy(size_t binNumber) const
 {
-  return binVector[binNumber];
+  return Energy(binNumber);
 }
 
 // --------------------------------------------------------------
@@ -173,14 +245,14 @@ G4bool G4PhysicsVector::Store(std::ofstream& fOut, G4bool ascii)
   fOut.write((char*)(&numberOfNodes), sizeof numberOfNodes);
 
   // contents
-  size_t size = dataVector.size(); 
+  size_t size = IsMapped() ? numberOfNodes : dataVector.size(); 
   fOut.write((char*)(&size), sizeof size);
 
   G4double* value = new G4double[2*size];
   for(size_t i = 0; i < size; ++i)
   {
-    value[2*i]  =  binVector[i];
-    value[2*i+1]=  dataVector[i];
+    value[2*i]  =  Energy(i);
+    value[2*i+1]=  (*this)[i];
   }
   fOut.write((char*)(value), 2*size*(sizeof (G4double)));
   delete [] value;
@@ -192,7 +264,10 @@ G4bool G4PhysicsVector::Store(std::ofstream& fOut, G4bool ascii)
 
 G4bool G4PhysicsVector::Retrieve(std::ifstream& fIn, G4bool ascii)
 {
-  // clear properties;
+  // clear properties; packed data are rebuilt if they existed
+  G4bool packed = (0 != packedData);
+  packedVector.clear();
+  packedData = 0;
   dataVector.clear();
   binVector.clear();
   secDerivative.clear();
@@ -233,6 +308,7 @@ G4bool G4PhysicsVector::Retrieve(std::ifstream& fIn, G4bool ascii)
     numberOfNodes = siz;
     edgeMin = binVector[0];
     edgeMax = binVector[numberOfNodes-1];
+    if(packed) { PackData(); }
     return true ;
   }
 
@@ -267,6 +343,7 @@ G4bool G4PhysicsVector::Retrieve(std::ifstream& fIn, G4bool ascii)
   numberOfNodes = size;
   edgeMin = binVector[0];
   edgeMax = binVector[numberOfNodes-1];
+  if(packed) { PackData(); }
 
   return true;
 }
@@ -276,6 +353,7 @@ G4bool G4PhysicsVector::Retrieve(std::ifstream& fIn, G4bool ascii)
 void 
 G4PhysicsVector::ScaleVector(G4double factorE, G4double factorV)
 {
+  UnmapData();
   size_t n = dataVector.size();
   size_t i;
   for(i=0; i<n; ++i) {
@@ -286,6 +364,7 @@ G4PhysicsVector::ScaleVector(G4double factorE, G4double factorV)
 
   edgeMin *= factorE;
   edgeMax *= factorE;
+  UpdatePackedData();
 }
 
 // --------------------------------------------------------------
@@ -304,7 +383,11 @@ G4PhysicsVector::ComputeSecondDerivatives(G4double firstPointDerivative,
     return;
   }
 
-  if(!SplinePossible()) { return; }
+  UnmapData();
+  if(!SplinePossible()) { 
+    UpdatePackedData();
+    return; 
+  }
 
   useSpline = true;
 
@@ -352,6 +435,7 @@ G4PhysicsVector::ComputeSecondDerivatives(G4double firstPointDerivative,
   secDerivative[0] = 0.5*(u[0] - secDerivative[1]);
 
   delete [] u;
+  UpdatePackedData();
 }
 
 // --------------------------------------------------------------
@@ -367,7 +451,11 @@ void G4PhysicsVector::FillSecondDerivatives()
     return;
   }
 
-  if(!SplinePossible()) { return; }
+  UnmapData();
+  if(!SplinePossible()) { 
+    UpdatePackedData();
+    return; 
+  }
 
   useSpline = true;
  
@@ -423,6 +511,7 @@ void G4PhysicsVector::FillSecondDerivatives()
   secDerivative[0]  = (secDerivative[1] - sig*secDerivative[2])/(1.0-sig);
 
   delete [] u;
+  UpdatePackedData();
 }
 
 // --------------------------------------------------------------
@@ -437,7 +526,11 @@ G4PhysicsVector::ComputeSecDerivatives()
     return;
   }
 
-  if(!SplinePossible())  { return; }
+  UnmapData();
+  if(!SplinePossible())  { 
+    UpdatePackedData();
+    return; 
+  }
 
   useSpline = true;
 
@@ -452,6 +545,7 @@ G4PhysicsVector::ComputeSecDerivatives()
   }
   secDerivative[n] = secDerivative[n-1];
   secDerivative[0] = secDerivative[1];
+  UpdatePackedData();
 }
 
 // --------------------------------------------------------------
@@ -483,10 +577,11 @@ std::ostream& operator<<(std::ostream& out, const G4PhysicsVector& pv)
       << pv.edgeMax << " " << pv.numberOfNodes << G4endl; 
 
   // contents
-  out << pv.dataVector.size() << G4endl; 
-  for(size_t i = 0; i < pv.dataVector.size(); i++)
+  size_t size = pv.IsMapped() ? pv.numberOfNodes : pv.dataVector.size();
+  out << size << G4endl; 
+  for(size_t i = 0; i < size; i++)
   {
-    out << pv.binVector[i] << "  " << pv.dataVector[i] << G4endl;
+    out << pv.Energy(i) << "  " << pv[i] << G4endl;
   }
   out << std::setprecision(6);
 
@@ -500,10 +595,13 @@ G4double G4PhysicsVector::Value(G4double theEnergy, size_t& lastIdx) const
   G4double y;
   if(theEnergy <= edgeMin) {
     lastIdx = 0; 
-    y = dataVector[0]; 
+    y = (*this)[0]; 
   } else if(theEnergy >= edgeMax) { 
     lastIdx = numberOfNodes-1; 
-    y = dataVector[lastIdx]; 
+    y = (*this)[lastIdx]; 
+  } else if(packedData) {
+    lastIdx = FindPackedBin(theEnergy, lastIdx);
+    y = PackedInterpolation(lastIdx, theEnergy);
   } else {
     lastIdx = FindBin(theEnergy, lastIdx);
     y = Interpolation(lastIdx, theEnergy);
@@ -516,14 +614,32 @@ G4double G4PhysicsVector::Value(G4double theEnergy, size_t& lastIdx) const
 G4double G4PhysicsVector::FindLinearEnergy(G4double rand) const
 {
   if(1 >= numberOfNodes) { return 0.0; }
-  G4double y = rand*dataVector[numberOfNodes-1];
-  size_t bin = std::lower_bound(dataVector.begin(), dataVector.end(), y)
-             - dataVector.begin() - 1;
+  const G4PhysicsVector& v = *this;
+  G4double y = rand*v[numberOfNodes-1];
+  size_t bin;
+  if(IsMapped()) {
+    // lower_bound on the strided values
+    size_t first = 0;
+    size_t count = numberOfNodes;
+    while(count > 0) {
+      size_t step = count/2;
+      if(v[first + step] < y) { 
+        first += step + 1;
+        count -= step + 1;
+      } else {
+        count = step;
+      }
+    }
+    bin = first - 1;
+  } else {
+    bin = std::lower_bound(dataVector.begin(), dataVector.end(), y)
+        - dataVector.begin() - 1;
+  }
   bin = std::min(bin, numberOfNodes-2);
-  G4double res = binVector[bin];
-  G4double del = dataVector[bin+1] - dataVector[bin];
+  G4double res = Energy(bin);
+  G4double del = v[bin+1] - v[bin];
   if(del > 0.0) { 
-    res += (y - dataVector[bin])*(binVector[bin+1] - res)/del;  
+    res += (y - v[bin])*(Energy(bin+1) - res)/del;  
   }
   return res;
 }
@@ -0,0 +1,113 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// 
+// ------------------------------------------------------------
+//	GEANT 4 class header file 
+//
+//	History: first implementation     19 Oct. 2026
+// ------------------------------------------------------------
+//
+#ifndef G4IonIndex_h
+#define G4IonIndex_h 1
+
+#include "globals.hh"
+#include "G4Threading.hh"
+
+#include <vector>
+#include <atomic>
+
+class G4ParticleDefinition;
+
+class G4IonIndex
+{
+ // Class Description
+ //   G4IonIndex is the index of ions (without lambdas) by Z and A
+ //   shared by all threads. For each nucleus it holds a small array
+ //   of levels sorted by excitation energy. Arrays are published by 
+ //   atomic pointers, so that search does not need any lock.
+ //   A new ion is added under a mutex by publishing a new copy of 
+ //   the array. Replaced arrays are kept until Clear() or deletion 
+ //   of the index, because other threads may still read them.
+ //
+
+ public:
+   G4IonIndex();
+   ~G4IonIndex();
+
+ private:
+   G4IonIndex(const G4IonIndex &right);
+   G4IonIndex & operator = (const G4IonIndex &right);
+
+ public: // With Description
+   const G4ParticleDefinition* FindIon(G4int Z, G4int A, G4double E,
+                                       G4double tolerance) const;
+   // ion with excitation energy E within the tolerance
+   const G4ParticleDefinition* FindIon(G4int Z, G4int A, G4int lvl) const;
+   // ion with the isomer level
+
+   void Insert(const G4ParticleDefinition* ion);
+   void Remove(const G4ParticleDefinition* ion);
+   // Insert/Remove an ion, ions with lambdas are ignored.
+   // The ion must be fully constructed: excitation energy and isomer
+   // level are taken from G4Ions, so Insert() must not be invoked
+   // from the constructor of G4ParticleDefinition.
+
+   void Clear();
+   // remove all ions, must not be used while other threads search
+
+ private:
+   struct Level {
+     G4double energy;
+     G4int    lvl;
+     const G4ParticleDefinition* ion;
+   };
+   typedef std::vector<Level> LevelList;
+   typedef std::atomic<const LevelList*> Slot;
+
+   enum { maxZ = 120, maxA = 999 };
+
+   inline const LevelList* GetLevels(G4int Z, G4int A) const;
+   void Publish(G4int Z, G4int A, LevelList* levels);
+
+   std::atomic<Slot*> rows[maxZ+1];
+   // per Z, maxA+1 slots allocated on first insertion
+   std::vector<const LevelList*> retired;
+   G4Mutex indexMutex;
+};
+
+inline const G4IonIndex::LevelList* 
+G4IonIndex::GetLevels(G4int Z, G4int A) const
+{
+  if ( (Z<1) || (Z>maxZ) || (A<1) || (A>maxA) ) return 0;
+  const Slot* row = rows[Z].load(std::memory_order_acquire);
+  if (row == 0) return 0;
+  return row[A].load(std::memory_order_acquire);
+}
+
+#endif
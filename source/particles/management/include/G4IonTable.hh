@@ -43,6 +43,7 @@
 //      Add GetNucleusEncoding according PDG 2006 9 Oct. 2006 H.Kurashige
 //      Use STL map                              30 Jul. 2009 H.Kurashige
 //      Add GetIsomerMass                       25 July 2013  H.Kurashige
+//      Search ions in shared G4IonIndex         19 Oct. 2026
 //
 #ifndef G4IonTable_h
 #define G4IonTable_h 1
@@ -61,6 +62,7 @@ class G4ParticleTable;
 class G4VIsotopeTable; 
 class G4IsotopeProperty;
 class G4NuclideTable; 
+class G4IonIndex;
 
 class G4IonTable
 {
@@ -290,12 +292,16 @@ class G4IonTable
    static G4ThreadLocal std::vector<G4VIsotopeTable*> *fIsotopeTableList;
    static G4IonList* fIonListShadow; 
    static std::vector<G4VIsotopeTable*> *fIsotopeTableListShadow;
+   static G4IonIndex* fIonIndex;
    // It is very important for multithreaded Geant4 to keep only one copy of the
    // particle table pointer and the ion table pointer. However, we try to let 
    // each worker thread hold its own copy of the particle dictionary and the 
    // ion list. This implementation is equivalent to make the ion table thread
    // private. The two shadow ponters are used by each worker thread to copy the
    // content from the master thread.
+   // Ions without lambdas are searched in the index shared by all threads, 
+   // which does not need a lock, so that ions created by any thread are 
+   // found without access to the master list.
    static const G4double tolerance;
  
    enum { numberOfElements = 118};
@@ -41,6 +41,7 @@ GEANT4_DEFINE_MODULE(NAME G4partman
         G4DynamicParticleFastVector.hh
         G4ElectronOccupancy.hh
         G4HyperNucleiProperties.hh
+        G4IonIndex.hh
         G4IonTable.hh
         G4Ions.hh
         G4IsotopeProperty.hh
@@ -87,6 +88,7 @@ GEANT4_DEFINE_MODULE(NAME G4partman
         G4DynamicParticle.cc
         G4ElectronOccupancy.cc
         G4HyperNucleiProperties.cc
+        G4IonIndex.cc
         G4IonTable.cc
         G4Ions.cc
         G4IsotopeProperty.cc
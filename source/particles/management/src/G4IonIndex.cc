@@ -0,0 +1,172 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// 
+// --------------------------------------------------------------
+//	GEANT 4 class implementation file 
+//
+//	History: first implementation     19 Oct. 2026
+// --------------------------------------------------------------
+//
+#include "G4IonIndex.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4Ions.hh"
+#include "G4AutoLock.hh"
+
+#include <cmath>
+
+////////////////////
+G4IonIndex::G4IonIndex()
+{
+  G4MUTEXINIT(indexMutex);
+  for (G4int Z = 0; Z <= maxZ; ++Z) rows[Z].store(0);
+}
+
+////////////////////
+G4IonIndex::~G4IonIndex()
+{
+  Clear();
+  for (G4int Z = 0; Z <= maxZ; ++Z) {
+    delete [] rows[Z].load();
+    rows[Z].store(0);
+  }
+  G4MUTEXDESTROY(indexMutex);
+}
+
+////////////////////
+const G4ParticleDefinition* 
+G4IonIndex::FindIon(G4int Z, G4int A, G4double E, G4double tolerance) const
+{
+  const LevelList* levels = GetLevels(Z, A);
+  if (levels == 0) return 0;
+  for (size_t i = 0; i < levels->size(); ++i) {
+    const Level& level = (*levels)[i];
+    if (level.energy >= E + tolerance) break;
+    if (std::fabs(E - level.energy) < tolerance) return level.ion;
+  }
+  return 0;
+}
+
+////////////////////
+const G4ParticleDefinition* 
+G4IonIndex::FindIon(G4int Z, G4int A, G4int lvl) const
+{
+  const LevelList* levels = GetLevels(Z, A);
+  if (levels == 0) return 0;
+  for (size_t i = 0; i < levels->size(); ++i) {
+    if ((*levels)[i].lvl == lvl) return (*levels)[i].ion;
+  }
+  return 0;
+}
+
+////////////////////
+void G4IonIndex::Insert(const G4ParticleDefinition* ion)
+{
+  if (ion == 0 || ion->GetQuarkContent(3) != 0) return;
+  G4int Z = ion->GetAtomicNumber();
+  G4int A = ion->GetAtomicMass();
+  if ( (Z<1) || (Z>maxZ) || (A<1) || (A>maxA) ) return;
+
+  // the proton is not derived from G4Ions
+  Level level;
+  level.energy = 0.0;
+  level.lvl = 0;
+  level.ion = ion;
+  const G4Ions* p = dynamic_cast<const G4Ions*>(ion);
+  if (p != 0) {
+    level.energy = p->GetExcitationEnergy();
+    level.lvl = p->GetIsomerLevel();
+  }
+
+  G4AutoLock l(&indexMutex);
+  const LevelList* old = GetLevels(Z, A);
+  LevelList* levels = (old) ? new LevelList(*old) : new LevelList();
+  LevelList::iterator it = levels->begin();
+  for (; it != levels->end(); ++it) {
+    if (it->ion == ion) {
+      delete levels;
+      return;
+    }
+    if (it->energy > level.energy) break;
+  }
+  levels->insert(it, level);
+  Publish(Z, A, levels);
+}
+
+////////////////////
+void G4IonIndex::Remove(const G4ParticleDefinition* ion)
+{
+  if (ion == 0) return;
+  G4int Z = ion->GetAtomicNumber();
+  G4int A = ion->GetAtomicMass();
+
+  G4AutoLock l(&indexMutex);
+  const LevelList* old = GetLevels(Z, A);
+  if (old == 0) return;
+  LevelList* levels = new LevelList();
+  levels->reserve(old->size());
+  for (size_t i = 0; i < old->size(); ++i) {
+    if ((*old)[i].ion != ion) levels->push_back((*old)[i]);
+  }
+  if (levels->size() == old->size()) {
+    delete levels;
+    return;
+  }
+  Publish(Z, A, levels);
+}
+
+////////////////////
+void G4IonIndex::Clear()
+{
+  G4AutoLock l(&indexMutex);
+  for (G4int Z = 0; Z <= maxZ; ++Z) {
+    Slot* row = rows[Z].load();
+    if (row == 0) continue;
+    for (G4int A = 0; A <= maxA; ++A) {
+      delete row[A].load();
+      row[A].store(0);
+    }
+  }
+  for (size_t i = 0; i < retired.size(); ++i) delete retired[i];
+  retired.clear();
+}
+
+////////////////////
+// called under the lock
+void G4IonIndex::Publish(G4int Z, G4int A, LevelList* levels)
+{
+  Slot* row = rows[Z].load(std::memory_order_acquire);
+  if (row == 0) {
+    row = new Slot[maxA+1];
+    for (G4int i = 0; i <= maxA; ++i) row[i].store(0);
+    rows[Z].store(row, std::memory_order_release);
+  }
+  const LevelList* old = row[A].load(std::memory_order_acquire);
+  row[A].store(levels, std::memory_order_release);
+  if (old != 0) retired.push_back(old);
+}
@@ -64,6 +64,7 @@
 #include "G4IsotopeProperty.hh"
 #include "G4VIsotopeTable.hh"
 #include "G4NuclideTable.hh"
+#include "G4IonIndex.hh"
 
 // It is very important for multithreaded Geant4 to keep only one copy of the
 // particle table pointer and the ion table pointer. However, we try to let 
@@ -76,6 +77,7 @@ G4ThreadLocal G4IonTable::G4IonList* G4IonTable::fIonList = 0;
 G4ThreadLocal std::vector<G4VIsotopeTable*> *G4IonTable::fIsotopeTableList = 0;
 G4IonTable::G4IonList* G4IonTable::fIonListShadow = 0;
 std::vector<G4VIsotopeTable*> *G4IonTable::fIsotopeTableListShadow = 0;
+G4IonIndex* G4IonTable::fIonIndex = 0;
 const G4double G4IonTable::tolerance = 2.0*keV;
 
 namespace lightions {
@@ -128,6 +130,10 @@ G4IonTable::G4IonTable()
   {
     fIonListShadow = fIonList;
   }
+  if (fIonIndex == 0)
+  {
+    fIonIndex = new G4IonIndex();
+  }
 
   fIsotopeTableList = new std::vector<G4VIsotopeTable*>;
 
@@ -200,6 +206,8 @@ G4IonTable::~G4IonTable()
   }
   fIsotopeTableList =0;
 
+  delete fIonIndex;
+  fIonIndex =0;
 
   if (fIonList ==0) return;
   // remove all contents in the Ion List 
@@ -339,6 +347,9 @@ G4ParticleDefinition* G4IonTable::CreateIon(G4int Z, G4int A, G4double E)
 
   //No Anti particle registered
   ion->SetAntiPDGEncoding(0);
+
+  // publish the ion to all threads, now that G4Ions is fully constructed
+  fIonIndex->Insert(ion);
   
 #ifdef G4VERBOSE
   if (GetVerboseLevel()>1) {
@@ -724,17 +735,27 @@ G4ParticleDefinition* G4IonTable::FindIon(G4int Z, G4int A, G4double E, G4int J)
     // light ion 
     isFound = true;
   } else {    
-    // -- loop over all particles in Ion table
-    G4int encoding=GetNucleusEncoding(Z, A);
-    G4IonList::iterator i = fIonList->find(encoding);
-    for( ;i != fIonList->end() ; i++) {
-      ion = i->second;
-      if ( ( ion->GetAtomicNumber() != Z) || (ion->GetAtomicMass()!=A) ) break;
-      // excitation level
-      G4double anExcitaionEnergy = ((const G4Ions*)(ion))->GetExcitationEnergy();
-      if ( std::fabs( E - anExcitaionEnergy )< tolerance) {
-	isFound = true;
-	break;
+    // -- search in the shared index (no lock)
+    ion = fIonIndex->FindIon(Z, A, E, tolerance);
+    isFound = (ion != 0);
+    if (isFound) {
+      // ion may have been created by another thread
+      if (fIonList != fIonListShadow) InsertWorker(ion);
+    } else {
+      // -- loop over all particles in Ion table
+      //    for ions which were not created by CreateIon()
+      G4int encoding=GetNucleusEncoding(Z, A);
+      G4IonList::iterator i = fIonList->find(encoding);
+      for( ;i != fIonList->end() ; i++) {
+        ion = i->second;
+        if ( ( ion->GetAtomicNumber() != Z) || (ion->GetAtomicMass()!=A) ) break;
+        // excitation level
+        G4double anExcitaionEnergy = ((const G4Ions*)(ion))->GetExcitationEnergy();
+        if ( std::fabs( E - anExcitaionEnergy )< tolerance) {
+          isFound = true;
+          fIonIndex->Insert(ion);
+          break;
+        }
       }
     }
   }
@@ -817,18 +838,28 @@ G4ParticleDefinition* G4IonTable::FindIon(G4int Z, G4int A, G4int lvl)
     // light ion 
     isFound = true;
   } else {    
-    // -- loop over all particles in Ion table
-    G4int encoding=GetNucleusEncoding(Z, A);
-    G4IonList::iterator i = fIonList->find(encoding);
-    for( ;i != fIonList->end() ; i++) {
-      ion = i->second;
-      if ( ( ion->GetAtomicNumber() != Z) || (ion->GetAtomicMass()!=A) ) break;
-      // excitation level
-      if ( ((const G4Ions*)(ion))->GetIsomerLevel() == lvl) {
-	isFound = true;
-	break;
+    // -- search in the shared index (no lock)
+    ion = fIonIndex->FindIon(Z, A, lvl);
+    isFound = (ion != 0);
+    if (isFound) {
+      // ion may have been created by another thread
+      if (fIonList != fIonListShadow) InsertWorker(ion);
+    } else {
+      // -- loop over all particles in Ion table
+      //    for ions which were not created by CreateIon()
+      G4int encoding=GetNucleusEncoding(Z, A);
+      G4IonList::iterator i = fIonList->find(encoding);
+      for( ;i != fIonList->end() ; i++) {
+        ion = i->second;
+        if ( ( ion->GetAtomicNumber() != Z) || (ion->GetAtomicMass()!=A) ) break;
+        // excitation level
+        if ( ((const G4Ions*)(ion))->GetIsomerLevel() == lvl) {
+          isFound = true;
+          fIonIndex->Insert(ion);
+          break;
+        }
       }
-    } 
+    }
   }
 
   if ( isFound ){ 
@@ -1238,20 +1269,22 @@ G4double  G4IonTable::GetNucleusMass(G4int Z, G4int A, G4int LL, G4int lvl) cons
     
     // Isomer
     if ( lvl>0 ) {
-      // -- loop over all particles in Ion table
-      G4int encoding=GetNucleusEncoding(Z, A);
-      G4IonList::iterator i = fIonList->find(encoding);
-      G4bool isFound =false;
-      for( ;i != fIonList->end() ; i++) {
-	ion = i->second;
-	if ( ( ion->GetAtomicNumber() != Z) || (ion->GetAtomicMass()!=A) ) break;
-	// excitation level
-	if ( ((const G4Ions*)(ion))->GetIsomerLevel() == lvl) {
-	  isFound = true;
-	  break;
+      // -- search in the shared index
+      ion = fIonIndex->FindIon(Z, A, lvl);
+      if (ion == 0) {
+	// -- loop over all particles in Ion table
+	G4int encoding=GetNucleusEncoding(Z, A);
+	G4IonList::iterator i = fIonList->find(encoding);
+	for( ;i != fIonList->end() ; i++) {
+	  if ( ( i->second->GetAtomicNumber() != Z) || 
+	       ( i->second->GetAtomicMass()!=A) ) break;
+	  if ( ((const G4Ions*)(i->second))->GetIsomerLevel() == lvl) {
+	    ion = i->second;
+	    break;
+	  }
 	}
       }
-      if (isFound) {
+      if (ion != 0) {
 	// return existing isomer mass
 	mass = ion->GetPDGMass();
       } else {
@@ -1300,6 +1333,7 @@ void G4IonTable::clear()
     }
 #endif
   fIonList->clear();
+  if (fIonList == fIonListShadow) fIonIndex->Clear();
 }
 
 void G4IonTable::Insert(const G4ParticleDefinition* particle)
@@ -1315,6 +1349,10 @@ void G4IonTable::Insert(const G4ParticleDefinition* particle)
   // regsiter the ion with its encoding of the groud state  
   fIonListShadow->insert( std::pair<const G4int, const G4ParticleDefinition*>(encoding, particle) );
 
+  // The ion is not added to the shared index here, because this method 
+  // is invoked by the constructor of G4ParticleDefinition, before the
+  // excitation energy and the isomer level of G4Ions are set.
+  // CreateIon() and FindIon() add it.
 }
 
 void G4IonTable::InsertWorker(const G4ParticleDefinition* particle)
@@ -1389,6 +1427,7 @@ void G4IonTable::Remove(const G4ParticleDefinition* particle)
 	}
       }
     }
+    fIonIndex->Remove(particle);
   } else {
 #ifdef G4VERBOSE
     if (GetVerboseLevel()>1) {
@@ -38,6 +38,7 @@
 // 13.02.2007 V.Ivanchenko use G4hMultipleScattering for muons
 // 13.02.2007 V.Ivanchenko set skin=0.0
 // 21.04.2008 V.Ivanchenko add long-lived D and B mesons
+// 19.10.2026 optional G4GammaGeneralProcess for gamma
 //
 //----------------------------------------------------------------------------
 //
@@ -51,6 +52,7 @@
 #include "G4ComptonScattering.hh"
 #include "G4GammaConversion.hh"
 #include "G4PhotoElectricEffect.hh"
+#include "G4GammaGeneralProcess.hh"
 
 #include "G4eMultipleScattering.hh"
 #include "G4MuMultipleScattering.hh"
@@ -217,9 +219,17 @@ void G4EmStandardPhysics::ConstructProcess()
 
     if (particleName == "gamma") {
 
-      ph->RegisterProcess(new G4PhotoElectricEffect(), particle);
-      ph->RegisterProcess(new G4ComptonScattering(), particle);
-      ph->RegisterProcess(new G4GammaConversion(), particle);
+      if(G4EmParameters::Instance()->GeneralProcessActive()) {
+        G4GammaGeneralProcess* gp = new G4GammaGeneralProcess();
+        gp->AddEmProcess(new G4PhotoElectricEffect());
+        gp->AddEmProcess(new G4ComptonScattering());
+        gp->AddEmProcess(new G4GammaConversion());
+        ph->RegisterProcess(gp, particle);
+      } else {
+        ph->RegisterProcess(new G4PhotoElectricEffect(), particle);
+        ph->RegisterProcess(new G4ComptonScattering(), particle);
+        ph->RegisterProcess(new G4GammaConversion(), particle);
+      }
 
     } else if (particleName == "e-") {
 
@@ -46,6 +46,9 @@
 //    couples can be different from one in file (i.e. at storing)
 //   Modified                      2 Mar. 2008 H.Kurashige
 //    add messenger
+//   Modified                      19 Oct. 2026
+//    optional sharing of couples between G4ProductionCuts objects 
+//    with identical cut values
 // ------------------------------------------------------------
 
 #ifndef G4ProductionCutsTable_h 
@@ -105,8 +108,20 @@ class G4ProductionCutsTable
     const G4MCCIndexConversionTable* GetMCCIndexConversionTable() const;
     // gives the pointer to the MCCIndexConversionTable
 
+    void   SetCoupleSharing(G4bool value);
+    G4bool IsCoupleSharingEnabled() const;
+    // If enabled, regions with different G4ProductionCuts objects but
+    // identical cut values use the same couple for a material, so 
+    // physics tables are built once for them. Regions and their user
+    // limits are not affected. Region specific EM configuration
+    // (models, deexcitation, biasing) identifies regions by their
+    // G4ProductionCuts, so such regions should keep unique cut values.
+
   private:
 
+    G4bool IsSameCutValues(const G4ProductionCuts* aCut1,
+                           const G4ProductionCuts* aCut2) const;
+
    static G4ProductionCutsTable* fG4ProductionCutsTable;
 
    typedef std::vector<G4MaterialCutsCouple*> G4CoupleTable;
@@ -236,6 +251,7 @@ class G4ProductionCutsTable
 
   private:
     G4int verboseLevel;
+    G4bool coupleSharing;
     G4ProductionCutsTableMessenger* fMessenger;
 
 };
@@ -354,6 +370,18 @@ inline
    return verboseLevel;
 }
 
+inline 
+ void G4ProductionCutsTable::SetCoupleSharing(G4bool value)
+{
+   coupleSharing = value;
+}
+
+inline 
+ G4bool G4ProductionCutsTable::IsCoupleSharingEnabled() const
+{
+   return coupleSharing;
+}
+
 inline
  const G4MCCIndexConversionTable* 
    G4ProductionCutsTable::GetMCCIndexConversionTable() const
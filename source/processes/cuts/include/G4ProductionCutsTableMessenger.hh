@@ -57,6 +57,7 @@ class G4UIcmdWithoutParameter;
 class G4UIcmdWithAnInteger;
 class G4UIcmdWithADoubleAndUnit;
 class G4UIcmdWithAString; 
+class G4UIcmdWithABool;
 class G4UIcommand;
 
 #include "G4UImessenger.hh"
@@ -86,6 +87,7 @@ public: // with description
     G4UIcmdWithADoubleAndUnit * setHighEdgeCmd; 
     G4UIcmdWithADoubleAndUnit * setMaxEnergyCutCmd; 
     G4UIcmdWithoutParameter *   dumpCmd;
+    G4UIcmdWithABool *          shareCmd;
  
 }; 
 
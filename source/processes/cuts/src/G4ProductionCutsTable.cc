@@ -71,7 +71,7 @@ G4ProductionCutsTable* G4ProductionCutsTable::GetProductionCutsTable()
 
 /////////////////////////////////////////////////////////////
 G4ProductionCutsTable::G4ProductionCutsTable()
-  : firstUse(true),verboseLevel(1),fMessenger(0)
+  : firstUse(true),verboseLevel(1),coupleSharing(false),fMessenger(0)
 {
   for(size_t i=0;i< NumberOfG4CutIndex;i++)
   {
@@ -181,6 +181,27 @@ void G4ProductionCutsTable::UpdateCoupleTable(G4VPhysicalVolume* /*currentWorld*
           break;
         }
       }
+
+      // Couple of another G4ProductionCuts with the same values,
+      // values are compared at each update, so a region is moved to
+      // a new couple if its cuts or cuts of the other region are changed
+      if(!coupleAlreadyDefined && coupleSharing){
+        for(CoupleTableIterator cItr=coupleTable.begin();
+            cItr!=coupleTable.end();cItr++){
+          if( (*cItr)->GetMaterial()==(*mItr)    && 
+              IsSameCutValues((*cItr)->GetProductionCuts(),fProductionCut)){ 
+            coupleAlreadyDefined = true;
+            aCouple = *cItr;
+            if(verboseLevel>1) {
+              G4cout << "G4ProductionCutsTable::UpdateCoupleTable: region <"
+                     << (*rItr)->GetName() << "> shares couple " 
+                     << aCouple->GetIndex() << " for " 
+                     << (*mItr)->GetName() << G4endl;
+            }
+            break;
+          }
+        }
+      }
       
       // If this combination is new, cleate and register a couple
       if(!coupleAlreadyDefined){
@@ -284,6 +305,20 @@ void G4ProductionCutsTable::UpdateCoupleTable(G4VPhysicalVolume* /*currentWorld*
 }
 
 
+/////////////////////////////////////////////////////////////
+G4bool G4ProductionCutsTable::IsSameCutValues(const G4ProductionCuts* aCut1,
+                                              const G4ProductionCuts* aCut2) const
+{
+  if(aCut1 == aCut2) return true;
+  if(aCut1 == 0 || aCut2 == 0) return false;
+  for(G4int ptcl=0;ptcl<NumberOfG4CutIndex;ptcl++){
+    if(aCut1->GetProductionCut(ptcl) != aCut2->GetProductionCut(ptcl)) {
+      return false;
+    }
+  }
+  return true;
+}
+
 /////////////////////////////////////////////////////////////
 G4double G4ProductionCutsTable::ConvertRangeToEnergy(
 				  const G4ParticleDefinition* particle,
@@ -43,6 +43,7 @@
 #include "G4UIcmdWithAnInteger.hh"
 #include "G4UIcmdWithADoubleAndUnit.hh"
 #include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithABool.hh"
 #include "G4ios.hh"
 #include "G4Tokenizer.hh"           
 
@@ -97,10 +98,22 @@ G4ProductionCutsTableMessenger::G4ProductionCutsTableMessenger(   G4ProductionCu
   dumpCmd = new G4UIcmdWithoutParameter("/cuts/dump",this);
   dumpCmd->SetGuidance("Dump cuplues in ProductuinCutsTable. ");
 
+  // /cuts/shareCouples command
+  shareCmd = new G4UIcmdWithABool("/cuts/shareCouples",this);
+  shareCmd->SetGuidance("Enable/disable sharing of couples between regions");
+  shareCmd->SetGuidance("with identical production cut values.");
+  shareCmd->SetGuidance("Physics tables are then built once per material");
+  shareCmd->SetGuidance("and cut values. Regions with region specific EM");
+  shareCmd->SetGuidance("models or options should have unique cut values.");
+  shareCmd->SetParameterName("flag",true);
+  shareCmd->SetDefaultValue(true);
+  shareCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
 }
 
 G4ProductionCutsTableMessenger::~G4ProductionCutsTableMessenger()
 {
+  delete shareCmd;
   delete dumpCmd;
   delete setMaxEnergyCutCmd;
   delete setHighEdgeCmd;
@@ -118,6 +131,9 @@ void G4ProductionCutsTableMessenger::SetNewValue(G4UIcommand * command,
   } else if( command==dumpCmd ){
     theCutsTable-> DumpCouples();
 
+  } else if( command==shareCmd ){
+    theCutsTable->SetCoupleSharing(shareCmd->GetNewBoolValue(newValue)); 
+
   } else if( command==setLowEdgeCmd ){
     G4double lowEdge = setLowEdgeCmd->GetNewDoubleValue(newValue); 
     G4double highEdge = theCutsTable->GetHighEdgeEnergy();
@@ -142,6 +158,9 @@ G4String G4ProductionCutsTableMessenger::GetCurrentValue(G4UIcommand * command)
   if( command==verboseCmd ){
    cv = verboseCmd->ConvertToString(theCutsTable->GetVerboseLevel());
 
+ } else if( command==shareCmd ){
+   cv = shareCmd->ConvertToString(theCutsTable->IsCoupleSharingEnabled());
+
  } else if( command==setLowEdgeCmd ){
     G4double lowEdge = theCutsTable->GetLowEdgeEnergy();
     cv = setLowEdgeCmd->ConvertToString( lowEdge, "keV" );
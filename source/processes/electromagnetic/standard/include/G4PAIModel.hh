@@ -41,7 +41,8 @@
 // 26-09-07 Fixed tmax computation (V.Ivantchenko)
 // 19.08.13 V.Ivanchenko extract data handling to G4PAIModelData class 
 //          added sharing of internal data between threads (MT migration)
-//
+// 19.10.26 Tables are shared between couples of the same material, built 
+//          on first use and optionally stored in files
 //
 // Class Description:
 //
@@ -118,6 +119,11 @@ public:
 
   inline void SetVerboseLevel(G4int verbose);
 
+  // tables are retrieved from and stored to files with names
+  // "<directory>/PAI_<particle>_<material>_*.dat"; the directory
+  // should exist, empty string means no persistency
+  inline void SetTableDirectory(const G4String& dir);
+
 protected:
 
   G4double MaxSecondaryEnergy(const G4ParticleDefinition*,
@@ -136,6 +142,7 @@ private:
   G4int                       fVerbose; 
 
   G4PAIModelData*             fModelData; 
+  G4String                    fTableDirectory;
 
   std::vector<const G4MaterialCutsCouple*> fMaterialCutsCoupleVector;
   std::vector<const G4Region*>      fPAIRegionVector;
@@ -171,6 +178,11 @@ inline void G4PAIModel::SetVerboseLevel(G4int verbose)
   fVerbose=verbose; 
 }
 
+inline void G4PAIModel::SetTableDirectory(const G4String& dir) 
+{ 
+  fTableDirectory = dir; 
+}
+
 inline G4int G4PAIModel::FindCoupleIndex(const G4MaterialCutsCouple* couple)
 {
   G4int idx = -1;
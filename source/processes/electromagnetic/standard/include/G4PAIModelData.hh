@@ -39,6 +39,8 @@
 // Modifications:
 //
 // 04.10.13 V. Grichine add cut of dE/dx, redirect <dE/dx> to   std::vector<G4PhysicsLogVector*>  fdEdxTable;
+// 19.10.26 Data are shared between couples of the same material and
+//          are built on first use; optional persistency of tables
 //
 //
 // Class Description:
@@ -48,6 +50,13 @@
 // of these data between threads.
 //
 // Internal data tables are computed for proton. 
+//
+// Tables do not depend on production cuts, so couples with the same
+// material share one data set. Tables of a data set are computed on 
+// first access to one of its couples by any thread, under a lock; a
+// flag per data set is set when the tables are complete, so that other
+// threads test it without a lock. If a file prefix is defined, tables
+// are retrieved from files or stored in files after computation.
 
 // -------------------------------------------------------------------
 //
@@ -56,6 +65,8 @@
 #define G4PAIModelData_h 1
 
 #include <vector>
+#include <deque>
+#include <atomic>
 #include "globals.hh"
 #include "G4PAIySection.hh"
 #include "G4SandiaTable.hh"
@@ -63,6 +74,7 @@
 class G4PhysicsLogVector;
 class G4PhysicsTable;
 class G4MaterialCutsCouple;
+class G4Material;
 class G4PAIModel;
 
 class G4PAIModelData 
@@ -74,7 +86,22 @@ public:
 
   ~G4PAIModelData();
 
-  void Initialise(const G4MaterialCutsCouple*, G4PAIModel*);
+  // registration of the next couple of the model, returns true 
+  // if a new data set is defined for the couple
+  G4bool Initialise(const G4MaterialCutsCouple*, G4PAIModel*);
+
+  // prefix of file names for persistent tables, tables are retrieved
+  // on first use of a data set and stored after computation
+  inline void SetFilePrefix(const G4String& prefix);
+
+  // number of different data sets
+  inline G4int NumberOfDataSets() const;
+
+  // index of data set of the couple
+  inline G4int DataSetIndex(G4int coupleIndex) const;
+
+  // memory in bytes used by the data set, zero if it is not yet built
+  size_t MemoryUsage(G4int dataSetIndex) const;
 
   G4double DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const;
@@ -93,7 +120,18 @@ public:
 
 private:
 
-  G4double GetEnergyTransfer(G4int coupleIndex, size_t iPlace, 
+  // access to the data set of the couple, data are built if needed
+  inline G4int DataIndex(G4int coupleIndex) const;
+
+  void BuildData(G4int idx) const;
+
+  void ComputeData(G4int idx) const;
+
+  G4bool RetrieveData(G4int idx) const;
+
+  void StoreData(G4int idx) const;
+
+  G4double GetEnergyTransfer(G4int idx, size_t iPlace, 
 			     G4double position) const;
 
   // hide assignment operator 
@@ -101,22 +139,56 @@ private:
   G4PAIModelData(const  G4PAIModelData&);
 
   G4int                fTotBin;
+  G4int                fVerbose;
   G4double             fLowestKineticEnergy;
   G4double             fHighestKineticEnergy;
 
   G4PhysicsLogVector*  fParticleEnergyVector;
 
-  G4PAIySection        fPAIySection;
-  G4SandiaTable        fSandia;
+  mutable G4PAIySection fPAIySection;
+  mutable G4SandiaTable fSandia;
+
+  // max energy transfer per energy bin of the model
+  std::vector<G4double>             fTransferMax;
+  G4String                          fFilePrefix;
 
-  std::vector<G4PhysicsTable*>      fPAIxscBank;
-  std::vector<G4PhysicsTable*>      fPAIdEdxBank;
-  std::vector<G4PhysicsLogVector*>  fdEdxTable;
+  // index of data set per couple of the model
+  std::vector<G4int>                fDataIndex;
+  std::vector<const G4Material*>    fMaterials;
+
+  mutable std::vector<G4PhysicsTable*>      fPAIxscBank;
+  mutable std::vector<G4PhysicsTable*>      fPAIdEdxBank;
+  mutable std::vector<G4PhysicsLogVector*>  fdEdxTable;
+
+  // true when the tables of the data set are complete
+  mutable std::deque<std::atomic<G4bool> >  fBuilt;
   //  std::vector<G4PhysicsLogVector*>  fdNdxCutTable;
   //std::vector<G4PhysicsLogVector*>  fdEdxCutTable;
 
 };
 
+inline void G4PAIModelData::SetFilePrefix(const G4String& prefix)
+{
+  fFilePrefix = prefix;
+}
+
+inline G4int G4PAIModelData::NumberOfDataSets() const
+{
+  return fMaterials.size();
+}
+
+inline G4int G4PAIModelData::DataSetIndex(G4int coupleIndex) const
+{
+  return fDataIndex[coupleIndex];
+}
+
+inline G4int G4PAIModelData::DataIndex(G4int coupleIndex) const
+{
+  G4int idx = fDataIndex[coupleIndex];
+  if(!fBuilt[idx].load(std::memory_order_acquire)) { BuildData(idx); }
+  return idx;
+}
+
 #endif
 
 
@@ -37,6 +37,8 @@
 // Creation date: 07.10.2013
 //
 // Modifications:
+// 19.10.26 Data are shared between couples with the same material and cuts
+//          and are built on first use; optional persistency of tables
 //
 //
 // Class Description:
@@ -47,6 +49,13 @@
 //
 // Internal data tables are computed for proton. 
 //
+// Tables depend on production cuts, couples with the same material and
+// cuts share one data set. Tables of a data set are computed on first
+// access to one of its couples by any thread, under a lock; a flag per
+// data set is set when the tables are complete, so that other threads
+// test it without a lock. If a file prefix is defined, tables are 
+// retrieved from files or stored in files after computation.
+//
 // -------------------------------------------------------------------
 //
 
@@ -54,6 +63,8 @@
 #define G4PAIPhotData_h 1
 
 #include <vector>
+#include <deque>
+#include <atomic>
 #include "globals.hh"
 #include "G4PAIxSection.hh"
 #include "G4SandiaTable.hh"
@@ -61,6 +72,7 @@
 class G4PhysicsLogVector;
 class G4PhysicsTable;
 class G4MaterialCutsCouple;
+class G4Material;
 class G4PAIPhotModel;
 
 class G4PAIPhotData 
@@ -72,8 +84,13 @@ public:
 
   ~G4PAIPhotData();
 
+  // registration of the next couple of the model
   void Initialise(const G4MaterialCutsCouple*, G4double cut, G4PAIPhotModel*);
 
+  // prefix of file names for persistent tables, tables are retrieved
+  // on first use of a data set and stored after computation
+  inline void SetFilePrefix(const G4String& prefix);
+
   G4double DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const;
 
@@ -101,11 +118,24 @@ public:
 
 private:
 
-  G4double GetEnergyTransfer(G4int coupleIndex, size_t iPlace, 
+  // access to the data set of the couple, data are built if needed
+  inline G4int DataIndex(G4int coupleIndex) const;
+
+  void BuildData(G4int idx) const;
+
+  void ComputeData(G4int idx) const;
+
+  G4bool RetrieveData(G4int idx) const;
+
+  void StoreData(G4int idx) const;
+
+  G4String FileName(G4int idx) const;
+
+  G4double GetEnergyTransfer(G4int idx, size_t iPlace, 
 			     G4double position) const;
-  G4double GetEnergyPhotonTransfer(G4int coupleIndex, size_t iPlace, 
+  G4double GetEnergyPhotonTransfer(G4int idx, size_t iPlace, 
 			     G4double position) const;
-  G4double GetEnergyPlasmonTransfer(G4int coupleIndex, size_t iPlace, 
+  G4double GetEnergyPlasmonTransfer(G4int idx, size_t iPlace, 
 			     G4double position) const;
 
   // hide assignment operator 
@@ -113,29 +143,55 @@ private:
   G4PAIPhotData(const  G4PAIPhotData&);
 
   G4int                fTotBin;
+  G4int                fVerbose;
   G4double             fLowestKineticEnergy;
   G4double             fHighestKineticEnergy;
 
   G4PhysicsLogVector*  fParticleEnergyVector;
 
-  G4PAIxSection        fPAIxSection;
-  G4SandiaTable        fSandia;
+  // index of data set per couple of the model, couples with the same
+  // material and cuts share one data set
+  std::vector<G4int>                fDataIndex;
+  std::vector<const G4Material*>    fMaterials;
+  std::vector<G4double>             fCuts;
 
-  std::vector<G4PhysicsTable*>      fPAIxscBank;
-  std::vector<G4PhysicsTable*>      fPAIphotonBank;
-  std::vector<G4PhysicsTable*>      fPAIplasmonBank;
+  // max energy transfer per energy bin of the model
+  std::vector<G4double>             fTransferMax;
+  G4String                          fFilePrefix;
 
-  std::vector<G4PhysicsTable*>      fPAIdEdxBank;
-  std::vector<G4PhysicsLogVector*>  fdEdxTable;
+  mutable G4PAIxSection fPAIxSection;
+  mutable G4SandiaTable fSandia;
 
-  std::vector<G4PhysicsLogVector*>  fdNdxCutTable;
-  std::vector<G4PhysicsLogVector*>  fdNdxCutPhotonTable;
-  std::vector<G4PhysicsLogVector*>  fdNdxCutPlasmonTable;
+  mutable std::vector<G4PhysicsTable*>      fPAIxscBank;
+  mutable std::vector<G4PhysicsTable*>      fPAIphotonBank;
+  mutable std::vector<G4PhysicsTable*>      fPAIplasmonBank;
 
-  std::vector<G4PhysicsLogVector*>  fdEdxCutTable;
+  mutable std::vector<G4PhysicsTable*>      fPAIdEdxBank;
+  mutable std::vector<G4PhysicsLogVector*>  fdEdxTable;
+
+  mutable std::vector<G4PhysicsLogVector*>  fdNdxCutTable;
+  mutable std::vector<G4PhysicsLogVector*>  fdNdxCutPhotonTable;
+  mutable std::vector<G4PhysicsLogVector*>  fdNdxCutPlasmonTable;
+
+  mutable std::vector<G4PhysicsLogVector*>  fdEdxCutTable;
+
+  // true when the tables of the data set are complete
+  mutable std::deque<std::atomic<G4bool> >  fBuilt;
 
 };
 
+inline void G4PAIPhotData::SetFilePrefix(const G4String& prefix)
+{
+  fFilePrefix = prefix;
+}
+
+inline G4int G4PAIPhotData::DataIndex(G4int coupleIndex) const
+{
+  G4int idx = fDataIndex[coupleIndex];
+  if(!fBuilt[idx].load(std::memory_order_acquire)) { BuildData(idx); }
+  return idx;
+}
+
 #endif
 
 
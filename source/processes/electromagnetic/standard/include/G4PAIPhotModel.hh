@@ -36,6 +36,8 @@
 //
 // Creation date: 07.10.2013
 //
+// Modifications:
+// 19.10.26 Tables are built on first use and optionally stored in files
 //
 // Class Description:
 //
@@ -113,6 +115,11 @@ public:
 
   inline void SetVerboseLevel(G4int verbose);
 
+  // tables are retrieved from and stored to files with names
+  // "<directory>/PAIPhot_<particle>_<material>_<cuts>keV_*.dat"; the 
+  // directory should exist, empty string means no persistency
+  inline void SetTableDirectory(const G4String& dir);
+
 protected:
 
   G4double MaxSecondaryEnergy(const G4ParticleDefinition*,
@@ -131,6 +138,7 @@ private:
   G4int                       fVerbose; 
 
   G4PAIPhotData*             fModelData; 
+  G4String                   fTableDirectory;
 
   std::vector<const G4MaterialCutsCouple*> fMaterialCutsCoupleVector;
   std::vector<const G4Region*>      fPAIRegionVector;
@@ -166,6 +174,11 @@ inline void G4PAIPhotModel::SetVerboseLevel(G4int verbose)
   fVerbose=verbose; 
 }
 
+inline void G4PAIPhotModel::SetTableDirectory(const G4String& dir) 
+{ 
+  fTableDirectory = dir; 
+}
+
 inline G4int G4PAIPhotModel::FindCoupleIndex(const G4MaterialCutsCouple* couple)
 {
   G4int idx = -1;
@@ -0,0 +1,115 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class header file
+//
+//
+// File name:     G4SBBremSamplingTable
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// Class Description:
+//
+// Sampling tables of the photon energy for the Seltzer-Berger data of 
+// one element. The data are bilinear in x = k/E and log(E), so for an
+// energy between two nodes of the data the spectrum is a mixture of 
+// the spectra of the two nodes. For each node a majorant of the data,
+// piecewise constant on a uniform grid in log(x) and exact as the data
+// are linear in x between their points, is tabulated together with its 
+// integral and a guide table. The photon energy is obtained by 
+// inversion of the integral of the majorant between the cut and the 
+// maximal energy, in a time not depending on the number of bins, and 
+// accepted with one comparison against the data multiplied by the 
+// dielectric suppression and the positron correction. The sampled 
+// spectrum is the same as for the rejection algorithm of the model.
+
+// -------------------------------------------------------------------
+//
+
+#ifndef G4SBBremSamplingTable_h
+#define G4SBBremSamplingTable_h 1
+
+#include "globals.hh"
+#include "Randomize.hh"
+#include <vector>
+
+class G4Physics2DVector;
+
+class G4SBBremSamplingTable 
+{
+
+public:
+
+  // tables are built for nbins bins in log(x) 
+  G4SBBremSamplingTable(const G4Physics2DVector* data, G4int nbins);
+
+  ~G4SBBremSamplingTable();
+
+  // photon energy between cut and emax for a particle of kinetic energy
+  // kinEnergy: densityCorr is the dielectric suppression factor, alphaZ
+  // is 2*pi*fine_structure_const*Z for positrons and 0 for electrons; 
+  // a negative value is returned if the tables do not cover the cut
+  G4double SampleEnergy(G4double kinEnergy, G4double cut, G4double emax,
+                        G4double densityCorr, G4double alphaZ, 
+                        G4double mass, CLHEP::HepRandomEngine*) const;
+
+  size_t MemoryUsage() const;
+
+private:
+
+  // data of the node iy at x, starting from data bin ix
+  inline G4double Data(G4double x, size_t ix, size_t iy) const;
+
+  // integral of the majorant of the node iy up to log(x) = w
+  inline G4double Integral(size_t iy, G4double w) const;
+
+  // hide assignment operator
+  G4SBBremSamplingTable & operator=(const G4SBBremSamplingTable &right);
+  G4SBBremSamplingTable(const G4SBBremSamplingTable&);
+
+  const G4Physics2DVector* data;
+  G4int  nBins;
+  size_t nX;
+  size_t nY;
+  G4double logXmin;
+  G4double logXmax;
+  G4double invDelta;
+
+  std::vector<G4double> logX;   // nBins+1 bin edges
+  std::vector<size_t>   dataBin;// nBins data bins of the lower edges
+  std::vector<G4double> fMax;   // nBins per node of y
+  std::vector<G4double> cumul;  // nBins+1 per node of y
+  std::vector<G4int>    guide;  // nBins per node of y
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#endif
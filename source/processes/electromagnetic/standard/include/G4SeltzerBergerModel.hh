@@ -46,6 +46,11 @@
 // 2. S.M. Seltzer and M.J. Berger Atomic data and Nuclear Data 
 //    Tables 35 (1986) 345
 // Cross section computation in the base class G4eBremsstrahlungRelModel
+//
+// Optional table sampling of the photon energy (G4EmParameters::
+// SamplingTable): the photon energy is sampled with the tables of
+// G4SBBremSamplingTable built for each element at initialisation; the
+// spectrum is the same as for the default rejection algorithm
 
 // -------------------------------------------------------------------
 //
@@ -55,8 +60,10 @@
 
 #include "G4eBremsstrahlungRelModel.hh"
 #include "globals.hh"
+#include <vector>
 
 class G4Physics2DVector;
+class G4SBBremSamplingTable;
 
 class G4SeltzerBergerModel : public G4eBremsstrahlungRelModel
 {
@@ -80,6 +87,14 @@ public:
 
   inline void SetBicubicInterpolationFlag(G4bool);
 
+  // table sampling of the photon energy is enabled by G4EmParameters
+  // and not used with bicubic interpolation; tables are built for 
+  // elements while the total memory is below the limit (bytes), 
+  // rejection is used otherwise
+  inline void SetTableSamplingMemoryLimit(size_t);
+  inline void SetTableSamplingBins(G4int);
+  static size_t GetTableSamplingMemory();
+
 protected:
 
   virtual G4double ComputeDXSectionPerAtom(G4double gammaEnergy);
@@ -90,6 +105,8 @@ private:
 
   void ReadData(G4int Z, const char* path = 0);
 
+  void BuildSamplingTable(G4int Z);
+
   // hide assignment operator
   G4SeltzerBergerModel & operator=(const  G4SeltzerBergerModel &right);
   G4SeltzerBergerModel(const  G4SeltzerBergerModel&);
@@ -97,10 +114,15 @@ private:
   static G4Physics2DVector* dataSB[101];
   static G4double ylimit[101];
   static G4double expnumlim;
+  static G4SBBremSamplingTable* samplingTable[101];
+  static size_t tableMemory;
   G4int  nwarn;
   size_t idx;
   size_t idy;
   G4bool useBicubicInterpolation;
+  G4bool useTableSampling;
+  size_t tableMemoryLimit;
+  G4int  nTableBins;
 };
 
 inline void G4SeltzerBergerModel::SetBicubicInterpolationFlag(G4bool val)
@@ -108,6 +130,16 @@ inline void G4SeltzerBergerModel::SetBicubicInterpolationFlag(G4bool val)
   useBicubicInterpolation = val;
 }
 
+inline void G4SeltzerBergerModel::SetTableSamplingMemoryLimit(size_t val)
+{
+  tableMemoryLimit = val;
+}
+
+inline void G4SeltzerBergerModel::SetTableSamplingBins(G4int val)
+{
+  nTableBins = std::max(val, 1);
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
 
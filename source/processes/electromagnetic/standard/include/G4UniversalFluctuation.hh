@@ -44,6 +44,8 @@
 // 13-02-03 Add name (V.Ivanchenko)
 // 16-10-03 Changed interface to Initialisation (V.Ivanchenko)
 // 07-02-05 define problim = 5.e-3 (mma)
+// 19-10-26 uniform, Poisson and Gaussian numbers are taken from a buffer
+//          of the thread filled by flatArray (V.Ivanchenko)
 //
 // Class Description:
 //
@@ -58,6 +60,9 @@
 
 #include "G4VEmFluctuationModel.hh"
 #include "G4ParticleDefinition.hh"
+#include "Randomize.hh"
+#include "G4Exp.hh"
+#include "G4Log.hh"
 
 class G4UniversalFluctuation : public G4VEmFluctuationModel
 {
@@ -86,6 +91,19 @@ public:
 
 private:
 
+  // uniform random number from the buffer
+  inline G4double Flat();
+
+  // Gaussian random number with zero mean and unit variance,
+  // Box-Muller method using the buffer
+  inline G4double Gauss();
+
+  // the same algorithm as G4Poisson using the buffer
+  inline G4int SamplePoisson(G4double mean);
+
+  // n uniform random numbers from the buffer
+  void FillFlat(G4int n, G4double* v);
+
   // hide assignment operator
   G4UniversalFluctuation & operator=(const  G4UniversalFluctuation &right);
   G4UniversalFluctuation(const  G4UniversalFluctuation&);
@@ -125,9 +143,74 @@ private:
   G4int     sizearray;
   G4double* rndmarray;
 
+  // buffer of uniform random numbers, filled by flatArray in blocks 
+  // of the size used by MixMaxRng; models are per thread, so is the
+  // buffer. It is emptied at the start of each event, so that an event
+  // depends only on the state of the engine at its start
+  static const G4int nrbuf = 255;
+  G4int     irbuf;
+  G4int     rbufEvent;
+  G4double  rbuf[nrbuf];
+  G4double  gaussSaved;
+  G4bool    hasGauss;
+  CLHEP::HepRandomEngine* rndmEngineF;
+
 };
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+inline G4double G4UniversalFluctuation::Flat()
+{
+  if(irbuf == nrbuf) {
+    rndmEngineF->flatArray(nrbuf, rbuf);
+    irbuf = 0;
+  }
+  return rbuf[irbuf++];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4double G4UniversalFluctuation::Gauss()
+{
+  if(hasGauss) {
+    hasGauss = false;
+    return gaussSaved;
+  }
+  G4double r = std::sqrt(-2.*G4Log(Flat()));
+  G4double phi = CLHEP::twopi*Flat();
+  gaussSaved = r*std::sin(phi);
+  hasGauss = true;
+  return r*std::cos(phi);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+inline G4int G4UniversalFluctuation::SamplePoisson(G4double mean)
+{
+  G4int number = 0;
+  const G4double border = 16.;
+  const G4double limit = 2.e9;
+
+  if(mean <= border) {
+    G4double position = Flat();
+    G4double poissonValue = G4Exp(-mean);
+    G4double poissonSum = poissonValue;
+
+    // Loop checking, 19-Oct-2026, Vladimir Ivanchenko
+    while(poissonSum <= position) {
+      ++number;
+      poissonValue *= mean/number;
+      poissonSum += poissonValue;
+    }
+    return number;
+  }
+
+  G4double value = mean + Gauss()*std::sqrt(mean) + 0.5;
+  if(value < 0.) { return 0; }
+  return (value >= limit) ? G4int(limit) : G4int(value);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 #endif
 
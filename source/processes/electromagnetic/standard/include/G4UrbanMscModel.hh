@@ -42,6 +42,7 @@
 //
 // New parametrization for theta0
 // Correction for very small step length
+// 19.10.26 Optional tables of the moments of the angular distribution
 //
 // Class Description:
 //
@@ -66,6 +67,7 @@
 class G4ParticleChangeForMSC;
 class G4SafetyHelper;
 class G4LossTableManager;
+class G4UrbanMscMoments;
 
 static const G4double c_highland = 13.6*CLHEP::MeV ;
 
@@ -120,6 +122,9 @@ private:
   
   inline G4double SimpleScattering(G4double xmeanth, G4double x2meanth);
 
+  // tables shared by all instances, built at first call
+  static const G4UrbanMscMoments* MomentsTable();
+
   //  hide assignment operator
   G4UrbanMscModel & operator=(const  G4UrbanMscModel &right);
   G4UrbanMscModel(const  G4UrbanMscModel&);
@@ -132,6 +137,7 @@ private:
 
   const G4MaterialCutsCouple* couple;
   G4LossTableManager*         theManager;
+  const G4UrbanMscMoments*    fMoments;
 
   G4double mass;
   G4double charge,ChargeSquare;
@@ -0,0 +1,115 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class header file
+//
+//
+// File name:     G4UrbanMscMoments
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// Class Description:
+//
+// Tables of the functions of tau = t/lambda used for the sampling of
+// the scattering angle in G4UrbanMscModel: the first and the second 
+// moments of cos(theta) of the Goudsmit-Saunderson distribution, 
+// exp(-tau) and (1 + 2*exp(-2.5*tau))/3, and tau^(1/6) entering the 
+// tail parameter. The tables are uniform in log(tau), the values and
+// their exact derivatives are stored per node and interpolated by cubic
+// Hermite polynomials, so log(tau) computed by the model replaces three
+// exponents. The absolute error of the moments is below 2.e-8, the 
+// relative error of tau^(1/6) is below 1.e-10.
+
+// -------------------------------------------------------------------
+//
+
+#ifndef G4UrbanMscMoments_h
+#define G4UrbanMscMoments_h 1
+
+#include "globals.hh"
+#include <vector>
+
+class G4UrbanMscMoments 
+{
+
+public:
+
+  // tables cover tau from taumin to taumax with nbins bins in log(tau)
+  G4UrbanMscMoments(G4double taumin, G4double taumax, G4int nbins);
+
+  ~G4UrbanMscMoments();
+
+  // moments and tau^(1/6) for ltau = log(tau)
+  inline void Moments(G4double ltau, G4double& xmean, G4double& x2mean,
+                      G4double& tau16) const;
+
+  size_t MemoryUsage() const;
+
+private:
+
+  // hide assignment operator
+  G4UrbanMscMoments & operator=(const G4UrbanMscMoments &right);
+  G4UrbanMscMoments(const G4UrbanMscMoments&);
+
+  G4int    nBins;
+  G4double logTauMin;
+  G4double invDelta;
+
+  // per node: xmean, dxmean, x2mean, dx2mean, tau16, dtau16; derivatives
+  // over log(tau) are multiplied by the bin width
+  std::vector<G4double> data;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void 
+G4UrbanMscMoments::Moments(G4double ltau, G4double& xmean, G4double& x2mean,
+                           G4double& tau16) const
+{
+  G4double x = (ltau - logTauMin)*invDelta;
+  G4int i = std::min(std::max(G4int(x), 0), nBins - 1);
+  G4double s = x - i;
+  G4double s2 = s*s;
+  G4double s3 = s*s2;
+  G4double h01 = 3*s2 - 2*s3;
+  G4double h00 = 1.0 - h01;
+  G4double h11 = s3 - s2;
+  G4double h10 = s - s2 + h11;
+  const G4double* p = &data[6*i];
+  xmean  = h00*p[0] + h10*p[1] + h01*p[6]  + h11*p[7];
+  x2mean = h00*p[2] + h10*p[3] + h01*p[8]  + h11*p[9];
+  tau16  = h00*p[4] + h10*p[5] + h01*p[10] + h11*p[11];
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#endif
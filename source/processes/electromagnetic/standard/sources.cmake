@@ -87,11 +87,13 @@ GEANT4_DEFINE_MODULE(NAME G4emstandard
         G4PWATotalXsecTable.hh
         G4PairProductionRelModel.hh
         G4PhotoElectricEffect.hh
+        G4SBBremSamplingTable.hh
         G4SauterGavrilaAngularDistribution.hh
         G4ScreeningMottCrossSection.hh
         G4SeltzerBergerModel.hh
         G4UniversalFluctuation.hh
         G4UrbanMscModel.hh
+        G4UrbanMscMoments.hh
         G4WaterStopping.hh
         G4WentzelOKandVIxSection.hh
         G4WentzelVIModel.hh
@@ -154,11 +156,13 @@ GEANT4_DEFINE_MODULE(NAME G4emstandard
         G4PWATotalXsecTable.cc
         G4PairProductionRelModel.cc
         G4PhotoElectricEffect.cc
+        G4SBBremSamplingTable.cc
         G4SauterGavrilaAngularDistribution.cc
         G4ScreeningMottCrossSection.cc
         G4SeltzerBergerModel.cc
         G4UniversalFluctuation.cc
         G4UrbanMscModel.cc
+        G4UrbanMscMoments.cc
         G4WaterStopping.cc
         G4WentzelOKandVIxSection.cc
         G4WentzelVIModel.cc
@@ -91,6 +91,7 @@ G4BetheHeitlerModel::G4BetheHeitlerModel(const G4ParticleDefinition*,
   thePositron = G4Positron::Positron();
   theElectron = G4Electron::Electron();
   g4pow = G4Pow::GetInstance();
+  SetThreadSafeTables(typeid(G4BetheHeitlerModel));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
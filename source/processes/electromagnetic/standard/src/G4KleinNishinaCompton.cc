@@ -79,6 +79,7 @@ G4KleinNishinaCompton::G4KleinNishinaCompton(const G4ParticleDefinition*,
   theElectron = G4Electron::Electron();
   lowestSecondaryEnergy = 100.0*eV;
   fParticleChange = nullptr;
+  SetThreadSafeTables(typeid(G4KleinNishinaCompton));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -85,6 +85,7 @@ G4MollerBhabhaModel::G4MollerBhabhaModel(const G4ParticleDefinition* p,
   theElectron = G4Electron::Electron();
   if(p) { SetParticle(p); }
   fParticleChange = nullptr;
+  SetThreadSafeTables(typeid(G4MollerBhabhaModel));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
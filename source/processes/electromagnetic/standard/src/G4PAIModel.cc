@@ -69,6 +69,7 @@
 #include "G4ParticleChangeForLoss.hh"
 #include "G4PAIModelData.hh"
 #include "G4DeltaAngle.hh"
+#include "G4EmParameters.hh"
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -121,6 +122,10 @@ void G4PAIModel::Initialise(const G4ParticleDefinition* p,
     G4double tmin = LowEnergyLimit()*fRatio;
     G4double tmax = HighEnergyLimit()*fRatio;
     fModelData = new G4PAIModelData(tmin, tmax, fVerbose);
+    if(!fTableDirectory.empty()) {
+      fModelData->SetFilePrefix(fTableDirectory + "/PAI_" 
+				+ p->GetParticleName());
+    }
   
     // Prepare initialization
     const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
@@ -141,9 +146,13 @@ void G4PAIModel::Initialise(const G4ParticleDefinition* p,
 	     << G4endl;
       G4cout << "           total number of materials " << numOfMat << G4endl;
     } 
+    G4bool report = (fVerbose > 0 || 
+		     G4EmParameters::Instance()->Verbose() > 1);
     for(size_t iReg = 0; iReg<numRegions; ++iReg) {
       const G4Region* curReg = fPAIRegionVector[iReg];
       G4Region* reg = const_cast<G4Region*>(curReg);
+      size_t nCouples = fMaterialCutsCoupleVector.size();
+      G4int nData = fModelData->NumberOfDataSets();
 
       for(size_t jMat = 0; jMat<numOfMat; ++jMat) {
 	G4Material* mat = (*theMaterialTable)[jMat];
@@ -182,6 +191,23 @@ void G4PAIModel::Initialise(const G4ParticleDefinition* p,
 	  }
 	}
       }
+      if(report) {
+	// data sets are shared between regions, memory is counted
+	// for the region where a data set is defined first
+	G4int nNew = fModelData->NumberOfDataSets() - nData;
+	size_t mem = 0;
+	for(G4int i=nData; i<fModelData->NumberOfDataSets(); ++i) {
+	  mem += fModelData->MemoryUsage(i);
+	}
+	G4cout << "G4PAIModel for " << p->GetParticleName() 
+	       << " in region <" << curReg->GetName() << ">: "
+	       << fMaterialCutsCoupleVector.size() - nCouples << " couples, "
+	       << nNew << " new data sets, " 
+	       << fMaterialCutsCoupleVector.size() - nCouples - nNew 
+	       << " shared; memory(kB)= " << mem/1024;
+	if(mem == 0 && nNew > 0) { G4cout << " (tables built on first use)"; }
+	G4cout << G4endl;
+      }
     }
     InitialiseElementSelectors(p, cuts);
   }
@@ -35,6 +35,8 @@
 // Creation date: 16.08.2013
 //
 // Modifications:
+// 19.10.26 Data are shared between couples of the same material and
+//          are built on first use
 //
 
 #include "G4PAIModelData.hh"
@@ -50,12 +52,20 @@
 #include "G4SandiaTable.hh"
 #include "Randomize.hh"
 #include "G4Poisson.hh"
+#include "G4AutoLock.hh"
+#include <fstream>
+
+namespace
+{
+  G4Mutex PAIModelDataMutex = G4MUTEX_INITIALIZER;
+}
 
 ////////////////////////////////////////////////////////////////////////
 
 using namespace std;
 
 G4PAIModelData::G4PAIModelData(G4double tmin, G4double tmax, G4int ver)
+  : fVerbose(ver)
 { 
   const G4int nPerDecade = 10; 
   const G4double lowestTkin = 50*keV;
@@ -108,10 +118,62 @@ G4PAIModelData::~G4PAIModelData()
 
 ///////////////////////////////////////////////////////////////////////////////
 
-void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
-                                G4PAIModel* model)
+G4bool G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
+                                  G4PAIModel* model)
 {
+  // max energy transfers depend only on the particle of the model
+  if(fTransferMax.empty()) {
+    fTransferMax.resize(fTotBin+1, 0.0);
+    for (G4int i = 0; i <= fTotBin; ++i) {
+      fTransferMax[i] = 
+        model->ComputeMaxEnergy(fParticleEnergyVector->Energy(i));
+    }
+  }
+
+  // tables do not depend on cuts: for each energy bin the PAI cross
+  // section is integrated over the full range of energy transfers up
+  // to the max transfer of the particle; the cut enters only when the
+  // tables are used, as the lower limit of the integrals in 
+  // DEDXPerVolume, CrossSectionPerVolume and the sampling, so data 
+  // are shared between couples of the same material
   const G4Material* mat = couple->GetMaterial();     
+  G4int n = fMaterials.size();
+  for(G4int i=0; i<n; ++i) {
+    if(mat == fMaterials[i]) { 
+      fDataIndex.push_back(i);
+      return false; 
+    }
+  }
+  fDataIndex.push_back(n);
+  fMaterials.push_back(mat);
+  fPAIxscBank.push_back(0);
+  fPAIdEdxBank.push_back(0);
+  fdEdxTable.push_back(0);
+  fBuilt.emplace_back(false);
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::BuildData(G4int idx) const
+{
+  G4AutoLock l(&PAIModelDataMutex);
+  if(fBuilt[idx].load(std::memory_order_relaxed)) { return; }
+
+  if(fFilePrefix.empty() || !RetrieveData(idx)) { ComputeData(idx); }
+  fBuilt[idx].store(true, std::memory_order_release);
+
+  if(fVerbose > 0) {
+    G4cout << "### G4PAIModelData: tables for " << fMaterials[idx]->GetName()
+           << " are built, memory(kB)= " << MemoryUsage(idx)/1024 << G4endl;
+  }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::ComputeData(G4int idx) const
+{
+  const G4Material* mat = fMaterials[idx];
   fSandia.Initialize(const_cast<G4Material*>(mat));
 
   G4PhysicsTable* PAItransferTable = new G4PhysicsTable(fTotBin+1);
@@ -129,7 +191,7 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
   for (G4int i = 0; i <= fTotBin; ++i) {
 
     G4double kinEnergy = fParticleEnergyVector->Energy(i);
-    G4double Tmax = model->ComputeMaxEnergy(kinEnergy);
+    G4double Tmax = fTransferMax[i];
     G4double tau = kinEnergy/proton_mass_c2;
     G4double bg2 = tau*( tau + 2. );
 
@@ -187,15 +249,91 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
     //dEdxVector->FillSecondDerivatives();
 
   } // end of Tkin loop`
-  fPAIxscBank.push_back(PAItransferTable);
-  fPAIdEdxBank.push_back(PAIdEdxTable);
+  fPAIxscBank[idx] = PAItransferTable;
+  fPAIdEdxBank[idx] = PAIdEdxTable;
   //G4cout << "dEdxMeanVector: " << G4endl;
   //G4cout << *dEdxMeanVector << G4endl;
   /*
   dEdxMeanVector->SetSpline(true);
   dEdxMeanVector->FillSecondDerivatives();
   */
-  fdEdxTable.push_back(dEdxMeanVector);
+  fdEdxTable[idx] = dEdxMeanVector;
+
+  if(!fFilePrefix.empty()) { StoreData(idx); }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+size_t G4PAIModelData::MemoryUsage(G4int idx) const
+{
+  size_t mem = 0;
+  if(!fBuilt[idx].load(std::memory_order_acquire)) { return mem; }
+  mem += sizeof(G4double)*2*fdEdxTable[idx]->GetVectorLength();
+  for(G4int i=0; i<=fTotBin; ++i) {
+    mem += sizeof(G4double)*2*((*fPAIxscBank[idx])[i]->GetVectorLength() 
+                               + (*fPAIdEdxBank[idx])[i]->GetVectorLength());
+  }
+  return mem;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+G4bool G4PAIModelData::RetrieveData(G4int idx) const
+{
+  const G4String name = fFilePrefix + "_" + fMaterials[idx]->GetName();
+  std::ifstream in((name + "_mean.dat").c_str());
+  if(!in) { return false; }
+
+  // check that energy binning is not changed
+  G4PhysicsLogVector* dEdxMeanVector = new G4PhysicsLogVector();
+  if(!dEdxMeanVector->Retrieve(in, true) || 
+     dEdxMeanVector->GetVectorLength() != 
+     fParticleEnergyVector->GetVectorLength() ||
+     std::abs(dEdxMeanVector->Energy(0)/fLowestKineticEnergy - 1.0) > 1.e-6 ||
+     std::abs(dEdxMeanVector->GetMaxEnergy()/fHighestKineticEnergy - 1.0) 
+     > 1.e-6) { 
+    delete dEdxMeanVector;
+    return false;
+  }
+  G4PhysicsTable* PAItransferTable = new G4PhysicsTable();
+  G4PhysicsTable* PAIdEdxTable = new G4PhysicsTable();
+  if(!PAItransferTable->RetrievePhysicsTable(name + "_xsc.dat", true) ||
+     !PAIdEdxTable->RetrievePhysicsTable(name + "_dedx.dat", true) ||
+     PAItransferTable->length() != size_t(fTotBin+1) ||
+     PAIdEdxTable->length() != size_t(fTotBin+1)) {
+    PAItransferTable->clearAndDestroy();
+    delete PAItransferTable;
+    PAIdEdxTable->clearAndDestroy();
+    delete PAIdEdxTable;
+    delete dEdxMeanVector;
+    return false;
+  }
+  fPAIxscBank[idx] = PAItransferTable;
+  fPAIdEdxBank[idx] = PAIdEdxTable;
+  fdEdxTable[idx] = dEdxMeanVector;
+  if(fVerbose > 0) {
+    G4cout << "### G4PAIModelData: tables for " << fMaterials[idx]->GetName()
+           << " are retrieved from " << name << "_*.dat" << G4endl;
+  }
+  return true;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIModelData::StoreData(G4int idx) const
+{
+  const G4String name = fFilePrefix + "_" + fMaterials[idx]->GetName();
+  std::ofstream out((name + "_mean.dat").c_str());
+  G4bool res = out && fdEdxTable[idx]->Store(out, true);
+  out.close();
+  res = res && fPAIxscBank[idx]->StorePhysicsTable(name + "_xsc.dat", true)
+    && fPAIdEdxBank[idx]->StorePhysicsTable(name + "_dedx.dat", true);
+  if(!res) {
+    G4ExceptionDescription ed;
+    ed << "Fail to store PAI tables for " << fMaterials[idx]->GetName()
+       << " in files " << name << "_*.dat";
+    G4Exception("G4PAIModelData::StoreData()","em0003",JustWarning,ed,"");
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////
@@ -203,12 +341,13 @@ void G4PAIModelData::Initialise(const G4MaterialCutsCouple* couple,
 G4double G4PAIModelData::DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const
 {
+  G4int idx = DataIndex(coupleIndex);
   // VI: iPlace is the low edge index of the bin
   // iPlace is in interval from 0 to (N-1)
   size_t iPlace = fParticleEnergyVector->FindBin(scaledTkin, 0);
   size_t nPlace = fParticleEnergyVector->GetVectorLength() - 1;
   /*
-  G4cout << "G4PAIModelData::DEDXPerVolume: coupleIdx= " << coupleIndex
+  G4cout << "G4PAIModelData::DEDXPerVolume: coupleIdx= " << idx
 	 << " Tscaled= " << scaledTkin << " cut= " << cut 
 	 << " iPlace= " << iPlace << " nPlace= " << nPlace << G4endl;
   */
@@ -219,11 +358,11 @@ G4double G4PAIModelData::DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
   }
 
   // VI: apply interpolation of the vector
-  G4double dEdx = fdEdxTable[coupleIndex]->Value(scaledTkin);
-  G4double del  = (*(fPAIdEdxBank[coupleIndex]))(iPlace)->Value(cut);
+  G4double dEdx = fdEdxTable[idx]->Value(scaledTkin);
+  G4double del  = (*(fPAIdEdxBank[idx]))(iPlace)->Value(cut);
   //G4cout << "dEdx= " << dEdx << " del= " << del << G4endl;
   if(!one) {
-    G4double del2 = (*(fPAIdEdxBank[coupleIndex]))(iPlace+1)->Value(cut);
+    G4double del2 = (*(fPAIdEdxBank[idx]))(iPlace+1)->Value(cut);
     G4double E1 = fParticleEnergyVector->Energy(iPlace); 
     G4double E2 = fParticleEnergyVector->Energy(iPlace+1);
     G4double W  = 1.0/(E2 - E1);
@@ -246,6 +385,7 @@ G4PAIModelData::CrossSectionPerVolume(G4int coupleIndex,
 				      G4double scaledTkin,
 				      G4double tcut, G4double tmax) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double cross, cross1, cross2;
 
   // iPlace is in interval from 0 to (N-1)
@@ -257,7 +397,7 @@ G4PAIModelData::CrossSectionPerVolume(G4int coupleIndex,
   else if(scaledTkin > fParticleEnergyVector->Energy(0)) { 
     one = false; 
   }
-  G4PhysicsTable* table = fPAIxscBank[coupleIndex];
+  G4PhysicsTable* table = fPAIxscBank[idx];
 
   //G4cout<<"iPlace = "<<iPlace<<"; tmax = "
   // <<tmax<<"; cutEnergy = "<<cutEnergy<<G4endl;  
@@ -292,6 +432,7 @@ G4double G4PAIModelData::SampleAlongStepTransfer(G4int coupleIndex,
 						 G4double tmax,
 						 G4double stepFactor) const
 {
+  G4int idx = DataIndex(coupleIndex);
   //G4cout << "=== G4PAIModelData::SampleAlongStepTransfer" << G4endl;
   G4double loss = 0.0;
 
@@ -310,7 +451,7 @@ G4double G4PAIModelData::SampleAlongStepTransfer(G4int coupleIndex,
   G4double meanN21 = 0.0;
   G4double meanN22 = 0.0;
 
-  G4PhysicsVector* v1 = (*(fPAIxscBank[coupleIndex]))(iPlace);
+  G4PhysicsVector* v1 = (*(fPAIxscBank[idx]))(iPlace);
   G4PhysicsVector* v2 = 0;
 
   G4double e1 = v1->Energy(0);
@@ -327,7 +468,7 @@ G4double G4PAIModelData::SampleAlongStepTransfer(G4int coupleIndex,
   G4double W1 = 1.0;
   G4double W2 = 0.0;
   if(!one) {
-    v2 = (*(fPAIxscBank[coupleIndex]))(iPlace+1);
+    v2 = (*(fPAIxscBank[idx]))(iPlace+1);
 
     e1 = v2->Energy(0);
     e2 = std::min(tmax, v2->GetMaxEnergy());
@@ -355,11 +496,11 @@ G4double G4PAIModelData::SampleAlongStepTransfer(G4int coupleIndex,
   for(G4int i=0; i< numOfCollisions; ++i) {
     G4double rand = G4UniformRand();
     position = meanN12 + (meanN11 - meanN12)*rand;
-    omega = GetEnergyTransfer(coupleIndex, iPlace, position);
+    omega = GetEnergyTransfer(idx, iPlace, position);
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
     if(!one) {
       position = meanN22 + (meanN21 - meanN22)*rand;
-      omega2 = GetEnergyTransfer(coupleIndex, iPlace+1, position);
+      omega2 = GetEnergyTransfer(idx, iPlace+1, position);
       omega *= W1;
       omega += omega2*W2;
     }
@@ -385,7 +526,8 @@ G4double G4PAIModelData::SamplePostStepTransfer(G4int coupleIndex,
 						G4double tmin,
 						G4double tmax) const
 {  
-  //G4cout<<"=== G4PAIModelData::SamplePostStepTransfer idx= "<< coupleIndex 
+  G4int idx = DataIndex(coupleIndex);
+  //G4cout<<"=== G4PAIModelData::SamplePostStepTransfer idx= "<< idx 
   //	<< " Tkin= " << scaledTkin << "  Tmax= " << tmax << G4endl;
   G4double transfer = 0.0;
   G4double rand = G4UniformRand();
@@ -398,7 +540,7 @@ G4double G4PAIModelData::SamplePostStepTransfer(G4int coupleIndex,
   else if(scaledTkin > fParticleEnergyVector->Energy(0)) { 
     one = false; 
   }
-  G4PhysicsTable* table = fPAIxscBank[coupleIndex];
+  G4PhysicsTable* table = fPAIxscBank[idx];
   G4PhysicsVector* v1 = (*table)[iPlace];
 
   G4double emin = std::max(tmin, v1->Energy(0));
@@ -414,7 +556,7 @@ G4double G4PAIModelData::SamplePostStepTransfer(G4int coupleIndex,
 	 << " one: " << one << G4endl;
   */
   G4double position = dNdx2 + (dNdx1 - dNdx2)*rand;
-  transfer = GetEnergyTransfer(coupleIndex, iPlace, position);
+  transfer = GetEnergyTransfer(idx, iPlace, position);
 
   //G4cout<<"PAImodel PostStepTransfer = "<<transfer/keV<<" keV"
   //	<< " position= " << position << G4endl; 
@@ -441,7 +583,7 @@ G4double G4PAIModelData::SamplePostStepTransfer(G4int coupleIndex,
       //    << " W1= " << W1 << " W2= " << W2 <<G4endl;
     
       position = dNdx2 + (dNdx1 - dNdx2)*rand;
-      G4double tr2 = GetEnergyTransfer(coupleIndex, iPlace+1, position);
+      G4double tr2 = GetEnergyTransfer(idx, iPlace+1, position);
 
       //G4cout<<"PAImodel PostStepTransfer1 = "<<tr2/keV<<" keV"
       //    << " position= " << position << G4endl; 
@@ -460,11 +602,11 @@ G4double G4PAIModelData::SamplePostStepTransfer(G4int coupleIndex,
 // Returns PAI energy transfer according to passed 
 // indexes of particle kinetic enegry and random x-section
 
-G4double G4PAIModelData::GetEnergyTransfer(G4int coupleIndex, 
+G4double G4PAIModelData::GetEnergyTransfer(G4int idx, 
 					   size_t iPlace, 
 					   G4double position) const
 { 
-  G4PhysicsVector* v = (*(fPAIxscBank[coupleIndex]))(iPlace); 
+  G4PhysicsVector* v = (*(fPAIxscBank[idx]))(iPlace); 
   if(position*v->Energy(0) >= (*v)[0]) { return v->Energy(0); }
 
   size_t iTransferMax = v->GetVectorLength() - 1;
@@ -35,6 +35,8 @@
 // Creation date: 07.10.2013
 //
 // Modifications:
+// 19.10.26 Data are shared between couples with the same material and
+//          cuts and are built on first use; optional persistency
 //
 
 #include "G4PAIPhotData.hh"
@@ -51,12 +53,22 @@
 #include "G4SandiaTable.hh"
 #include "Randomize.hh"
 #include "G4Poisson.hh"
+#include "G4AutoLock.hh"
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+
+namespace
+{
+  G4Mutex PAIPhotDataMutex = G4MUTEX_INITIALIZER;
+}
 
 ////////////////////////////////////////////////////////////////////////
 
 using namespace std;
 
 G4PAIPhotData::G4PAIPhotData(G4double tmin, G4double tmax, G4int ver)
+  : fVerbose(ver)
 { 
   const G4int nPerDecade     = 10; 
   const G4double lowestTkin  = 50*keV;
@@ -105,6 +117,18 @@ G4PAIPhotData::~G4PAIPhotData()
 	delete fPAIxscBank[i];
 	fPAIxscBank[i] = 0;
       }
+      if(fPAIphotonBank[i]) 
+      {
+	fPAIphotonBank[i]->clearAndDestroy();
+	delete fPAIphotonBank[i];
+	fPAIphotonBank[i] = 0;
+      }
+      if(fPAIplasmonBank[i]) 
+      {
+	fPAIplasmonBank[i]->clearAndDestroy();
+	delete fPAIplasmonBank[i];
+	fPAIplasmonBank[i] = 0;
+      }
       if(fPAIdEdxBank[i]) 
       {
 	fPAIdEdxBank[i]->clearAndDestroy();
@@ -113,8 +137,14 @@ G4PAIPhotData::~G4PAIPhotData()
       }
       delete fdEdxTable[i];
       delete fdNdxCutTable[i];
+      delete fdNdxCutPhotonTable[i];
+      delete fdNdxCutPlasmonTable[i];
+      delete fdEdxCutTable[i];
       fdEdxTable[i] = 0;
       fdNdxCutTable[i] = 0;
+      fdNdxCutPhotonTable[i] = 0;
+      fdNdxCutPlasmonTable[i] = 0;
+      fdEdxCutTable[i] = 0;
     }
   }
   delete fParticleEnergyVector;
@@ -149,6 +179,65 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 
   // if( deltaCutInKineticEnergyNow != cut ) deltaCutInKineticEnergyNow = cut; // exception??
 
+  // max energy transfers depend only on the particle of the model
+  if(fTransferMax.empty()) {
+    fTransferMax.resize(fTotBin+1, 0.0);
+    for (G4int i = 0; i <= fTotBin; ++i) {
+      fTransferMax[i] = 
+        model->ComputeMaxEnergy(fParticleEnergyVector->Energy(i));
+    }
+  }
+
+  // tables depend on material and cuts only, the dN/dx and dE/dx
+  // above the cuts are tabulated, so couples share a data set only
+  // if material and all cuts are the same
+  const G4Material* mat = couple->GetMaterial();     
+  size_t nData = fMaterials.size();
+  for(size_t i=0; i<nData; ++i) {
+    if(mat == fMaterials[i] && cut == fCuts[3*i] && 
+       deltaCutInKineticEnergyNow == fCuts[3*i+1] &&
+       photonCutInKineticEnergyNow == fCuts[3*i+2]) {
+      fDataIndex.push_back(i);
+      return;
+    }
+  }
+  fDataIndex.push_back(nData);
+  fMaterials.push_back(mat);
+  fCuts.push_back(cut);
+  fCuts.push_back(deltaCutInKineticEnergyNow);
+  fCuts.push_back(photonCutInKineticEnergyNow);
+
+  fPAIxscBank.push_back(0);
+  fPAIphotonBank.push_back(0);
+  fPAIplasmonBank.push_back(0);
+  fPAIdEdxBank.push_back(0);
+  fdEdxTable.push_back(0);
+  fdNdxCutTable.push_back(0);
+  fdNdxCutPhotonTable.push_back(0);
+  fdNdxCutPlasmonTable.push_back(0);
+  fdEdxCutTable.push_back(0);
+  fBuilt.emplace_back(false);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIPhotData::BuildData(G4int idx) const
+{
+  G4AutoLock l(&PAIPhotDataMutex);
+  if(fBuilt[idx].load(std::memory_order_relaxed)) { return; }
+
+  if(fFilePrefix.empty() || !RetrieveData(idx)) { ComputeData(idx); }
+  fBuilt[idx].store(true, std::memory_order_release);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+void G4PAIPhotData::ComputeData(G4int idx) const
+{
+  G4double cut = fCuts[3*idx];
+  G4double deltaCutInKineticEnergyNow = fCuts[3*idx+1];
+  G4double photonCutInKineticEnergyNow = fCuts[3*idx+2];
+
   G4PhysicsLogVector* dEdxCutVector =
     new G4PhysicsLogVector(fLowestKineticEnergy,
 			   fHighestKineticEnergy,
@@ -167,7 +256,7 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 			   fHighestKineticEnergy,
 			   fTotBin);
 
-  const G4Material* mat = couple->GetMaterial();     
+  const G4Material* mat = fMaterials[idx];
   fSandia.Initialize(const_cast<G4Material*>(mat));
 
   G4PhysicsTable* PAItransferTable = new G4PhysicsTable(fTotBin+1);
@@ -189,7 +278,7 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
   for (G4int i = 0; i <= fTotBin; ++i) 
   {
     G4double kinEnergy = fParticleEnergyVector->Energy(i);
-    G4double Tmax = model->ComputeMaxEnergy(kinEnergy);
+    G4double Tmax = fTransferMax[i];
     G4double tau = kinEnergy/proton_mass_c2;
     G4double bg2 = tau*( tau + 2. );
 
@@ -253,25 +342,116 @@ void G4PAIPhotData::Initialise(const G4MaterialCutsCouple* couple,
 
   } // end of Tkin loop
 
-  fPAIxscBank.push_back(PAItransferTable);
-  fPAIphotonBank.push_back(PAIphotonTable);
-  fPAIplasmonBank.push_back(PAIplasmonTable);
+  fPAIxscBank[idx] = PAItransferTable;
+  fPAIphotonBank[idx] = PAIphotonTable;
+  fPAIplasmonBank[idx] = PAIplasmonTable;
+
+  fPAIdEdxBank[idx] = PAIdEdxTable;
+  fdEdxTable[idx] = dEdxMeanVector;
+
+  fdNdxCutTable[idx] = dNdxCutVector;
+  fdNdxCutPhotonTable[idx] = dNdxCutPhotonVector;
+  fdNdxCutPlasmonTable[idx] = dNdxCutPlasmonVector;
+
+  fdEdxCutTable[idx] = dEdxCutVector;
+
+  if(!fFilePrefix.empty()) { StoreData(idx); }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+
+G4String G4PAIPhotData::FileName(G4int idx) const
+{
+  // cuts are part of the name, as data sets depend on them
+  std::ostringstream os;
+  os << std::setprecision(8) << fFilePrefix << "_" 
+     << fMaterials[idx]->GetName() << "_" << fCuts[3*idx]/keV << "_" 
+     << fCuts[3*idx+1]/keV << "_" << fCuts[3*idx+2]/keV << "keV";
+  return G4String(os.str());
+}
+
+///////////////////////////////////////////////////////////////////////////////
 
-  fPAIdEdxBank.push_back(PAIdEdxTable);
-  fdEdxTable.push_back(dEdxMeanVector);
+G4bool G4PAIPhotData::RetrieveData(G4int idx) const
+{
+  const G4String name = FileName(idx);
+  std::ifstream in((name + "_mean.dat").c_str());
+  if(!in) { return false; }
+
+  // mean dE/dx and the vectors above the cuts, the energy binning 
+  // should not be changed
+  G4PhysicsLogVector* v[5];
+  G4bool ok = true;
+  for(G4int j=0; j<5; ++j) {
+    v[j] = new G4PhysicsLogVector();
+    ok = ok && v[j]->Retrieve(in, true) &&
+      v[j]->GetVectorLength() == fParticleEnergyVector->GetVectorLength() &&
+      std::abs(v[j]->Energy(0)/fLowestKineticEnergy - 1.0) < 1.e-6 &&
+      std::abs(v[j]->GetMaxEnergy()/fHighestKineticEnergy - 1.0) < 1.e-6;
+  }
+  G4PhysicsTable* tables[4];
+  const G4String suffix[4] = {"_xsc.dat", "_photon.dat", "_plasmon.dat",
+                              "_dedx.dat"};
+  for(G4int j=0; j<4; ++j) {
+    tables[j] = new G4PhysicsTable();
+    ok = ok && tables[j]->RetrievePhysicsTable(name + suffix[j], true) &&
+      tables[j]->length() == size_t(fTotBin+1);
+  }
+  if(!ok) {
+    for(G4int j=0; j<5; ++j) { delete v[j]; }
+    for(G4int j=0; j<4; ++j) { 
+      tables[j]->clearAndDestroy(); 
+      delete tables[j];
+    }
+    return false;
+  }
+  fdEdxTable[idx] = v[0];
+  fdNdxCutTable[idx] = v[1];
+  fdNdxCutPhotonTable[idx] = v[2];
+  fdNdxCutPlasmonTable[idx] = v[3];
+  fdEdxCutTable[idx] = v[4];
+
+  fPAIxscBank[idx] = tables[0];
+  fPAIphotonBank[idx] = tables[1];
+  fPAIplasmonBank[idx] = tables[2];
+  fPAIdEdxBank[idx] = tables[3];
+  if(fVerbose > 0) {
+    G4cout << "### G4PAIPhotData: tables for " << fMaterials[idx]->GetName()
+           << " are retrieved from " << name << "_*.dat" << G4endl;
+  }
+  return true;
+}
 
-  fdNdxCutTable.push_back(dNdxCutVector);
-  fdNdxCutPhotonTable.push_back(dNdxCutPhotonVector);
-  fdNdxCutPlasmonTable.push_back(dNdxCutPlasmonVector);
+///////////////////////////////////////////////////////////////////////////////
 
-  fdEdxCutTable.push_back(dEdxCutVector);
+void G4PAIPhotData::StoreData(G4int idx) const
+{
+  const G4String name = FileName(idx);
+  std::ofstream out((name + "_mean.dat").c_str());
+  G4bool res = out && fdEdxTable[idx]->Store(out, true)
+    && fdNdxCutTable[idx]->Store(out, true)
+    && fdNdxCutPhotonTable[idx]->Store(out, true)
+    && fdNdxCutPlasmonTable[idx]->Store(out, true)
+    && fdEdxCutTable[idx]->Store(out, true);
+  out.close();
+  res = res && fPAIxscBank[idx]->StorePhysicsTable(name + "_xsc.dat", true)
+    && fPAIphotonBank[idx]->StorePhysicsTable(name + "_photon.dat", true)
+    && fPAIplasmonBank[idx]->StorePhysicsTable(name + "_plasmon.dat", true)
+    && fPAIdEdxBank[idx]->StorePhysicsTable(name + "_dedx.dat", true);
+  if(!res) {
+    G4ExceptionDescription ed;
+    ed << "Fail to store PAI tables for " << fMaterials[idx]->GetName()
+       << " in files " << name << "_*.dat";
+    G4Exception("G4PAIPhotData::StoreData()","em0003",JustWarning,ed,"");
+  }
 }
 
-//////////////////////////////////////////////////////////////////////////////
+//////
 
 G4double G4PAIPhotData::DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
 			 G4double cut) const
 {
+  G4int idx = DataIndex(coupleIndex);
   // VI: iPlace is the low edge index of the bin
   // iPlace is in interval from 0 to (N-1)
   size_t iPlace = fParticleEnergyVector->FindBin(scaledTkin, 0);
@@ -284,10 +464,10 @@ G4double G4PAIPhotData::DEDXPerVolume(G4int coupleIndex, G4double scaledTkin,
   }
 
   // VI: apply interpolation of the vector
-  G4double dEdx = fdEdxTable[coupleIndex]->Value(scaledTkin);
-  G4double del  = (*(fPAIdEdxBank[coupleIndex]))(iPlace)->Value(cut);
+  G4double dEdx = fdEdxTable[idx]->Value(scaledTkin);
+  G4double del  = (*(fPAIdEdxBank[idx]))(iPlace)->Value(cut);
   if(!one) {
-    G4double del2 = (*(fPAIdEdxBank[coupleIndex]))(iPlace+1)->Value(cut);
+    G4double del2 = (*(fPAIdEdxBank[idx]))(iPlace+1)->Value(cut);
     G4double E1 = fParticleEnergyVector->Energy(iPlace); 
     G4double E2 = fParticleEnergyVector->Energy(iPlace+1);
     G4double W  = 1.0/(E2 - E1);
@@ -309,6 +489,7 @@ G4PAIPhotData::CrossSectionPerVolume(G4int coupleIndex,
 				      G4double scaledTkin,
 				      G4double tcut, G4double tmax) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double cross, xscEl, xscEl2, xscPh, xscPh2;
 
   cross=tcut+tmax;
@@ -324,8 +505,8 @@ G4PAIPhotData::CrossSectionPerVolume(G4int coupleIndex,
   else if( scaledTkin > fParticleEnergyVector->Energy(0)      )   one   = false; 
   
 
-  xscEl2 = (*fdNdxCutPlasmonTable[coupleIndex])(iPlace);
-  xscPh2 = (*fdNdxCutPhotonTable[coupleIndex])(iPlace);
+  xscEl2 = (*fdNdxCutPlasmonTable[idx])(iPlace);
+  xscPh2 = (*fdNdxCutPhotonTable[idx])(iPlace);
 
   xscPh = xscPh2;
   xscEl = xscEl2;
@@ -334,7 +515,7 @@ G4PAIPhotData::CrossSectionPerVolume(G4int coupleIndex,
  
   if( !one ) 
   {
-    xscEl2 = (*fdNdxCutPlasmonTable[coupleIndex])(iPlace+1);
+    xscEl2 = (*fdNdxCutPlasmonTable[idx])(iPlace+1);
 
     G4double E1 = fParticleEnergyVector->Energy(iPlace); 
     G4double E2 = fParticleEnergyVector->Energy(iPlace+1);
@@ -346,7 +527,7 @@ G4PAIPhotData::CrossSectionPerVolume(G4int coupleIndex,
     xscEl *= W1;
     xscEl += W2*xscEl2;
 
-    xscPh2 = (*fdNdxCutPhotonTable[coupleIndex])(iPlace+1);
+    xscPh2 = (*fdNdxCutPhotonTable[idx])(iPlace+1);
 
     E1 = fParticleEnergyVector->Energy(iPlace); 
     E2 = fParticleEnergyVector->Energy(iPlace+1);
@@ -370,6 +551,7 @@ G4PAIPhotData::CrossSectionPerVolume(G4int coupleIndex,
 G4double 
 G4PAIPhotData::GetPlasmonRatio(G4int coupleIndex, G4double scaledTkin) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double cross, xscEl, xscEl2, xscPh, xscPh2, plRatio;
   // iPlace is in interval from 0 to (N-1)
 
@@ -382,8 +564,8 @@ G4PAIPhotData::GetPlasmonRatio(G4int coupleIndex, G4double scaledTkin) const
   else if( scaledTkin > fParticleEnergyVector->Energy(0)      )   one   = false; 
   
 
-  xscEl2 = (*fdNdxCutPlasmonTable[coupleIndex])(iPlace);
-  xscPh2 = (*fdNdxCutPhotonTable[coupleIndex])(iPlace);
+  xscEl2 = (*fdNdxCutPlasmonTable[idx])(iPlace);
+  xscPh2 = (*fdNdxCutPhotonTable[idx])(iPlace);
 
   xscPh = xscPh2;
   xscEl = xscEl2;
@@ -392,7 +574,7 @@ G4PAIPhotData::GetPlasmonRatio(G4int coupleIndex, G4double scaledTkin) const
  
   if( !one ) 
   {
-    xscEl2 = (*fdNdxCutPlasmonTable[coupleIndex])(iPlace+1);
+    xscEl2 = (*fdNdxCutPlasmonTable[idx])(iPlace+1);
 
     G4double E1 = fParticleEnergyVector->Energy(iPlace); 
     G4double E2 = fParticleEnergyVector->Energy(iPlace+1);
@@ -404,7 +586,7 @@ G4PAIPhotData::GetPlasmonRatio(G4int coupleIndex, G4double scaledTkin) const
     xscEl *= W1;
     xscEl += W2*xscEl2;
 
-    xscPh2 = (*fdNdxCutPhotonTable[coupleIndex])(iPlace+1);
+    xscPh2 = (*fdNdxCutPhotonTable[idx])(iPlace+1);
 
     E1 = fParticleEnergyVector->Energy(iPlace); 
     E2 = fParticleEnergyVector->Energy(iPlace+1);
@@ -438,6 +620,7 @@ G4double G4PAIPhotData::SampleAlongStepTransfer(G4int coupleIndex,
 						 G4double scaledTkin,
 						 G4double stepFactor) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double loss = 0.0;
   G4double omega; 
   G4double position, E1, E2, W1, W2, W, dNdxCut1, dNdxCut2, meanNumber;
@@ -450,8 +633,8 @@ G4double G4PAIPhotData::SampleAlongStepTransfer(G4int coupleIndex,
   if     (scaledTkin >= fParticleEnergyVector->Energy(nPlace)) iPlace = nPlace; 
   else if(scaledTkin > fParticleEnergyVector->Energy(0))          one = false; 
 
-  G4PhysicsLogVector* vcut = fdNdxCutTable[coupleIndex];
-  G4PhysicsVector*      v1 = (*(fPAIxscBank[coupleIndex]))(iPlace);
+  G4PhysicsLogVector* vcut = fdNdxCutTable[idx];
+  G4PhysicsVector*      v1 = (*(fPAIxscBank[idx]))(iPlace);
   G4PhysicsVector*      v2 = 0;
 
   dNdxCut1    = (*vcut)[iPlace];
@@ -470,7 +653,7 @@ G4double G4PAIPhotData::SampleAlongStepTransfer(G4int coupleIndex,
   W2 = 0.0;
   if(!one) 
   {
-    v2 = (*(fPAIxscBank[coupleIndex]))(iPlace+1);
+    v2 = (*(fPAIxscBank[idx]))(iPlace+1);
     dNdxCut2 = (*vcut)[iPlace+1];
     e2 = v2->Energy(0);
 
@@ -498,14 +681,14 @@ G4double G4PAIPhotData::SampleAlongStepTransfer(G4int coupleIndex,
   {
     G4double rand = G4UniformRand();
     position = dNdxCut1 + ((*v1)[0]/e1 - dNdxCut1)*rand;
-    omega = GetEnergyTransfer(coupleIndex, iPlace, position);
+    omega = GetEnergyTransfer(idx, iPlace, position);
 
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
 
     if(!one) 
     {
       position = dNdxCut2 + ((*v2)[0]/e2 - dNdxCut2)*rand;
-      G4double omega2 = GetEnergyTransfer(coupleIndex, iPlace+1, position);
+      G4double omega2 = GetEnergyTransfer(idx, iPlace+1, position);
       omega = omega*W1 + omega2*W2;
     }
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
@@ -530,6 +713,7 @@ G4double G4PAIPhotData::SampleAlongStepPhotonTransfer(G4int coupleIndex,
 						 G4double scaledTkin,
 						 G4double stepFactor) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double loss = 0.0;
   G4double omega; 
   G4double position, E1, E2, W1, W2, W, dNdxCut1, dNdxCut2, meanNumber;
@@ -542,8 +726,8 @@ G4double G4PAIPhotData::SampleAlongStepPhotonTransfer(G4int coupleIndex,
   if     (scaledTkin >= fParticleEnergyVector->Energy(nPlace)) iPlace = nPlace; 
   else if(scaledTkin > fParticleEnergyVector->Energy(0))          one = false; 
 
-  G4PhysicsLogVector* vcut = fdNdxCutPhotonTable[coupleIndex];
-  G4PhysicsVector*      v1 = (*(fPAIphotonBank[coupleIndex]))(iPlace);
+  G4PhysicsLogVector* vcut = fdNdxCutPhotonTable[idx];
+  G4PhysicsVector*      v1 = (*(fPAIphotonBank[idx]))(iPlace);
   G4PhysicsVector*      v2 = 0;
 
   dNdxCut1    = (*vcut)[iPlace];
@@ -562,7 +746,7 @@ G4double G4PAIPhotData::SampleAlongStepPhotonTransfer(G4int coupleIndex,
   W2 = 0.0;
   if(!one) 
   {
-    v2 = (*(fPAIphotonBank[coupleIndex]))(iPlace+1);
+    v2 = (*(fPAIphotonBank[idx]))(iPlace+1);
     dNdxCut2 = (*vcut)[iPlace+1];
     e2 = v2->Energy(0);
 
@@ -590,14 +774,14 @@ G4double G4PAIPhotData::SampleAlongStepPhotonTransfer(G4int coupleIndex,
   {
     G4double rand = G4UniformRand();
     position = dNdxCut1 + ((*v1)[0]/e1 - dNdxCut1)*rand;
-    omega = GetEnergyPhotonTransfer(coupleIndex, iPlace, position);
+    omega = GetEnergyPhotonTransfer(idx, iPlace, position);
 
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
 
     if(!one) 
     {
       position = dNdxCut2 + ((*v2)[0]/e2 - dNdxCut2)*rand;
-      G4double omega2 = GetEnergyPhotonTransfer(coupleIndex, iPlace+1, position);
+      G4double omega2 = GetEnergyPhotonTransfer(idx, iPlace+1, position);
       omega = omega*W1 + omega2*W2;
     }
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
@@ -622,6 +806,7 @@ G4double G4PAIPhotData::SampleAlongStepPlasmonTransfer(G4int coupleIndex,
 						 G4double scaledTkin,
 						 G4double stepFactor) const
 {
+  G4int idx = DataIndex(coupleIndex);
   G4double loss = 0.0;
   G4double omega; 
   G4double position, E1, E2, W1, W2, W, dNdxCut1, dNdxCut2, meanNumber;
@@ -634,8 +819,8 @@ G4double G4PAIPhotData::SampleAlongStepPlasmonTransfer(G4int coupleIndex,
   if     (scaledTkin >= fParticleEnergyVector->Energy(nPlace)) iPlace = nPlace; 
   else if(scaledTkin > fParticleEnergyVector->Energy(0))          one = false; 
 
-  G4PhysicsLogVector* vcut = fdNdxCutPlasmonTable[coupleIndex];
-  G4PhysicsVector*      v1 = (*(fPAIplasmonBank[coupleIndex]))(iPlace);
+  G4PhysicsLogVector* vcut = fdNdxCutPlasmonTable[idx];
+  G4PhysicsVector*      v1 = (*(fPAIplasmonBank[idx]))(iPlace);
   G4PhysicsVector*      v2 = 0;
 
   dNdxCut1    = (*vcut)[iPlace];
@@ -654,7 +839,7 @@ G4double G4PAIPhotData::SampleAlongStepPlasmonTransfer(G4int coupleIndex,
   W2 = 0.0;
   if(!one) 
   {
-    v2 = (*(fPAIplasmonBank[coupleIndex]))(iPlace+1);
+    v2 = (*(fPAIplasmonBank[idx]))(iPlace+1);
     dNdxCut2 = (*vcut)[iPlace+1];
     e2 = v2->Energy(0);
 
@@ -682,14 +867,14 @@ G4double G4PAIPhotData::SampleAlongStepPlasmonTransfer(G4int coupleIndex,
   {
     G4double rand = G4UniformRand();
     position = dNdxCut1 + ((*v1)[0]/e1 - dNdxCut1)*rand;
-    omega = GetEnergyPlasmonTransfer(coupleIndex, iPlace, position);
+    omega = GetEnergyPlasmonTransfer(idx, iPlace, position);
 
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
 
     if(!one) 
     {
       position = dNdxCut2 + ((*v2)[0]/e2 - dNdxCut2)*rand;
-      G4double omega2 = GetEnergyPlasmonTransfer(coupleIndex, iPlace+1, position);
+      G4double omega2 = GetEnergyPlasmonTransfer(idx, iPlace+1, position);
       omega = omega*W1 + omega2*W2;
     }
     //G4cout << "omega(keV)= " << omega/keV << G4endl;
@@ -715,6 +900,7 @@ G4double G4PAIPhotData::SampleAlongStepPlasmonTransfer(G4int coupleIndex,
 G4double G4PAIPhotData::SamplePostStepTransfer(G4int coupleIndex, 
 						G4double scaledTkin) const
 {  
+  G4int idx = DataIndex(coupleIndex);
   //G4cout<<"G4PAIPhotData::GetPostStepTransfer"<<G4endl;
   G4double transfer = 0.0;
   G4double rand = G4UniformRand();
@@ -724,18 +910,18 @@ G4double G4PAIPhotData::SamplePostStepTransfer(G4int coupleIndex,
   //  size_t iTransfer, iTr1, iTr2;
   G4double position, dNdxCut1, dNdxCut2, E1, E2, W1, W2, W;
 
-  G4PhysicsVector* cutv = fdNdxCutTable[coupleIndex];
+  G4PhysicsVector* cutv = fdNdxCutTable[idx];
 
   // Fermi plato, try from left
   if( scaledTkin >= fParticleEnergyVector->GetMaxEnergy()) 
   {
     position = (*cutv)[nPlace]*rand;
-    transfer = GetEnergyTransfer(coupleIndex, nPlace, position);
+    transfer = GetEnergyTransfer(idx, nPlace, position);
   }
   else if( scaledTkin <= fParticleEnergyVector->Energy(0) )
   {
     position = (*cutv)[0]*rand;
-    transfer = GetEnergyTransfer(coupleIndex, 0, position);
+    transfer = GetEnergyTransfer(idx, 0, position);
   }
   else 
   {  
@@ -754,10 +940,10 @@ G4double G4PAIPhotData::SamplePostStepTransfer(G4int coupleIndex,
     //	  <<" dNdxCut2 = "<<dNdxCut2<< " W1= " << W1 << " W2= " << W2 <<G4endl;
 
     position = dNdxCut1*rand;
-    G4double tr1 = GetEnergyTransfer(coupleIndex, iPlace, position);
+    G4double tr1 = GetEnergyTransfer(idx, iPlace, position);
 
     position = dNdxCut2*rand;
-    G4double tr2 = GetEnergyTransfer(coupleIndex, iPlace+1, position);
+    G4double tr2 = GetEnergyTransfer(idx, iPlace+1, position);
 
     transfer = tr1*W1 + tr2*W2;
   }
@@ -771,6 +957,7 @@ G4double G4PAIPhotData::SamplePostStepTransfer(G4int coupleIndex,
 G4double G4PAIPhotData::SamplePostStepPhotonTransfer(G4int coupleIndex, 
 						G4double scaledTkin) const
 {  
+  G4int idx = DataIndex(coupleIndex);
   //G4cout<<"G4PAIPhotData::GetPostStepTransfer"<<G4endl;
   G4double transfer = 0.0;
   G4double rand = G4UniformRand();
@@ -780,19 +967,19 @@ G4double G4PAIPhotData::SamplePostStepPhotonTransfer(G4int coupleIndex,
   //  size_t iTransfer, iTr1, iTr2;
   G4double position, dNdxCut1, dNdxCut2, E1, E2, W1, W2, W;
 
-  G4PhysicsVector* cutv = fdNdxCutPhotonTable[coupleIndex];
+  G4PhysicsVector* cutv = fdNdxCutPhotonTable[idx];
 
   // Fermi plato, try from left
 
   if( scaledTkin >= fParticleEnergyVector->GetMaxEnergy()) 
   {
     position = (*cutv)[nPlace]*rand;
-    transfer = GetEnergyPhotonTransfer(coupleIndex, nPlace, position);
+    transfer = GetEnergyPhotonTransfer(idx, nPlace, position);
   }
   else if( scaledTkin <= fParticleEnergyVector->Energy(0) )
   {
     position = (*cutv)[0]*rand;
-    transfer = GetEnergyPhotonTransfer(coupleIndex, 0, position);
+    transfer = GetEnergyPhotonTransfer(idx, 0, position);
   }
   else 
   {  
@@ -812,10 +999,10 @@ G4double G4PAIPhotData::SamplePostStepPhotonTransfer(G4int coupleIndex,
 
     position = dNdxCut1*rand;
 
-    G4double tr1 = GetEnergyPhotonTransfer(coupleIndex, iPlace, position);
+    G4double tr1 = GetEnergyPhotonTransfer(idx, iPlace, position);
 
     position = dNdxCut2*rand;
-    G4double tr2 = GetEnergyPhotonTransfer(coupleIndex, iPlace+1, position);
+    G4double tr2 = GetEnergyPhotonTransfer(idx, iPlace+1, position);
 
     transfer = tr1*W1 + tr2*W2;
   }
@@ -829,6 +1016,7 @@ G4double G4PAIPhotData::SamplePostStepPhotonTransfer(G4int coupleIndex,
 G4double G4PAIPhotData::SamplePostStepPlasmonTransfer(G4int coupleIndex, 
 						G4double scaledTkin) const
 {  
+  G4int idx = DataIndex(coupleIndex);
   //G4cout<<"G4PAIPhotData::GetPostStepTransfer"<<G4endl;
   G4double transfer = 0.0;
   G4double rand = G4UniformRand();
@@ -838,18 +1026,18 @@ G4double G4PAIPhotData::SamplePostStepPlasmonTransfer(G4int coupleIndex,
   //  size_t iTransfer, iTr1, iTr2;
   G4double position, dNdxCut1, dNdxCut2, E1, E2, W1, W2, W;
 
-  G4PhysicsVector* cutv = fdNdxCutPlasmonTable[coupleIndex];
+  G4PhysicsVector* cutv = fdNdxCutPlasmonTable[idx];
 
   // Fermi plato, try from left
   if( scaledTkin >= fParticleEnergyVector->GetMaxEnergy()) 
   {
     position = (*cutv)[nPlace]*rand;
-    transfer = GetEnergyPlasmonTransfer(coupleIndex, nPlace, position);
+    transfer = GetEnergyPlasmonTransfer(idx, nPlace, position);
   }
   else if( scaledTkin <= fParticleEnergyVector->Energy(0) )
   {
     position = (*cutv)[0]*rand;
-    transfer = GetEnergyPlasmonTransfer(coupleIndex, 0, position);
+    transfer = GetEnergyPlasmonTransfer(idx, 0, position);
   }
   else 
   {  
@@ -868,10 +1056,10 @@ G4double G4PAIPhotData::SamplePostStepPlasmonTransfer(G4int coupleIndex,
     //	  <<" dNdxCut2 = "<<dNdxCut2<< " W1= " << W1 << " W2= " << W2 <<G4endl;
 
     position = dNdxCut1*rand;
-    G4double tr1 = GetEnergyPlasmonTransfer(coupleIndex, iPlace, position);
+    G4double tr1 = GetEnergyPlasmonTransfer(idx, iPlace, position);
 
     position = dNdxCut2*rand;
-    G4double tr2 = GetEnergyPlasmonTransfer(coupleIndex, iPlace+1, position);
+    G4double tr2 = GetEnergyPlasmonTransfer(idx, iPlace+1, position);
 
     transfer = tr1*W1 + tr2*W2;
   }
@@ -887,11 +1075,11 @@ G4double G4PAIPhotData::SamplePostStepPlasmonTransfer(G4int coupleIndex,
 // Returns PAI energy transfer according to passed 
 // indexes of particle kinetic enegry and random x-section
 
-G4double G4PAIPhotData::GetEnergyTransfer(G4int coupleIndex, 
+G4double G4PAIPhotData::GetEnergyTransfer(G4int idx, 
 					   size_t iPlace, 
 					   G4double position) const
 { 
-  G4PhysicsVector* v = (*(fPAIxscBank[coupleIndex]))(iPlace); 
+  G4PhysicsVector* v = (*(fPAIxscBank[idx]))(iPlace); 
   if(position*v->Energy(0) >= (*v)[0]) { return v->Energy(0); }
 
   size_t iTransferMax = v->GetVectorLength() - 1;
@@ -938,11 +1126,11 @@ G4double G4PAIPhotData::GetEnergyTransfer(G4int coupleIndex,
 
 /////////////////////////////////////////////////////////////////
 
-G4double G4PAIPhotData::GetEnergyPhotonTransfer(G4int coupleIndex, 
+G4double G4PAIPhotData::GetEnergyPhotonTransfer(G4int idx, 
 					   size_t iPlace, 
 					   G4double position) const
 { 
-  G4PhysicsVector* v = (*(fPAIphotonBank[coupleIndex]))(iPlace); 
+  G4PhysicsVector* v = (*(fPAIphotonBank[idx]))(iPlace); 
   if(position*v->Energy(0) >= (*v)[0])  return v->Energy(0); 
 
   size_t iTransferMax = v->GetVectorLength() - 1;
@@ -999,11 +1187,11 @@ G4double G4PAIPhotData::GetEnergyPhotonTransfer(G4int coupleIndex,
 
 /////////////////////////////////////////////////////////////////////////
 
-G4double G4PAIPhotData::GetEnergyPlasmonTransfer(G4int coupleIndex, 
+G4double G4PAIPhotData::GetEnergyPlasmonTransfer(G4int idx, 
 					   size_t iPlace, 
 					   G4double position) const
 { 
-  G4PhysicsVector* v = (*(fPAIplasmonBank[coupleIndex]))(iPlace); 
+  G4PhysicsVector* v = (*(fPAIplasmonBank[idx]))(iPlace); 
 
   if( position*v->Energy(0) >= (*v)[0] )  return v->Energy(0); 
 
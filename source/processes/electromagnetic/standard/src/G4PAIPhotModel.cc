@@ -35,7 +35,7 @@
 // Creation date: 07.10.2013
 //
 // Modifications:
-//
+// 19.10.26 Tables are built on first use and optionally stored in files
 //
 
 #include "G4PAIPhotModel.hh"
@@ -119,6 +119,10 @@ void G4PAIPhotModel::Initialise(const G4ParticleDefinition* p,
     G4double tmin = LowEnergyLimit()*fRatio;
     G4double tmax = HighEnergyLimit()*fRatio;
     fModelData = new G4PAIPhotData(tmin, tmax, fVerbose);
+    if(!fTableDirectory.empty()) {
+      fModelData->SetFilePrefix(fTableDirectory + "/PAIPhot_" 
+				+ p->GetParticleName());
+    }
     
     // Prepare initialization
     const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
@@ -77,6 +77,7 @@ G4PEEffectFluoModel::G4PEEffectFluoModel(const G4String& nam)
 
   // default generator
   SetAngularDistribution(new G4SauterGavrilaAngularDistribution());
+  SetThreadSafeTables(typeid(G4PEEffectFluoModel));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
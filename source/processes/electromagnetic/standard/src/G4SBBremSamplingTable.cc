@@ -0,0 +1,224 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4SBBremSamplingTable
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// -------------------------------------------------------------------
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#include "G4SBBremSamplingTable.hh"
+#include "G4Physics2DVector.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Log.hh"
+#include "G4Exp.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+static const G4double expnumlim = -12.;
+static const G4int ncountmax = 100;
+
+G4SBBremSamplingTable::G4SBBremSamplingTable(const G4Physics2DVector* v,
+                                             G4int nbins)
+  : data(v), nBins(std::max(nbins, 1)), 
+    nX(v->GetLengthX()), nY(v->GetLengthY())
+{
+  logXmin = G4Log(data->GetX(0));
+  logXmax = G4Log(data->GetX(nX - 1));
+  G4double delta = (logXmax - logXmin)/G4double(nBins);
+  invDelta = 1.0/delta;
+
+  // bin edges and data bins of their lower edges
+  logX.resize(nBins + 1);
+  std::vector<G4double> x(nBins + 1);
+  for(G4int b=0; b<=nBins; ++b) { 
+    logX[b] = logXmin + b*delta; 
+    x[b] = G4Exp(logX[b]);
+  }
+  logX[nBins] = logXmax;
+  x[0] = data->GetX(0);
+  x[nBins] = data->GetX(nX - 1);
+
+  dataBin.resize(nBins);
+  size_t ix = 0;
+  for(G4int b=0; b<nBins; ++b) {
+    while(ix + 2 < nX && data->GetX(ix + 1) <= x[b]) { ++ix; }
+    dataBin[b] = ix;
+  }
+
+  // the data are linear in x between their points, so the maximum in a
+  // bin is at its edges or at one of the points inside
+  static const G4double margin = 1.0 + 1.e-9;
+  fMax.resize(nY*nBins);
+  cumul.resize(nY*(nBins + 1));
+  guide.resize(nY*nBins);
+  for(size_t iy=0; iy<nY; ++iy) {
+    G4double* fm = &fMax[iy*nBins];
+    G4double* cu = &cumul[iy*(nBins + 1)];
+    cu[0] = 0.0;
+    for(G4int b=0; b<nBins; ++b) {
+      G4double f = std::max(Data(x[b], dataBin[b], iy), 
+                            Data(x[b+1], dataBin[b], iy));
+      for(size_t j=dataBin[b]+1; j<nX && data->GetX(j) < x[b+1]; ++j) {
+        f = std::max(f, data->GetValue(j, iy));
+      }
+      fm[b] = margin*f;
+      cu[b+1] = cu[b] + fm[b]*(logX[b+1] - logX[b]);
+    }
+
+    // first bin for each of nBins equal parts of the integral
+    G4int* gd = &guide[iy*nBins];
+    G4double step = cu[nBins]/G4double(nBins);
+    G4int b = 0;
+    for(G4int i=0; i<nBins; ++i) {
+      while(b < nBins - 1 && cu[b+1] <= i*step) { ++b; }
+      gd[i] = b;
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4SBBremSamplingTable::~G4SBBremSamplingTable()
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4double 
+G4SBBremSamplingTable::Data(G4double x, size_t ix, size_t iy) const
+{
+  while(ix + 2 < nX && x > data->GetX(ix + 1)) { ++ix; }
+  G4double x1 = data->GetX(ix);
+  G4double v1 = data->GetValue(ix, iy);
+  return v1 + (data->GetValue(ix + 1, iy) - v1)*(x - x1)
+    /(data->GetX(ix + 1) - x1);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4double 
+G4SBBremSamplingTable::Integral(size_t iy, G4double w) const
+{
+  G4int b = std::min(std::max(G4int((w - logXmin)*invDelta), 0), nBins - 1);
+  return cumul[iy*(nBins + 1) + b] + fMax[iy*nBins + b]*(w - logX[b]);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double 
+G4SBBremSamplingTable::SampleEnergy(G4double kinEnergy, G4double cut, 
+                                    G4double emax, G4double densityCorr, 
+                                    G4double alphaZ, G4double mass,
+                                    CLHEP::HepRandomEngine* rndmEngine) const
+{
+  G4double wmin = G4Log(cut/kinEnergy);
+  G4double wmax = (emax < kinEnergy) 
+    ? std::min(G4Log(emax/kinEnergy), logXmax) : logXmax;
+  if(wmin < logXmin || wmax <= wmin) { return -1.0; }
+
+  // nodes of the data around the energy and their weights; the data
+  // are constant outside the nodes
+  G4double y = G4Log(kinEnergy/MeV);
+  size_t iy = 0;
+  G4double a = 0.0;
+  if(y >= data->GetY(nY - 1)) {
+    iy = nY - 2;
+    a  = 1.0;
+  } else if(y > data->GetY(0)) {
+    iy = data->FindBinLocationY(y, 0);
+    a  = (y - data->GetY(iy))/(data->GetY(iy + 1) - data->GetY(iy));
+  }
+
+  // integrals of the majorants of the two nodes between cut and emax
+  G4double c1[2], mj[2];
+  for(size_t k=0; k<2; ++k) {
+    c1[k] = Integral(iy + k, wmin);
+    mj[k] = Integral(iy + k, wmax) - c1[k];
+  }
+  G4double p0 = (1.0 - a)*mj[0];
+  G4double ptot = p0 + a*mj[1];
+  if(ptot <= 0.0) { return -1.0; }
+
+  G4double invbeta1 = 0.0;
+  if(alphaZ > 0.0) {
+    G4double e1 = kinEnergy - cut;
+    invbeta1 = (e1 + mass)/std::sqrt(e1*(e1 + 2*mass));
+  }
+
+  G4double rndm[3];
+  G4double gammaEnergy = cut;
+  for(G4int nn=0; nn<ncountmax; ++nn) {
+    rndmEngine->flatArray(3, rndm);
+
+    // node of the mixture, then inversion of the integral of its majorant
+    size_t k = (rndm[0]*ptot < p0) ? 0 : 1;
+    size_t jy = iy + k;
+    const G4double* cu = &cumul[jy*(nBins + 1)];
+    const G4double* fm = &fMax[jy*nBins];
+    G4double u = c1[k] + rndm[1]*mj[k];
+    G4int b = guide[jy*nBins + std::min(G4int(u*nBins/cu[nBins]), nBins - 1)];
+    while(b < nBins - 1 && cu[b+1] <= u) { ++b; }
+    G4double w = (fm[b] > 0.0) ? logX[b] + (u - cu[b])/fm[b] : logX[b];
+    w = std::min(std::max(w, wmin), wmax);
+    G4double x = G4Exp(w);
+    gammaEnergy = x*kinEnergy;
+
+    // data, dielectric suppression and correction for positrons
+    G4double val = Data(x, dataBin[b], jy);
+    G4double k2 = gammaEnergy*gammaEnergy;
+    val *= k2/(k2 + densityCorr);
+    if(alphaZ > 0.0) {
+      G4double e2 = kinEnergy - gammaEnergy;
+      G4double invbeta2 = (e2 + mass)/std::sqrt(e2*(e2 + 2*mass));
+      G4double xxx = alphaZ*(invbeta1 - invbeta2);
+      val = (xxx < expnumlim) ? 0.0 : val*G4Exp(xxx);
+    }
+    if(val >= fm[b]*rndm[2]) { break; }
+  }
+  return gammaEnergy;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+size_t G4SBBremSamplingTable::MemoryUsage() const
+{
+  return sizeof(G4SBBremSamplingTable) 
+    + sizeof(G4double)*(logX.capacity() + fMax.capacity() + cumul.capacity())
+    + sizeof(size_t)*dataBin.capacity() + sizeof(G4int)*guide.capacity();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -40,6 +40,8 @@
 //
 // Modifications:
 //
+// 19.10.26 Added optional table sampling of the photon energy
+//
 // -------------------------------------------------------------------
 //
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -58,14 +60,17 @@
 #include "G4ProductionCutsTable.hh"
 #include "G4ParticleChangeForLoss.hh"
 #include "G4ModifiedTsai.hh"
+#include "G4EmParameters.hh"
 
 #include "G4Physics2DVector.hh"
+#include "G4SBBremSamplingTable.hh"
 #include "G4Exp.hh"
 #include "G4Log.hh"
 
 #include "G4ios.hh"
 #include <fstream>
 #include <iomanip>
+#include <algorithm>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -74,15 +79,19 @@ using namespace std;
 G4Physics2DVector* G4SeltzerBergerModel::dataSB[] = {nullptr};
 G4double G4SeltzerBergerModel::ylimit[] = {0.0};
 G4double G4SeltzerBergerModel::expnumlim = -12.;
+G4SBBremSamplingTable* G4SeltzerBergerModel::samplingTable[] = {nullptr};
+size_t G4SeltzerBergerModel::tableMemory = 0;
 
 static const G4double emaxlog = 4*G4Log(10.);
 static const G4double alpha = CLHEP::twopi*CLHEP::fine_structure_const; 
 static const G4double epeaklimit= 300*CLHEP::MeV; 
 static const G4double elowlimit = 20*CLHEP::keV; 
+static const G4int ncountmax = 100;
 
 G4SeltzerBergerModel::G4SeltzerBergerModel(const G4ParticleDefinition* p,
                                            const G4String& nam)
-  : G4eBremsstrahlungRelModel(p,nam),useBicubicInterpolation(false)
+  : G4eBremsstrahlungRelModel(p,nam),useBicubicInterpolation(false),
+    useTableSampling(false),tableMemoryLimit(100*1024*1024),nTableBins(512)
 {
   SetLowestKinEnergy(1.0*keV);
   SetLowEnergyLimit(LowestKinEnergy());
@@ -101,7 +110,12 @@ G4SeltzerBergerModel::~G4SeltzerBergerModel()
         delete dataSB[i]; 
         dataSB[i] = nullptr;
       } 
+      if(samplingTable[i]) {
+        delete samplingTable[i];
+        samplingTable[i] = nullptr;
+      }
     }
+    tableMemory = 0;
   }
 }
 
@@ -110,6 +124,8 @@ G4SeltzerBergerModel::~G4SeltzerBergerModel()
 void G4SeltzerBergerModel::Initialise(const G4ParticleDefinition* p,
                                       const G4DataVector& cuts)
 {
+  useTableSampling = G4EmParameters::Instance()->SamplingTable();
+
   // Access to elements
   if(IsMaster()) {
 
@@ -127,6 +143,7 @@ void G4SeltzerBergerModel::Initialise(const G4ParticleDefinition* p,
         //G4cout << "Z= " << Z << G4endl;
         // Initialisation
         if(nullptr == dataSB[Z]) { ReadData(Z, path); }
+        if(useTableSampling) { BuildSamplingTable(Z); }
       }
     }
   }
@@ -190,6 +207,33 @@ void G4SeltzerBergerModel::ReadData(G4int Z, const char* path)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+void G4SeltzerBergerModel::BuildSamplingTable(G4int Z)
+{
+  // the majorant is exact only for bilinear interpolation of data
+  if(samplingTable[Z] || !dataSB[Z] || useBicubicInterpolation) { return; }
+  const G4Physics2DVector* v = dataSB[Z];
+  if(v->GetLengthX() < 2 || v->GetLengthY() < 2 || v->GetX(0) <= 0.0) { 
+    return; 
+  }
+  G4SBBremSamplingTable* t = new G4SBBremSamplingTable(v, nTableBins);
+  size_t mem = t->MemoryUsage();
+  if(tableMemory + mem > tableMemoryLimit) { 
+    delete t;
+    return; 
+  }
+  samplingTable[Z] = t;
+  tableMemory += mem;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+size_t G4SeltzerBergerModel::GetTableSamplingMemory()
+{
+  return tableMemory;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4double G4SeltzerBergerModel::ComputeDXSectionPerAtom(G4double gammaEnergy)
 {
 
@@ -260,69 +304,82 @@ G4SeltzerBergerModel::SampleSecondaries(std::vector<G4DynamicParticle*>* vdp,
          << " Z= " << Z << " cut(MeV)= " << cut/MeV 
          << " emax(MeV)= " << emax/MeV << " corr= " << densityCorr << G4endl;
   */
-  G4double xmin = G4Log(cut*cut + densityCorr);
-  G4double xmax = G4Log(emax*emax  + densityCorr);
   G4double y = G4Log(kineticEnergy/MeV);
 
-  G4double gammaEnergy, v; 
-
-  // majoranta
-  G4double x0 = cut/kineticEnergy;
-  G4double vmax = dataSB[Z]->Value(x0, y, idx, idy)*1.02;
-  //  G4double invbeta1 = 0;
-
-  // majoranta corrected for e-
-  if(isElectron && x0 < 0.97 && 
-     ((kineticEnergy > epeaklimit) || (kineticEnergy < elowlimit))) {
-    G4double ylim = std::min(ylimit[Z],1.1*dataSB[Z]->Value(0.97,y,idx,idy));
-    if(ylim > vmax) { vmax = ylim; }
+  G4double gammaEnergy = -1.0;
+  if(useTableSampling && samplingTable[Z]) {
+    G4double alphaZ = isElectron ? 0.0 : alpha*currentZ;
+    gammaEnergy = samplingTable[Z]->SampleEnergy(kineticEnergy, cut, emax, 
+                                                 densityCorr, alphaZ, 
+                                                 particleMass,
+                                                 G4Random::getTheEngine());
   }
-  if(x0 < 0.05) { vmax *= 1.2; }
-
-  //G4cout<<"y= "<<y<<" xmin= "<<xmin<<" xmax= "<<xmax
-  //<<" vmax= "<<vmax<<G4endl;
-  static const G4int ncountmax = 100;
-  CLHEP::HepRandomEngine* rndmEngine = G4Random::getTheEngine();
-  G4double rndm[2];
-
-  for(G4int nn=0; nn<ncountmax; ++nn) {
-    rndmEngine->flatArray(2, rndm);
-    G4double x = G4Exp(xmin + rndm[0]*(xmax - xmin)) - densityCorr;
-    if(x < 0.0) { x = 0.0; }
-    gammaEnergy = sqrt(x);
-    G4double x1 = gammaEnergy/kineticEnergy;
-    v = dataSB[Z]->Value(x1, y, idx, idy);
-
-    // correction for positrons        
-    if(!isElectron) {
-      G4double e1 = kineticEnergy - cut;
-      G4double invbeta1 = (e1 + particleMass)/sqrt(e1*(e1 + 2*particleMass));
-      G4double e2 = kineticEnergy - gammaEnergy;
-      G4double invbeta2 = (e2 + particleMass)/sqrt(e2*(e2 + 2*particleMass));
-      G4double xxx = twopi*fine_structure_const*currentZ*(invbeta1 - invbeta2);
-
-      if(xxx < expnumlim) { v = 0.0; }
-      else { v *= G4Exp(xxx); }
+  if(gammaEnergy < 0.0) {
+    G4double xmin = G4Log(cut*cut + densityCorr);
+    G4double xmax = G4Log(emax*emax  + densityCorr);
+    G4double v; 
+
+    // majoranta
+    G4double x0 = cut/kineticEnergy;
+    G4double vmax = dataSB[Z]->Value(x0, y, idx, idy)*1.02;
+    //  G4double invbeta1 = 0;
+
+    // majoranta corrected for e-
+    if(isElectron && x0 < 0.97 && 
+       ((kineticEnergy > epeaklimit) || (kineticEnergy < elowlimit))) {
+      G4double ylim = 
+        std::min(ylimit[Z],1.1*dataSB[Z]->Value(0.97,y,idx,idy));
+      if(ylim > vmax) { vmax = ylim; }
     }
+    if(x0 < 0.05) { vmax *= 1.2; }
+
+    //G4cout<<"y= "<<y<<" xmin= "<<xmin<<" xmax= "<<xmax
+    //<<" vmax= "<<vmax<<G4endl;
+    CLHEP::HepRandomEngine* rndmEngine = G4Random::getTheEngine();
+    G4double rndm[2];
+
+    for(G4int nn=0; nn<ncountmax; ++nn) {
+      rndmEngine->flatArray(2, rndm);
+      G4double x = G4Exp(xmin + rndm[0]*(xmax - xmin)) - densityCorr;
+      if(x < 0.0) { x = 0.0; }
+      gammaEnergy = sqrt(x);
+      G4double x1 = gammaEnergy/kineticEnergy;
+      v = dataSB[Z]->Value(x1, y, idx, idy);
+
+      // correction for positrons        
+      if(!isElectron) {
+        G4double e1 = kineticEnergy - cut;
+        G4double invbeta1 = 
+          (e1 + particleMass)/sqrt(e1*(e1 + 2*particleMass));
+        G4double e2 = kineticEnergy - gammaEnergy;
+        G4double invbeta2 = 
+          (e2 + particleMass)/sqrt(e2*(e2 + 2*particleMass));
+        G4double xxx = 
+          twopi*fine_structure_const*currentZ*(invbeta1 - invbeta2);
+
+        if(xxx < expnumlim) { v = 0.0; }
+        else { v *= G4Exp(xxx); }
+      }
    
-    if (v > 1.05*vmax && nwarn < 5) {
-      ++nwarn;
-      G4ExceptionDescription ed;
-      ed << "### G4SeltzerBergerModel Warning: Majoranta exceeded! "
-         << v << " > " << vmax << " by " << v/vmax
-         << " Niter= " << nn 
-         << " Egamma(MeV)= " << gammaEnergy
-         << " Ee(MeV)= " << kineticEnergy
-         << " Z= " << Z << "  " << particle->GetParticleName();
+      if (v > 1.05*vmax && nwarn < 5) {
+        ++nwarn;
+        G4ExceptionDescription ed;
+        ed << "### G4SeltzerBergerModel Warning: Majoranta exceeded! "
+           << v << " > " << vmax << " by " << v/vmax
+           << " Niter= " << nn 
+           << " Egamma(MeV)= " << gammaEnergy
+           << " Ee(MeV)= " << kineticEnergy
+           << " Z= " << Z << "  " << particle->GetParticleName();
      
-      if ( 20 == nwarn ) {
-        ed << "\n ### G4SeltzerBergerModel Warnings stopped";
-      }
-      G4Exception("G4SeltzerBergerModel::SampleScattering","em0044",
-                  JustWarning, ed,"");
+        if ( 20 == nwarn ) {
+          ed << "\n ### G4SeltzerBergerModel Warnings stopped";
+        }
+        G4Exception("G4SeltzerBergerModel::SampleScattering","em0044",
+                    JustWarning, ed,"");
 
+      }
+      if(v >= vmax*rndm[1]) { break; }
     }
-    if(v >= vmax*rndm[1]) { break; }
   }
 
   //
@@ -378,6 +435,7 @@ void G4SeltzerBergerModel::InitialiseForElement(const G4ParticleDefinition*,
   G4AutoLock l(&SeltzerBergerModelMutex);
   // G4cout << "G4SeltzerBergerModel::InitialiseForElement Z= " << Z << G4endl;
   if(nullptr == dataSB[Z]) { ReadData(Z); }
+  if(useTableSampling) { BuildSamplingTable(Z); }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -61,6 +61,9 @@
 // 08-08-10 width correction algorithm has bee modified -->
 //          better results for thin targets (L.Urban)
 // 06-02-11 correction for very small losses (L.Urban)
+// 19-10-26 uniform, Poisson and Gaussian numbers are taken from a buffer
+//          filled by flatArray, vectorisable loop for the sum of 
+//          ionisation losses (V.Ivanchenko)
 //
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -70,7 +73,6 @@
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
-#include "G4Poisson.hh"
 #include "G4Step.hh"
 #include "G4Material.hh"
 #include "G4MaterialCutsCouple.hh"
@@ -78,6 +80,30 @@
 #include "G4ParticleDefinition.hh"
 #include "G4Log.hh"
 #include "G4Exp.hh"
+#include "G4VStateDependent.hh"
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+namespace
+{
+  // number of events started in this thread, the buffer of random 
+  // numbers is emptied when it changes
+  G4ThreadLocal G4int nStartedEvents = 0;
+
+  class G4UniversalFluctuationNotifier : public G4VStateDependent
+  {
+  public:
+    G4UniversalFluctuationNotifier() : G4VStateDependent() {}
+    virtual G4bool Notify(G4ApplicationState requestedState)
+    {
+      if(G4State_EventProc == requestedState) { ++nStartedEvents; }
+      return true;
+    }
+  };
+
+  // owned by the state manager of the thread
+  G4ThreadLocal G4UniversalFluctuationNotifier* notifier = 0;
+}
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
@@ -101,6 +127,12 @@ G4UniversalFluctuation::G4UniversalFluctuation(const G4String& nam)
   m_Inv_particleMass = m_massrate = DBL_MAX;
   sizearray = 30;
   rndmarray = new G4double[30];
+  irbuf = nrbuf;
+  rbufEvent = -1;
+  gaussSaved = 0.0;
+  hasGauss = false;
+  rndmEngineF = 0;
+  if(!notifier) { notifier = new G4UniversalFluctuationNotifier(); }
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -148,7 +180,13 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
 
   if(dp->GetDefinition() != particle) { InitialiseMe(dp->GetDefinition()); }
 
-  CLHEP::HepRandomEngine* rndmEngineF = G4Random::getTheEngine();
+  CLHEP::HepRandomEngine* engine = G4Random::getTheEngine();
+  if(engine != rndmEngineF || rbufEvent != nStartedEvents) {
+    rndmEngineF = engine;
+    rbufEvent = nStartedEvents;
+    irbuf = nrbuf;
+    hasGauss = false;
+  }
   
   G4double tau   = tkin * m_Inv_particleMass;            
   G4double gam   = tau + 1.0;
@@ -181,7 +219,7 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
 
         G4double twomeanLoss = meanLoss + meanLoss;
         do {
-          loss = G4RandGauss::shoot(rndmEngineF,meanLoss,siga);
+          loss = meanLoss + siga*Gauss();
           // Loop checking, 03-Aug-2015, Vladimir Ivanchenko
         } while  (0.0 > loss || twomeanLoss < loss);
 
@@ -219,7 +257,7 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
   G4int    nstep = 1;
   if(meanLoss < 25.*ipotFluct)
     {
-      if(rndmEngineF->flat()*ipotFluct< 0.04*meanLoss)          
+      if(Flat()*ipotFluct< 0.04*meanLoss)          
         { nstep = 1; }
       else
         { 
@@ -246,7 +284,7 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
         if(a1 < nmaxCont) { 
           //small energy loss
           G4double sa1 = sqrt(a1);
-          if(rndmEngineF->flat() < G4Exp(-sa1))
+          if(Flat() < G4Exp(-sa1))
             {
               e1 = esmall;
               a1 = meanLoss*(1.-rate)/e1;
@@ -290,10 +328,10 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
       }
     else if(a1 > 0.)
       {
-        p1 = G4double(G4Poisson(a1));
+        p1 = G4double(SamplePoisson(a1));
         loss += p1*e1;
         if(p1 > 0.) {
-          loss += (1.-2.*rndmEngineF->flat())*e1;
+          loss += (1.-2.*Flat())*e1;
         }
       }
 
@@ -305,15 +343,15 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
       }
     else if(a2 > 0.)
       {
-        p2 = G4double(G4Poisson(a2));
+        p2 = G4double(SamplePoisson(a2));
         loss += p2*e2;
         if(p2 > 0.) 
-          loss += (1.-2.*rndmEngineF->flat())*e2;
+          loss += (1.-2.*Flat())*e2;
       }
     if(emean > 0.)
       {
         sige   = sqrt(sig2e);
-        loss += max(0.,G4RandGauss::shoot(rndmEngineF,emean,sige));
+        loss += max(0.,emean + sige*Gauss());
       }
 
     // ionisation 
@@ -336,21 +374,24 @@ G4UniversalFluctuation::SampleFluctuations(const G4MaterialCutsCouple* couple,
 
       G4double w2 = alfa*e0;
       G4double w  = (tmax-w2)/tmax;
-      const G4int nb = G4Poisson(p3);
+      const G4int nb = SamplePoisson(p3);
       if(nb > 0) {
         if(nb > sizearray) {
           sizearray = nb;
           delete [] rndmarray;
           rndmarray = new G4double[nb];
         }
-        rndmEngineF->flatArray(nb, rndmarray);
-        for (G4int k=0; k<nb; ++k) { lossc += w2/(1.-w*rndmarray[k]); }
+        FillFlat(nb, rndmarray);
+        // the transformation is vectorisable, the sum is done 
+        // in the same order as before
+        for (G4int k=0; k<nb; ++k) { rndmarray[k] = w2/(1.-w*rndmarray[k]); }
+        for (G4int k=0; k<nb; ++k) { lossc += rndmarray[k]; }
       }
 
     if(emean > 0.)
       {
         sige   = sqrt(sig2e);
-        lossc += max(0.,G4RandGauss::shoot(rndmEngineF,emean,sige));
+        lossc += max(0.,emean + sige*Gauss());
       }
     }
 
@@ -409,3 +450,21 @@ G4UniversalFluctuation::SetParticleAndCharge(const G4ParticleDefinition* part,
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
+void G4UniversalFluctuation::FillFlat(G4int n, G4double* v)
+{
+  G4int i = 0;
+  // Loop checking: at least one number is taken at each iteration
+  while(i < n) {
+    if(irbuf == nrbuf) {
+      rndmEngineF->flatArray(nrbuf, rbuf);
+      irbuf = 0;
+    }
+    G4int nn = std::min(n - i, nrbuf - irbuf);
+    for(G4int k=0; k<nn; ++k) { v[i + k] = rbuf[irbuf + k]; }
+    i += nn;
+    irbuf += nn;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -57,6 +57,8 @@
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
 #include "G4UrbanMscModel.hh"
+#include "G4UrbanMscMoments.hh"
+#include "G4EmParameters.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
@@ -176,6 +178,7 @@ G4UrbanMscModel::G4UrbanMscModel(const G4String& nam)
   currentMaterialIndex = -1;
   fParticleChange = 0;
   couple = 0;
+  fMoments = nullptr;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
@@ -185,6 +188,17 @@ G4UrbanMscModel::~G4UrbanMscModel()
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
 
+const G4UrbanMscMoments* G4UrbanMscModel::MomentsTable()
+{
+  // tables do not depend on material and particle, the range of tau 
+  // covers the values used in SampleCosineTheta; the instance is 
+  // created once by the first calling thread and deleted at exit
+  static const G4UrbanMscMoments moments(1.e-16, 8.0, 800);
+  return &moments;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo......
+
 void G4UrbanMscModel::Initialise(const G4ParticleDefinition* p,
                                  const G4DataVector&)
 {
@@ -202,6 +216,11 @@ void G4UrbanMscModel::Initialise(const G4ParticleDefinition* p,
 
   latDisplasmentbackup = latDisplasment;
 
+  fMoments = nullptr;
+  if(G4EmParameters::Instance()->MscMomentsTable()) { 
+    fMoments = MomentsTable(); 
+  }
+
   //G4cout << "### G4UrbanMscModel::Initialise done!" << G4endl;
 }
 
@@ -323,7 +342,7 @@ G4double G4UrbanMscModel::ComputeCrossSectionPerAtom(
   G4double sigma;
   SetParticle(part);
 
-  Z23 = G4Pow::GetInstance()->Z23(G4lrint(AtomicNumber));
+  G4double z23 = G4Pow::GetInstance()->Z23(G4lrint(AtomicNumber));
 
   // correction if particle .ne. e-/e+
   // compute equivalent kinetic energy
@@ -346,7 +365,7 @@ G4double G4UrbanMscModel::ComputeCrossSectionPerAtom(
   G4double bg2   = eKineticEnergy*(eTotalEnergy+electron_mass_c2)
                                  /(electron_mass_c2*electron_mass_c2);
 
-  G4double eps = epsfactor*bg2/Z23;
+  G4double eps = epsfactor*bg2/z23;
 
   if     (eps<epsmin)  sigma = 2.*eps*eps;
   else if(eps<epsmax)  sigma = G4Log(1.+2.*eps)-2.*eps/(1.+2.*eps);
@@ -940,8 +959,10 @@ G4double G4UrbanMscModel::SampleCosineTheta(G4double trueStepLength,
   if (tau >= taubig) { cth = -1.+2.*rndmEngineMod->flat(); }
   else if (tau >= tausmall) {
     static const G4double numlim = 0.01;
-    G4double xmeanth, x2meanth;
-    if(tau < numlim) {
+    G4double xmeanth, x2meanth, u = 0.0;
+    if(fMoments) {
+      fMoments->Moments(G4Log(tau), xmeanth, x2meanth, u);
+    } else if(tau < numlim) {
       xmeanth = 1.0 - tau*(1.0 - 0.5*tau);
       x2meanth= 1.0 - tau*(5.0 - 6.25*tau)/3.;
     } else {
@@ -984,8 +1005,10 @@ G4double G4UrbanMscModel::SampleCosineTheta(G4double trueStepLength,
     }
 
     // parameter for tail
-    G4double ltau= G4Log(tau);
-    G4double u   = G4Exp(ltau/6.);
+    if(!fMoments) {
+      G4double ltau= G4Log(tau);
+      u = G4Exp(ltau/6.);
+    }
     if(extremesmallstep)  u = G4Exp(G4Log(tsmall/lambda0)/6.);
     G4double xx  = G4Log(lambdaeff/currentRadLength);
     G4double xsi = coeffc1+u*(coeffc2+coeffc3*u)+coeffc4*xx;
@@ -0,0 +1,88 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4UrbanMscMoments
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// -------------------------------------------------------------------
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#include "G4UrbanMscMoments.hh"
+#include <cmath>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4UrbanMscMoments::G4UrbanMscMoments(G4double taumin, G4double taumax, 
+                                     G4int nbins)
+  : nBins(std::max(nbins, 1))
+{
+  logTauMin = std::log(taumin);
+  G4double delta = (std::log(taumax) - logTauMin)/nBins;
+  invDelta = 1.0/delta;
+
+  // tables are filled with the standard library functions, which are
+  // more precise than G4Exp and G4Log used by the model
+  data.resize(6*(nBins + 1));
+  for(G4int i=0; i<=nBins; ++i) {
+    G4double tau = std::exp(logTauMin + i*delta);
+    G4double e1  = std::exp(-tau);
+    G4double e25 = std::exp(-2.5*tau);
+    G4double t16 = std::exp((logTauMin + i*delta)/6.);
+    G4double* p = &data[6*i];
+    p[0] = e1;
+    p[1] = -tau*e1*delta;
+    p[2] = (1. + 2.*e25)/3.;
+    p[3] = -5.*tau*e25*delta/3.;
+    p[4] = t16;
+    p[5] = t16*delta/6.;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4UrbanMscMoments::~G4UrbanMscMoments()
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+size_t G4UrbanMscMoments::MemoryUsage() const
+{
+  return sizeof(G4UrbanMscMoments) + data.capacity()*sizeof(G4double);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -92,6 +92,7 @@ G4eeToTwoGammaModel::G4eeToTwoGammaModel(const G4ParticleDefinition*,
 {
   theGamma = G4Gamma::Gamma();
   fParticleChange = 0;
+  SetThreadSafeTables(typeid(G4eeToTwoGammaModel));
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -155,6 +155,28 @@ public:
 
   void PrintInverseRangeTable(const G4ParticleDefinition*);
 
+  //===========================================================================
+  // Results of profiling of EM processes summed over threads 
+  // (/process/em/profile), empty string means any process, model or region
+  G4long GetNumberOfPostStepCalls(const G4String& processName,
+                                  const G4String& modelName = "",
+                                  const G4String& regionName = "");
+
+  G4long GetNumberOfAlongStepCalls(const G4String& processName,
+                                   const G4String& modelName = "",
+                                   const G4String& regionName = "");
+
+  G4long GetNumberOfSecondaries(const G4String& processName,
+                                const G4String& modelName = "",
+                                const G4String& regionName = "");
+
+  // estimated CPU time in ns
+  G4double GetProfiledTime(const G4String& processName,
+                           const G4String& modelName = "",
+                           const G4String& regionName = "");
+
+  void PrintProfile(const G4String& regionName = "");
+
   //===========================================================================
   // Methods to calculate dE/dx and cross sections "on fly"
   // Existing tables and G4MaterialCutsCouples are not used
@@ -55,6 +55,7 @@
 // 03-08-09 Removed unused members and simplify model search if only one
 //          model is used (VI)
 // 14-07-11 Use pointer to the vector of cuts and not local copy (VI)
+// 19-10-26 Added ThreadSafeTables method
 //
 // Class Description:
 //
@@ -170,6 +171,10 @@ public:
 
   void DumpModelList(G4int verb);
 
+  // true if vectors of all models may be filled for different couples
+  // in parallel
+  G4bool ThreadSafeTables() const;
+
   inline G4VEmModel* SelectModel(G4double& energy, size_t& index);
 
   inline const G4DataVector* Cuts() const;
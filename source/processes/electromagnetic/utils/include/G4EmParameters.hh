@@ -91,6 +91,26 @@ public:
   void SetSpline(G4bool val);
   G4bool Spline() const;
 
+  // interleaved storage of EM physics vectors for faster lookup
+  void SetPackedTables(G4bool val);
+  G4bool PackedTables() const;
+
+  // binary tables are stored as memory mapped archives
+  void SetMappedTables(G4bool val);
+  G4bool MappedTables() const;
+
+  // photon energy of Seltzer-Berger bremsstrahlung is sampled from tables
+  void SetSamplingTable(G4bool val);
+  G4bool SamplingTable() const;
+
+  // gamma processes are combined in one G4GammaGeneralProcess
+  void SetGeneralProcessActive(G4bool val);
+  G4bool GeneralProcessActive() const;
+
+  // per region profiling of EM processes (G4EmProfiler)
+  void SetProfilerActive(G4bool val);
+  G4bool ProfilerActive() const;
+
   void SetUseCutAsFinalRange(G4bool val);
   G4bool UseCutAsFinalRange() const;
 
@@ -130,6 +150,10 @@ public:
   void SetUseMottCorrection(G4bool val);
   G4bool UseMottCorrection() const;
 
+  // moments of the angular distribution of G4UrbanMscModel from tables
+  void SetMscMomentsTable(G4bool val);
+  G4bool MscMomentsTable() const;
+
   // double parameters with values
   void SetMinSubRange(G4double val);
   G4double MinSubRange() const;
@@ -189,6 +213,12 @@ public:
   void SetWorkerVerbose(G4int val);
   G4int WorkerVerbose() const;
 
+  // threads used to build tables in parallel over couples; dedx and
+  // lambda of models are computed by the calling thread unless all
+  // models of the process are thread safe
+  void SetNumberOfThreadsForTables(G4int val);
+  G4int NumberOfThreadsForTables() const;
+
   void SetMscStepLimitType(G4MscStepLimitType val);
   G4MscStepLimitType MscStepLimitType() const;
 
@@ -230,6 +260,11 @@ private:
   G4bool buildCSDARange;
   G4bool flagLPM;
   G4bool spline;
+  G4bool packedTables;
+  G4bool mappedTables;
+  G4bool samplingTable;
+  G4bool gener;
+  G4bool profile;
   G4bool finalRange;
   G4bool applyCuts;
   G4bool fluo;
@@ -243,6 +278,7 @@ private:
   G4bool latDisplacementBeyondSafety;
   G4bool useAngGeneratorForIonisation;
   G4bool useMottCorrection;
+  G4bool mscMomentsTable;
 
   G4double minSubRange;
   G4double minKinEnergy;
@@ -264,6 +300,7 @@ private:
   G4int nbinsPerDecade;
   G4int verbose;
   G4int workerVerbose;
+  G4int nThreadsForTables;
 
   G4MscStepLimitType mscStepLimit;
   G4MscStepLimitType mscStepLimitMuHad;
@@ -86,6 +86,11 @@ private:
   G4UIcmdWithABool*          rangeCmd;
   G4UIcmdWithABool*          lpmCmd;
   G4UIcmdWithABool*          splCmd;
+  G4UIcmdWithABool*          packCmd;
+  G4UIcmdWithABool*          mapCmd;
+  G4UIcmdWithABool*          sbCmd;
+  G4UIcmdWithABool*          genCmd;
+  G4UIcmdWithABool*          profCmd;
   G4UIcmdWithABool*          rsCmd;
   G4UIcmdWithABool*          aplCmd;
   G4UIcmdWithABool*          deCmd;
@@ -99,6 +104,7 @@ private:
   G4UIcmdWithABool*          catCmd;
   G4UIcmdWithABool*          delCmd;
   G4UIcmdWithABool*          mottCmd;
+  G4UIcmdWithABool*          mscmCmd;
 
   G4UIcmdWithADouble*        minSubSecCmd;
   G4UIcmdWithADoubleAndUnit* minEnCmd;
@@ -120,8 +126,10 @@ private:
   G4UIcmdWithAnInteger*      lamCmd;
   G4UIcmdWithAnInteger*      amCmd;
   G4UIcmdWithAnInteger*      verCmd;
+  G4UIcmdWithAnInteger*      thrCmd;
   G4UIcmdWithAnInteger*      ver1Cmd;
   G4UIcmdWithAnInteger*      ver2Cmd;
+  G4UIcmdWithAnInteger*      profSamCmd;
 
   G4UIcmdWithAString*        mscCmd;
   G4UIcmdWithAString*        msc1Cmd;
@@ -133,6 +141,8 @@ private:
   G4UIcmdWithAString*        meCmd;
   G4UIcommand*               dnaCmd;
   G4UIcommand*               dumpCmd;
+  G4UIcmdWithAString*        profPrintCmd;
+  G4UIcommand*               profResetCmd;
 };
 
 #endif
@@ -59,6 +59,7 @@ enum G4EmProcessSubType
   fComptonScattering = 13,
   fGammaConversion = 14,
   fGammaConversionToMuMu = 15,
+  fGammaGeneralProcess = 16,
  
   fCerenkov = 21,
   fScintillation = 22,
@@ -0,0 +1,228 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class header file
+//
+//
+// File name:     G4EmProfiler
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// Class Description:
+//
+// Optional profiling of EM processes: per process, model and region
+// the number of PostStepDoIt and AlongStepDoIt calls, the number of 
+// produced secondaries and the CPU time are counted. The time is 
+// measured for calls selected at random with probability 
+// 1/SetTimeSampling() and is scaled per entry to its number of calls.
+// The selection uses a private generator, so the random engine of the
+// simulation is not affected. Counters are filled per thread without
+// locks and summed over threads when results are requested, which 
+// should be done between runs. Profiling is enabled via
+// G4EmParameters::SetProfilerActive (/process/em/profile).
+
+// -------------------------------------------------------------------
+//
+
+#ifndef G4EmProfiler_h
+#define G4EmProfiler_h 1
+
+#include "globals.hh"
+#include "G4Step.hh"
+#include "G4VParticleChange.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include <vector>
+#include <map>
+#include <iostream>
+
+class G4VProcess;
+class G4VEmModel;
+class G4Region;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+struct G4EmProfileData
+{
+  G4String process;
+  G4String model;
+  G4String region;
+  G4long   nPostStep;
+  G4long   nAlongStep;
+  G4long   nSecondaries;
+  G4long   nTimed;
+  G4double time;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+class G4EmProfiler
+{
+public:
+
+  static G4EmProfiler* Instance();
+
+  ~G4EmProfiler();
+
+  // filled by processes for the current thread
+  void Fill(const G4VProcess*, const G4VEmModel*, const G4Region*,
+            G4bool alongStep, G4int nSecondaries, G4bool timed, 
+            G4double time);
+
+  // true if time of the next call should be measured
+  inline G4bool SampleTime();
+
+  // current time in ns
+  static G4double Clock();
+
+  // results summed over threads; empty string means any 
+  // process, model or region
+  G4long NumberOfCalls(const G4String& process, const G4String& model,
+                       const G4String& region, G4bool alongStep) const;
+
+  G4long NumberOfSecondaries(const G4String& process, 
+                             const G4String& model,
+                             const G4String& region) const;
+
+  // estimated total time in ns
+  G4double Time(const G4String& process, const G4String& model,
+                const G4String& region) const;
+
+  void StreamInfo(std::ostream& os, const G4String& region = "") const;
+
+  void Reset();
+
+  void SetTimeSampling(G4int val);
+  inline G4int TimeSampling() const;
+
+private:
+
+  G4EmProfiler();
+
+  std::vector<G4EmProfileData>* ThreadData();
+
+  void Sum(G4EmProfileData& res, const G4String& process, 
+           const G4String& model, const G4String& region) const;
+
+  // hide assignment operator
+  G4EmProfiler & operator=(const G4EmProfiler &right);
+  G4EmProfiler(const G4EmProfiler&);
+
+  static G4EmProfiler* theInstance;
+
+  // data of the current thread, the index of entry is defined by 
+  // process, model and region 
+  typedef std::pair<std::pair<const G4VProcess*,const G4VEmModel*>,
+                    const G4Region*> G4EmProfileKey;
+  static G4ThreadLocal std::vector<G4EmProfileData>* threadData;
+  static G4ThreadLocal std::map<G4EmProfileKey,size_t>* threadIndex;
+  // state of the generator selecting timed calls
+  static G4ThreadLocal unsigned int sampleState;
+
+  // data of all threads
+  std::vector<std::vector<G4EmProfileData>*> allData;
+
+  G4int timeSampling;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4bool G4EmProfiler::SampleTime()
+{
+  // xorshift, a counter shared by all entries would always select 
+  // the same entry for periodic sequences of calls
+  sampleState ^= sampleState << 13;
+  sampleState ^= sampleState >> 17;
+  sampleState ^= sampleState << 5;
+  return (0 == sampleState % timeSampling);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4int G4EmProfiler::TimeSampling() const
+{
+  return timeSampling;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//
+// Helper measuring one DoIt call of a process, the result is filled 
+// when the object is destroyed, so all return points of the call are
+// accounted; the model is taken at this moment
+
+class G4EmProfileScope
+{
+public:
+
+  inline G4EmProfileScope(G4EmProfiler* prof, const G4VProcess* proc,
+                          G4VEmModel* const& mod, 
+                          const G4VParticleChange* pch,
+                          const G4Step& step, G4bool alongStep)
+    : profiler(prof), process(proc), model(mod), particleChange(pch),
+      stepData(step), along(alongStep), timed(false), time0(0.0)
+  {
+    if(profiler && profiler->SampleTime()) {
+      timed = true;
+      time0 = G4EmProfiler::Clock();
+    }
+  }
+
+  inline ~G4EmProfileScope()
+  {
+    if(profiler) { 
+      G4double t = (timed) ? G4EmProfiler::Clock() - time0 : 0.0;
+      G4int nsec = (particleChange) 
+        ? particleChange->GetNumberOfSecondaries() : 0;
+      const G4VPhysicalVolume* pv = 
+        stepData.GetPreStepPoint()->GetPhysicalVolume();
+      const G4Region* reg = (pv) ? pv->GetLogicalVolume()->GetRegion() : 0;
+      profiler->Fill(process, model, reg, along, nsec, timed, t);
+    }
+  }
+
+private:
+
+  G4EmProfileScope & operator=(const G4EmProfileScope &right);
+  G4EmProfileScope(const G4EmProfileScope&);
+
+  G4EmProfiler*             profiler;
+  const G4VProcess*         process;
+  G4VEmModel* const&        model;
+  const G4VParticleChange*  particleChange;
+  const G4Step&             stepData;
+  G4bool                    along;
+  G4bool                    timed;
+  G4double                  time0;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#endif
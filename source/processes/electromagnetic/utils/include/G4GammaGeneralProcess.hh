@@ -0,0 +1,181 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class header file
+//
+//
+// File name:     G4GammaGeneralProcess
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// Class Description:
+//
+// The general process for gamma, which replaces the list of discrete
+// gamma processes (photo-effect, Compton, conversion, Rayleigh) by one
+// process. The sum of cross sections of the processes having lambda
+// tables is tabulated per couple together with the cumulative
+// fractions of each process, so only one table lookup is done per step.
+// Processes without lambda table (photo-effect with the default
+// model) are computed on fly. When the interaction happens, one
+// of the processes is selected and its PostStepDoIt is used, so
+// final state is sampled by the same models as for separate processes.
+// The sub-processes are owned by G4LossTableManager; forced interaction
+// biasing of sub-processes is not supported.
+
+// -------------------------------------------------------------------
+//
+
+#ifndef G4GammaGeneralProcess_h
+#define G4GammaGeneralProcess_h 1
+
+#include "G4VEmProcess.hh"
+#include "globals.hh"
+#include <vector>
+
+class G4PhysicsTable;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+class G4GammaGeneralProcess : public G4VEmProcess
+{
+public:
+
+  explicit G4GammaGeneralProcess(const G4String& pname = "GammaGeneralProc");
+
+  virtual ~G4GammaGeneralProcess();
+
+  virtual G4bool IsApplicable(const G4ParticleDefinition&);
+
+  // Sub-processes should be added before initialisation
+  void AddEmProcess(G4VEmProcess*);
+
+  virtual void SetMasterProcess(G4VProcess* masterP);
+
+  virtual void PreparePhysicsTable(const G4ParticleDefinition&);
+
+  virtual void BuildPhysicsTable(const G4ParticleDefinition&);
+
+  virtual void StartTracking(G4Track*);
+
+  virtual G4double PostStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double   previousStepSize,
+                             G4ForceCondition* condition);
+
+  virtual G4VParticleChange* PostStepDoIt(const G4Track&, const G4Step&);
+
+  virtual G4bool StorePhysicsTable(const G4ParticleDefinition*,
+                                   const G4String& directory,
+                                   G4bool ascii = false);
+
+  virtual G4bool RetrievePhysicsTable(const G4ParticleDefinition*,
+                                      const G4String& directory,
+                                      G4bool ascii);
+
+  virtual void PrintInfo();
+
+  virtual void ProcessDescription(std::ostream& outFile) const;
+
+  // total cross section per volume of all sub-processes
+  G4double TotalCrossSectionPerVolume(G4double kinEnergy,
+                                      const G4MaterialCutsCouple* couple);
+
+  inline G4int NumberOfProcesses() const;
+
+  // access to sub-processes
+  G4VEmProcess* GetEmProcess(const G4String& name) const;
+
+  // sub-process selected at the last interaction
+  inline const G4VEmProcess* GetSelectedProcess() const;
+
+protected:
+
+  virtual void InitialiseProcess(const G4ParticleDefinition*);
+
+  virtual G4double GetMeanFreePath(const G4Track& track,
+                                   G4double previousStepSize,
+                                   G4ForceCondition* condition);
+
+private:
+
+  void BuildTotalTable();
+
+  void DefineCouple(const G4MaterialCutsCouple* couple);
+
+  G4double ComputeLambda(G4double kinEnergy);
+
+  G4double SubProcessLambda(G4VEmProcess*, G4double kinEnergy);
+
+  // copy constructor and hide assignment operator
+  G4GammaGeneralProcess(G4GammaGeneralProcess &);
+  G4GammaGeneralProcess & operator=(const G4GammaGeneralProcess &right);
+
+  // sub-processes in the order of registration and split into
+  // processes with lambda tables and processes computed on fly
+  std::vector<G4VEmProcess*>    theProcesses;
+  std::vector<G4VEmProcess*>    tableProcesses;
+  std::vector<G4VEmProcess*>    directProcesses;
+
+  // tables are built by master thread and shared
+  G4PhysicsTable*               theTotalTable;
+  std::vector<G4PhysicsTable*>  theFractionTables;
+  std::vector<size_t>           idxFraction;
+  std::vector<G4double>         directLambda;
+
+  G4EmParameters*               param;
+  const G4VEmProcess*           selectedProcess;
+  const G4MaterialCutsCouple*   currCouple;
+
+  G4double                      preStepKinE;
+  G4double                      preStepLambdaTable;
+  G4double                      preStepLambdaTotal;
+  size_t                        currCoupleIndex;
+  size_t                        idxTotal;
+  G4bool                        isTheMaster;
+};
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4int G4GammaGeneralProcess::NumberOfProcesses() const
+{
+  return theProcesses.size();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline const G4VEmProcess* G4GammaGeneralProcess::GetSelectedProcess() const
+{
+  return selectedProcess;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#endif
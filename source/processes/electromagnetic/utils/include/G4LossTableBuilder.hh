@@ -40,6 +40,10 @@
 // Modifications: 
 // 08-11-04 Migration to new interface of Store/Retrieve tables (V.Ivanchenko)
 // 17-07-08 Added splineFlag (V.Ivanchenko)
+// 19-10-26 Added packFlag for interleaved storage of vectors
+// 19-10-26 Sum of dedx vectors, range and inverse range vectors may be
+//          built by several threads in parallel over couples
+// 19-10-26 BuildVectors is public and is used also for vectors of models
 //
 // Class Description: 
 //
@@ -52,8 +56,10 @@
 #define G4LossTableBuilder_h 1
 
 #include <vector>
+#include <functional>
 #include "globals.hh"
 #include "G4PhysicsTable.hh"
+#include "G4Threading.hh"
 
 class G4VEmModel;
 class G4ParticleDefinition;
@@ -101,17 +107,41 @@ public:
 
   inline void SetSplineFlag(G4bool flag);
 
+  inline void SetPackFlag(G4bool flag);
+
+  // fill vec[i] = func(i) for all i using nThreads threads if 
+  // threadSafe is true, otherwise in the calling thread
+  void BuildVectors(std::vector<G4PhysicsVector*>& vec,
+                    const std::function<G4PhysicsVector*(size_t)>& func,
+                    G4bool threadSafe = true);
+
+  // number of threads used to build vectors for different couples;
+  // results do not depend on it
+  inline void SetNumberOfThreads(G4int val);
+
   inline void SetInitialisationFlag(G4bool flag);
  
 private:
 
   void InitialiseCouples();
 
+  struct BuildVectorsTask 
+  {
+    const std::function<G4PhysicsVector*(size_t)>* func;
+    std::vector<G4PhysicsVector*>* result;
+    size_t first;
+    size_t step;
+  };
+
+  static G4ThreadFunReturnType BuildVectorsThread(G4ThreadFunArgType);
+
   G4LossTableBuilder & operator=(const  G4LossTableBuilder &right);
   G4LossTableBuilder(const  G4LossTableBuilder&);
 
   G4bool splineFlag;
+  G4bool packFlag;
   G4bool isInitialized;
+  G4int  nThreads;
 
   std::vector<G4double>* theDensityFactor;
   std::vector<G4int>*    theDensityIdx;
@@ -143,6 +173,16 @@ inline void G4LossTableBuilder::SetSplineFlag(G4bool flag)
   splineFlag = flag;
 }
 
+inline void G4LossTableBuilder::SetPackFlag(G4bool flag)
+{
+  packFlag = flag;
+}
+
+inline void G4LossTableBuilder::SetNumberOfThreads(G4int val)
+{
+  nThreads = val;
+}
+
 inline void G4LossTableBuilder::SetInitialisationFlag(G4bool flag)
 {
   isInitialized = flag;
@@ -66,6 +66,7 @@
 // 16-02-09 Moved implementations of virtual methods to source (VI)
 // 07-04-09 Moved msc methods from G4VEmModel to G4VMscModel (VI)
 // 13-10-10 Added G4VEmAngularDistribution (VI)
+// 19-10-26 Added flag of thread safe computation of tables
 //
 // Class Description:
 //
@@ -91,6 +92,7 @@
 #include "G4EmElementSelector.hh"
 #include <CLHEP/Random/RandomEngine.h>
 #include <vector>
+#include <typeinfo>
 
 class G4ElementData;
 class G4PhysicsTable;
@@ -378,8 +380,19 @@ public:
 
   inline void SetLocked(G4bool);
 
+  // true if cross section and dEdx of this concrete class may be computed 
+  // for different couples in parallel, used at building of tables
+  inline G4bool ThreadSafeTables() const;
+
 protected:
 
+  // should be called from the constructor of a concrete model, which 
+  // methods used to build tables (Value(), CrossSectionPerVolume(), 
+  // ComputeDEDXPerVolume()) do not modify members of the model and do 
+  // not use current couple and element; the flag is not inherited by
+  // classes derived from this one
+  inline void SetThreadSafeTables(const std::type_info&);
+
   inline const G4MaterialCutsCouple* CurrentCouple() const;
 
   inline void SetCurrentElement(const G4Element*);
@@ -414,6 +427,7 @@ private:
   G4bool          useAngularGenerator;
   G4bool          isLocked;
   G4int           nSelectors;
+  const std::type_info* threadSafeTables;
   std::vector<G4EmElementSelector*>* elmSelectors;
 
 protected:
@@ -492,7 +506,7 @@ inline G4double G4VEmModel::ComputeDEDX(const G4MaterialCutsCouple* couple,
                                         G4double kinEnergy,
                                         G4double cutEnergy)
 {
-  SetCurrentCouple(couple);
+  if(!ThreadSafeTables()) { SetCurrentCouple(couple); }
   return ComputeDEDXPerVolume(couple->GetMaterial(),part,kinEnergy,cutEnergy);
 }
 
@@ -504,7 +518,7 @@ inline G4double G4VEmModel::CrossSection(const G4MaterialCutsCouple* couple,
                                          G4double cutEnergy,
                                          G4double maxEnergy)
 {
-  SetCurrentCouple(couple);
+  if(!ThreadSafeTables()) { SetCurrentCouple(couple); }
   return CrossSectionPerVolume(couple->GetMaterial(),part,kinEnergy,
                                cutEnergy,maxEnergy);
 }
@@ -842,6 +856,20 @@ inline void G4VEmModel::SetLocked(G4bool val)
   isLocked = val;
 }
 
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline G4bool G4VEmModel::ThreadSafeTables() const
+{
+  return (threadSafeTables && typeid(*this) == *threadSafeTables);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+inline void G4VEmModel::SetThreadSafeTables(const std::type_info& val)
+{
+  threadSafeTables = &val;
+}
+
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 #endif
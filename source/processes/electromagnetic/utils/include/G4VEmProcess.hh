@@ -55,6 +55,7 @@
 // 27-10-07 Virtual functions moved to source (V.Ivanchenko)
 // 15-07-08 Reorder class members for further multi-thread development (VI)
 // 17-02-10 Added pointer currentParticle (VI)
+// 19-10-26 Added CurrentSetup for usage inside G4GammaGeneralProcess
 //
 // Class Description:
 //
@@ -87,6 +88,7 @@ class G4PhysicsTable;
 class G4PhysicsVector;
 class G4EmBiasingManager;
 class G4LossTableManager;
+class G4EmProfiler;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -178,6 +180,11 @@ public:
   inline G4double GetLambda(G4double& kinEnergy, 
                             const G4MaterialCutsCouple* couple);
 
+  // Set the state of the process before PostStepDoIt, if the 
+  // interaction is selected by another process (G4GammaGeneralProcess)
+  inline void CurrentSetup(const G4MaterialCutsCouple* couple, 
+                           G4double kinEnergy);
+
   //------------------------------------------------------------------------
   // Specific methods to build and access Physics Tables
   //------------------------------------------------------------------------
@@ -334,6 +341,7 @@ private:
 
   G4LossTableManager*          lManager;
   G4EmParameters*              theParameters;  
+  G4EmProfiler*                profiler;
   G4EmModelManager*            modelManager;
   G4EmBiasingManager*          biasManager;
   const G4ParticleDefinition*  theGamma;
@@ -522,6 +530,17 @@ G4VEmProcess::GetLambda(G4double& kinEnergy,
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+inline void 
+G4VEmProcess::CurrentSetup(const G4MaterialCutsCouple* couple, G4double e)
+{
+  DefineMaterial(couple);
+  SelectModel(e, currentCoupleIndex);
+  preStepKinEnergy = e;
+  preStepLambda = GetCurrentLambda(e);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 inline G4double 
 G4VEmProcess::RecalculateLambda(G4double e, const G4MaterialCutsCouple* couple)
 {
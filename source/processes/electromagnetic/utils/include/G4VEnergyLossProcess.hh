@@ -118,6 +118,7 @@ class G4VAtomDeexcitation;
 class G4VSubCutProducer;
 class G4EmBiasingManager;
 class G4LossTableManager;
+class G4EmProfiler;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -474,6 +475,7 @@ private:
   G4EmBiasingManager*         biasManager;
   G4SafetyHelper*             safetyHelper;
   G4EmParameters*             theParameters;  
+  G4EmProfiler*               profiler;
 
   const G4ParticleDefinition* secondaryParticle;
   const G4ParticleDefinition* theElectron;
@@ -85,6 +85,7 @@
 class G4ParticleDefinition;
 class G4VEnergyLossProcess;
 class G4LossTableManager;
+class G4EmProfiler;
 class G4SafetyHelper;
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -253,6 +254,7 @@ private:
   G4EmModelManager*           modelManager;
   G4LossTableManager*         emManager;
   G4EmParameters*             theParameters;  
+  G4EmProfiler*               profiler;
 
   // ======== Parameters of the class fixed at initialisation =======
 
@@ -57,12 +57,14 @@ GEANT4_DEFINE_MODULE(NAME G4emutils
         G4EmMultiModel.hh
         G4EmParameters.hh
         G4EmParametersMessenger.hh
+        G4EmProfiler.hh
         G4EmProcessOptions.hh
         G4EmProcessSubType.hh
         G4EmSaturation.hh
         G4EmTableType.hh
         G4EnergyLossMessenger.hh
         G4EnergyLossTables.hh
+        G4GammaGeneralProcess.hh
         G4LossTableBuilder.hh
         G4LossTableManager.hh
         G4MscStepLimitType.hh
@@ -90,10 +92,12 @@ GEANT4_DEFINE_MODULE(NAME G4emutils
         G4EmMultiModel.cc
         G4EmParameters.cc
         G4EmParametersMessenger.cc
+        G4EmProfiler.cc
         G4EmProcessOptions.cc
         G4EmSaturation.cc
         G4EnergyLossMessenger.cc
         G4EnergyLossTables.cc
+        G4GammaGeneralProcess.cc
         G4LossTableBuilder.cc
         G4LossTableManager.cc
         G4VAtomDeexcitation.cc
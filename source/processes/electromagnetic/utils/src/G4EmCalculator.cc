@@ -86,6 +86,7 @@
 #include "G4Gamma.hh"
 #include "G4Electron.hh"
 #include "G4Positron.hh"
+#include "G4EmProfiler.hh"
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
@@ -375,6 +376,52 @@ void G4EmCalculator::PrintInverseRangeTable(const G4ParticleDefinition* p)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4long G4EmCalculator::GetNumberOfPostStepCalls(const G4String& processName,
+                                                const G4String& modelName,
+                                                const G4String& regionName)
+{
+  return G4EmProfiler::Instance()->NumberOfCalls(processName, modelName,
+                                                 regionName, false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4long G4EmCalculator::GetNumberOfAlongStepCalls(const G4String& processName,
+                                                 const G4String& modelName,
+                                                 const G4String& regionName)
+{
+  return G4EmProfiler::Instance()->NumberOfCalls(processName, modelName,
+                                                 regionName, true);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4long G4EmCalculator::GetNumberOfSecondaries(const G4String& processName,
+                                              const G4String& modelName,
+                                              const G4String& regionName)
+{
+  return G4EmProfiler::Instance()->NumberOfSecondaries(processName, 
+                                                       modelName, regionName);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4EmCalculator::GetProfiledTime(const G4String& processName,
+                                         const G4String& modelName,
+                                         const G4String& regionName)
+{
+  return G4EmProfiler::Instance()->Time(processName, modelName, regionName);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmCalculator::PrintProfile(const G4String& regionName)
+{
+  G4EmProfiler::Instance()->StreamInfo(G4cout, regionName);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 G4double G4EmCalculator::ComputeDEDX(G4double kinEnergy,
                                      const G4ParticleDefinition* p,
                                      const G4String& processName,
@@ -717,6 +717,16 @@ void G4EmModelManager::FillLambdaVector(G4PhysicsVector* aVector,
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
+G4bool G4EmModelManager::ThreadSafeTables() const
+{
+  for(G4int i=0; i<nEmModels; ++i) {
+    if(!models[i]->ThreadSafeTables()) { return false; }
+  }
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
 void G4EmModelManager::DumpModelList(G4int verb)
 {
   if(verb == 0) { return; }
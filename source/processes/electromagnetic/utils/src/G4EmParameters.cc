@@ -93,6 +93,11 @@ void G4EmParameters::SetDefaults()
   buildCSDARange = false;
   flagLPM = true;
   spline = true;
+  packedTables = false;
+  mappedTables = false;
+  samplingTable = false;
+  gener = false;
+  profile = false;
   finalRange = false;
   applyCuts = false;
   fluo = false;
@@ -106,6 +111,7 @@ void G4EmParameters::SetDefaults()
   latDisplacementBeyondSafety = false;
   useAngGeneratorForIonisation = false;
   useMottCorrection = false;
+  mscMomentsTable = false;
 
   minSubRange = 1.0;
   minKinEnergy = 0.1*keV;
@@ -125,6 +131,7 @@ void G4EmParameters::SetDefaults()
 
   nbins  = 77;
   nbinsPerDecade = 7;
+  nThreadsForTables = 1;
   verbose = 1;
   workerVerbose = 0;
 
@@ -179,6 +186,61 @@ G4bool G4EmParameters::Spline() const
   return spline;
 }
 
+void G4EmParameters::SetPackedTables(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  packedTables = val;
+}
+
+G4bool G4EmParameters::PackedTables() const
+{
+  return packedTables;
+}
+
+void G4EmParameters::SetMappedTables(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  mappedTables = val;
+}
+
+G4bool G4EmParameters::MappedTables() const
+{
+  return mappedTables;
+}
+
+void G4EmParameters::SetSamplingTable(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  samplingTable = val;
+}
+
+G4bool G4EmParameters::SamplingTable() const
+{
+  return samplingTable;
+}
+
+void G4EmParameters::SetGeneralProcessActive(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  gener = val;
+}
+
+G4bool G4EmParameters::GeneralProcessActive() const
+{
+  return gener;
+}
+
+void G4EmParameters::SetProfilerActive(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  profile = val;
+}
+
+G4bool G4EmParameters::ProfilerActive() const
+{
+  return profile;
+}
+
 void G4EmParameters::SetUseCutAsFinalRange(G4bool val)
 {
   G4AutoLock l(&EmParametersMutex);
@@ -323,6 +385,17 @@ G4bool G4EmParameters::UseMottCorrection() const
   return useMottCorrection;
 }
 
+void G4EmParameters::SetMscMomentsTable(G4bool val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  mscMomentsTable = val;
+}
+
+G4bool G4EmParameters::MscMomentsTable() const
+{
+  return mscMomentsTable;
+}
+
 void G4EmParameters::SetMinSubRange(G4double val)
 {
   G4AutoLock l(&EmParametersMutex);
@@ -657,6 +730,24 @@ G4int G4EmParameters::WorkerVerbose() const
   return workerVerbose;
 }
 
+void G4EmParameters::SetNumberOfThreadsForTables(G4int val)
+{
+  G4AutoLock l(&EmParametersMutex);
+  if(val >= 1) {
+    nThreadsForTables = val;
+  } else {
+    G4ExceptionDescription ed;
+    ed << "Value of number of threads for tables is out of range: " 
+       << val << " is ignored"; 
+    PrintWarning(ed);
+  }
+}
+
+G4int G4EmParameters::NumberOfThreadsForTables() const 
+{
+  return nThreadsForTables;
+}
+
 void G4EmParameters::SetMscStepLimitType(G4MscStepLimitType val)
 {
   G4AutoLock l(&EmParametersMutex);
@@ -796,6 +887,11 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
   os << "Build CSDA range enabled                           " <<buildCSDARange << "\n";
   os << "LPM effect enabled                                 " <<flagLPM << "\n";
   os << "Spline of EM tables enabled                        " <<spline << "\n";
+  os << "Packed (interleaved) EM tables enabled             " <<packedTables << "\n";
+  os << "Store EM tables as mapped archives                 " <<mappedTables << "\n";
+  os << "Table sampling of Seltzer-Berger bremsstrahlung    " <<samplingTable << "\n";
+  os << "Use general process for gamma                      " <<gener << "\n";
+  os << "Profiling of EM processes per region               " <<profile << "\n";
   os << "Use cut as a final range enabled                   " <<finalRange << "\n";
   os << "Apply cuts on all EM processes                     " <<applyCuts << "\n";
   os << "Fluorescence enabled                               " <<fluo << "\n";
@@ -811,6 +907,8 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
      <<useAngGeneratorForIonisation << "\n";
   os << "Use Mott correction for e- scattering              " 
      <<useMottCorrection << "\n";
+  os << "Msc moments of Urban model from tables             " 
+     <<mscMomentsTable << "\n";
 
   os << "Factor of cut reduction for sub-cutoff method      " <<minSubRange << "\n";
   os << "Min kinetic energy for tables                      " 
@@ -842,6 +940,7 @@ std::ostream& G4EmParameters::StreamInfo(std::ostream& os) const
   os << "Number of bins per decade of a table               " <<nbinsPerDecade << "\n";
   os << "Verbose level                                      " <<verbose << "\n";
   os << "Verbose level for worker thread                    " <<workerVerbose << "\n";
+  os << "Number of threads to build dedx and range tables   " <<nThreadsForTables << "\n";
 
   os << "Type of msc step limit algorithm for e+-           " <<mscStepLimit << "\n";
   os << "Type of msc step limit algorithm for muons/hadrons " <<mscStepLimitMuHad << "\n";
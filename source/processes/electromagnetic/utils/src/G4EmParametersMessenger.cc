@@ -56,6 +56,7 @@
 #include "G4UImanager.hh"
 #include "G4MscStepLimitType.hh"
 #include "G4EmParameters.hh"
+#include "G4EmProfiler.hh"
 
 #include <sstream>
 
@@ -95,6 +96,57 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   splCmd->SetDefaultValue(false);
   splCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  packCmd = new G4UIcmdWithABool("/process/em/packedTables",this);
+  packCmd->SetGuidance("Enable/disable interleaved storage of EM tables");
+  packCmd->SetParameterName("pack",true);
+  packCmd->SetDefaultValue(true);
+  packCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  mapCmd = new G4UIcmdWithABool("/process/em/mappedTables",this);
+  mapCmd->SetGuidance("Enable/disable storage of binary EM tables");
+  mapCmd->SetGuidance("  as memory mapped archives");
+  mapCmd->SetParameterName("map",true);
+  mapCmd->SetDefaultValue(true);
+  mapCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  sbCmd = new G4UIcmdWithABool("/process/em/samplingTable",this);
+  sbCmd->SetGuidance("Enable/disable table sampling of the photon energy");
+  sbCmd->SetGuidance("  for Seltzer-Berger bremsstrahlung");
+  sbCmd->SetParameterName("sb",true);
+  sbCmd->SetDefaultValue(true);
+  sbCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  genCmd = new G4UIcmdWithABool("/process/em/UseGeneralProcess",this);
+  genCmd->SetGuidance("Enable/disable one combined process for gamma");
+  genCmd->SetParameterName("gen",true);
+  genCmd->SetDefaultValue(true);
+  genCmd->AvailableForStates(G4State_PreInit);
+
+  profCmd = new G4UIcmdWithABool("/process/em/profile",this);
+  profCmd->SetGuidance("Enable/disable profiling of EM processes per region");
+  profCmd->SetParameterName("prof",true);
+  profCmd->SetDefaultValue(true);
+  profCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  profSamCmd = new G4UIcmdWithAnInteger("/process/em/profileTimeSampling",this);
+  profSamCmd->SetGuidance("Set mean number of calls per one time measurement,");
+  profSamCmd->SetGuidance("timed calls are selected at random");
+  profSamCmd->SetParameterName("nsam",true);
+  profSamCmd->SetDefaultValue(10);
+  profSamCmd->SetRange("nsam>0");
+  profSamCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  profPrintCmd = new G4UIcmdWithAString("/process/em/printProfile",this);
+  profPrintCmd->SetGuidance("Print EM profile summed over threads");
+  profPrintCmd->SetGuidance("  for the given region or for all regions");
+  profPrintCmd->SetParameterName("region",true);
+  profPrintCmd->SetDefaultValue("");
+  profPrintCmd->AvailableForStates(G4State_Idle);
+
+  profResetCmd = new G4UIcommand("/process/em/resetProfile",this);
+  profResetCmd->SetGuidance("Reset counters of EM profile.");
+  profResetCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   rsCmd = new G4UIcmdWithABool("/process/eLoss/useCutAsFinalRange",this);
   rsCmd->SetGuidance("Enable?disable use of cut in range as a final range");
   rsCmd->SetParameterName("choice",true);
@@ -173,6 +225,13 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   mottCmd->SetDefaultValue(false);
   mottCmd->AvailableForStates(G4State_PreInit);
 
+  mscmCmd = new G4UIcmdWithABool("/process/msc/MomentsTable",this);
+  mscmCmd->SetGuidance("Enable/disable tables of moments of the angular");
+  mscmCmd->SetGuidance("  distribution for the Urban msc model");
+  mscmCmd->SetParameterName("mscm",true);
+  mscmCmd->SetDefaultValue(true);
+  mscmCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   minSubSecCmd = new G4UIcmdWithADouble("/process/eLoss/minsubsec",this);
   minSubSecCmd->SetGuidance("Set the ratio subcut/cut ");
   minSubSecCmd->SetParameterName("rcmin",true);
@@ -281,6 +340,16 @@ G4EmParametersMessenger::G4EmParametersMessenger(G4EmParameters* ptr)
   amCmd->SetDefaultValue(7);
   amCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+  thrCmd = new G4UIcmdWithAnInteger("/process/em/tableThreads",this);
+  thrCmd->SetGuidance("Set number of threads to build tables in parallel");
+  thrCmd->SetGuidance("  over couples; dedx and lambda tables are built");
+  thrCmd->SetGuidance("  serially if a model of the process is not thread safe;");
+  thrCmd->SetGuidance("  tables do not depend on it");
+  thrCmd->SetParameterName("nthr",true);
+  thrCmd->SetDefaultValue(1);
+  thrCmd->SetRange("nthr>0");
+  thrCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
   verCmd = new G4UIcmdWithAnInteger("/process/eLoss/verbose",this);
   verCmd->SetGuidance("Set verbose level for EM physics");
   verCmd->SetParameterName("verb",true);
@@ -371,6 +440,14 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete rangeCmd;
   delete lpmCmd;
   delete splCmd;
+  delete packCmd;
+  delete mapCmd;
+  delete sbCmd;
+  delete genCmd;
+  delete profCmd;
+  delete profSamCmd;
+  delete profPrintCmd;
+  delete profResetCmd;
   delete rsCmd;
   delete aplCmd;
   delete deCmd;
@@ -384,6 +461,7 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete catCmd;
   delete delCmd;
   delete mottCmd;
+  delete mscmCmd;
 
   delete minSubSecCmd;
   delete minEnCmd;
@@ -405,6 +483,7 @@ G4EmParametersMessenger::~G4EmParametersMessenger()
   delete lamCmd;
   delete amCmd;
   delete verCmd;
+  delete thrCmd;
   delete ver1Cmd;
   delete ver2Cmd;
 
@@ -437,6 +516,16 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
   } else if (command == splCmd) {
     theParameters->SetSpline(splCmd->GetNewBoolValue(newValue));
     physicsModified = true;
+  } else if (command == packCmd) {
+    theParameters->SetPackedTables(packCmd->GetNewBoolValue(newValue));
+    physicsModified = true;
+  } else if (command == mapCmd) {
+    theParameters->SetMappedTables(mapCmd->GetNewBoolValue(newValue));
+  } else if (command == sbCmd) {
+    theParameters->SetSamplingTable(sbCmd->GetNewBoolValue(newValue));
+    physicsModified = true;
+  } else if (command == genCmd) {
+    theParameters->SetGeneralProcessActive(genCmd->GetNewBoolValue(newValue));
   } else if (command == rsCmd) {
     theParameters->SetUseCutAsFinalRange(rsCmd->GetNewBoolValue(newValue));
     physicsModified = true;
@@ -473,6 +562,9 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->ActivateAngularGeneratorForIonisation(delCmd->GetNewBoolValue(newValue));
   } else if (command == mottCmd) {
     theParameters->SetUseMottCorrection(mottCmd->GetNewBoolValue(newValue));
+  } else if (command == mscmCmd) {
+    theParameters->SetMscMomentsTable(mscmCmd->GetNewBoolValue(newValue));
+    physicsModified = true;
 
   } else if (command == minSubSecCmd) {
     theParameters->SetMinSubRange(minSubSecCmd->GetNewDoubleValue(newValue));
@@ -528,6 +620,8 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
   } else if (command == amCmd) { 
     theParameters->SetNumberOfBinsPerDecade(amCmd->GetNewIntValue(newValue));
     physicsModified = true;
+  } else if (command == thrCmd) { 
+    theParameters->SetNumberOfThreadsForTables(thrCmd->GetNewIntValue(newValue));
   } else if (command == verCmd) {
     theParameters->SetVerbose(verCmd->GetNewIntValue(newValue));
   } else if (command == ver1Cmd) {
@@ -576,6 +670,15 @@ void G4EmParametersMessenger::SetNewValue(G4UIcommand* command,
     theParameters->AddDNA(s1, s2);
   } else if (command == dumpCmd) {
     theParameters->Dump();
+  } else if (command == profCmd) {
+    theParameters->SetProfilerActive(profCmd->GetNewBoolValue(newValue));
+  } else if (command == profSamCmd) {
+    G4EmProfiler::Instance()
+      ->SetTimeSampling(profSamCmd->GetNewIntValue(newValue));
+  } else if (command == profPrintCmd) {
+    G4EmProfiler::Instance()->StreamInfo(G4cout, newValue);
+  } else if (command == profResetCmd) {
+    G4EmProfiler::Instance()->Reset();
   }
   if(physicsModified) {
     G4UImanager::GetUIpointer()->ApplyCommand("/run/physicsModified");
@@ -0,0 +1,303 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4EmProfiler
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// -------------------------------------------------------------------
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#include "G4EmProfiler.hh"
+#include "G4VProcess.hh"
+#include "G4VEmModel.hh"
+#include "G4Region.hh"
+#include "G4AutoLock.hh"
+#include <chrono>
+#include <iomanip>
+
+namespace
+{
+  G4Mutex EmProfilerMutex = G4MUTEX_INITIALIZER;
+
+  // adds an entry, time is scaled to the number of calls
+  void AddData(G4EmProfileData& res, const G4EmProfileData& d)
+  {
+    res.nPostStep    += d.nPostStep;
+    res.nAlongStep   += d.nAlongStep;
+    res.nSecondaries += d.nSecondaries;
+    if(d.nTimed > 0) {
+      res.time += d.time*G4double(d.nPostStep + d.nAlongStep)/
+        G4double(d.nTimed);
+    }
+    res.nTimed += d.nTimed;
+  }
+}
+
+G4EmProfiler* G4EmProfiler::theInstance = 0;
+G4ThreadLocal std::vector<G4EmProfileData>* G4EmProfiler::threadData = 0;
+G4ThreadLocal std::map<G4EmProfiler::G4EmProfileKey,size_t>* 
+  G4EmProfiler::threadIndex = 0;
+G4ThreadLocal unsigned int G4EmProfiler::sampleState = 2463534242U;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4EmProfiler* G4EmProfiler::Instance()
+{
+  if(0 == theInstance) {
+    G4AutoLock l(&EmProfilerMutex);
+    if(0 == theInstance) {
+      static G4EmProfiler manager;
+      theInstance = &manager;
+    }
+  }
+  return theInstance;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4EmProfiler::G4EmProfiler() : timeSampling(10)
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4EmProfiler::~G4EmProfiler()
+{
+  for(size_t i=0; i<allData.size(); ++i) { delete allData[i]; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+std::vector<G4EmProfileData>* G4EmProfiler::ThreadData()
+{
+  if(!threadData) {
+    // per thread data are owned by the profiler, so they are 
+    // available after the end of the thread
+    threadData = new std::vector<G4EmProfileData>;
+    threadIndex = new std::map<G4EmProfileKey,size_t>;
+    G4AutoLock l(&EmProfilerMutex);
+    allData.push_back(threadData);
+  }
+  return threadData;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmProfiler::Fill(const G4VProcess* proc, const G4VEmModel* mod, 
+                        const G4Region* reg, G4bool alongStep, 
+                        G4int nsec, G4bool timed, G4double time)
+{
+  std::vector<G4EmProfileData>* data = ThreadData();
+  G4EmProfileKey key(std::make_pair(proc, mod), reg);
+  std::map<G4EmProfileKey,size_t>::const_iterator it = 
+    threadIndex->find(key);
+  size_t idx;
+  if(it == threadIndex->end()) {
+    G4EmProfileData d;
+    d.process = (proc) ? proc->GetProcessName() : "";
+    d.model   = (mod) ? mod->GetName() : "";
+    d.region  = (reg) ? reg->GetName() : "";
+    d.nPostStep = d.nAlongStep = d.nSecondaries = d.nTimed = 0;
+    d.time = 0.0;
+    idx = data->size();
+    // the vector may be reallocated while it is read by Sum()
+    G4AutoLock l(&EmProfilerMutex);
+    data->push_back(d);
+    l.unlock();
+    (*threadIndex)[key] = idx;
+  } else {
+    idx = it->second;
+  }
+  G4EmProfileData& d = (*data)[idx];
+  if(alongStep) { ++d.nAlongStep; }
+  else          { ++d.nPostStep; }
+  d.nSecondaries += nsec;
+  if(timed) {
+    ++d.nTimed;
+    d.time += time;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4EmProfiler::Clock()
+{
+  return std::chrono::duration<G4double, std::nano>
+    (std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmProfiler::Sum(G4EmProfileData& res, const G4String& process, 
+                       const G4String& model, const G4String& region) const
+{
+  res.process = process;
+  res.model   = model;
+  res.region  = region;
+  res.nPostStep = res.nAlongStep = res.nSecondaries = res.nTimed = 0;
+  res.time = 0.0;
+  G4AutoLock l(&EmProfilerMutex);
+  for(size_t i=0; i<allData.size(); ++i) {
+    const std::vector<G4EmProfileData>* data = allData[i];
+    for(size_t j=0; j<data->size(); ++j) {
+      const G4EmProfileData& d = (*data)[j];
+      if((process.empty() || process == d.process) &&
+         (model.empty()   || model == d.model) &&
+         (region.empty()  || region == d.region)) {
+        AddData(res, d);
+      }
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4long G4EmProfiler::NumberOfCalls(const G4String& process, 
+                                   const G4String& model,
+                                   const G4String& region, 
+                                   G4bool alongStep) const
+{
+  G4EmProfileData res;
+  Sum(res, process, model, region);
+  return (alongStep) ? res.nAlongStep : res.nPostStep;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4long G4EmProfiler::NumberOfSecondaries(const G4String& process, 
+                                         const G4String& model,
+                                         const G4String& region) const
+{
+  G4EmProfileData res;
+  Sum(res, process, model, region);
+  return res.nSecondaries;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4EmProfiler::Time(const G4String& process, const G4String& model,
+                            const G4String& region) const
+{
+  G4EmProfileData res;
+  Sum(res, process, model, region);
+  return res.time;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmProfiler::StreamInfo(std::ostream& os, const G4String& region) const
+{
+  // list of different entries merged over threads
+  std::vector<G4EmProfileData> list;
+  G4AutoLock l(&EmProfilerMutex);
+  size_t nthreads = allData.size();
+  for(size_t i=0; i<nthreads; ++i) {
+    const std::vector<G4EmProfileData>* data = allData[i];
+    for(size_t j=0; j<data->size(); ++j) {
+      const G4EmProfileData& d = (*data)[j];
+      if(!region.empty() && region != d.region) { continue; }
+      size_t k = 0;
+      for(; k<list.size(); ++k) {
+        if(d.process == list[k].process && d.model == list[k].model &&
+           d.region == list[k].region) { break; }
+      }
+      if(k == list.size()) { 
+        G4EmProfileData res;
+        res.process = d.process;
+        res.model   = d.model;
+        res.region  = d.region;
+        res.nPostStep = res.nAlongStep = res.nSecondaries = res.nTimed = 0;
+        res.time = 0.0;
+        list.push_back(res); 
+      }
+      AddData(list[k], d);
+    }
+  }
+  l.unlock();
+  G4double total = 0.0;
+  for(size_t k=0; k<list.size(); ++k) { total += list[k].time; }
+
+  G4int prec = os.precision(4);
+  os << "=======================================================================" 
+     << "\n";
+  os << "======                 EM profile of " << nthreads 
+     << " threads";
+  if(!region.empty()) { os << " in region <" << region << ">"; }
+  os << "\n";
+  os << "=======================================================================" 
+     << "\n";
+  os << std::setw(16) << "Region" << std::setw(14) << "Process" 
+     << std::setw(18) << "Model" << std::setw(12) << "PostStep" 
+     << std::setw(12) << "AlongStep" << std::setw(12) << "Secondaries"
+     << std::setw(12) << "Time(ms)" << std::setw(8) << "%" << "\n";
+  for(size_t k=0; k<list.size(); ++k) {
+    const G4EmProfileData& d = list[k];
+    os << std::setw(16) << d.region << std::setw(14) << d.process 
+       << std::setw(18) << d.model << std::setw(12) << d.nPostStep 
+       << std::setw(12) << d.nAlongStep << std::setw(12) << d.nSecondaries
+       << std::setw(12) << d.time*1.e-6 
+       << std::setw(8) << ((total > 0.0) ? 100.*d.time/total : 0.0) << "\n";
+  }
+  os << "Time is measured for random calls with probability 1/" 
+     << timeSampling << " and scaled to the number of calls" << "\n";
+  os << "=======================================================================" 
+     << "\n";
+  os.precision(prec);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmProfiler::Reset()
+{
+  G4AutoLock l(&EmProfilerMutex);
+  for(size_t i=0; i<allData.size(); ++i) {
+    std::vector<G4EmProfileData>* data = allData[i];
+    for(size_t j=0; j<data->size(); ++j) {
+      G4EmProfileData& d = (*data)[j];
+      d.nPostStep = d.nAlongStep = d.nSecondaries = d.nTimed = 0;
+      d.time = 0.0;
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4EmProfiler::SetTimeSampling(G4int val)
+{
+  if(val > 0) { timeSampling = val; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -0,0 +1,562 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4GammaGeneralProcess
+//
+// Creation date: 19.10.2026
+//
+// Modifications:
+//
+// -------------------------------------------------------------------
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+#include "G4GammaGeneralProcess.hh"
+#include "G4EmProcessSubType.hh"
+#include "G4VEmModel.hh"
+#include "G4Gamma.hh"
+#include "G4Step.hh"
+#include "G4PhysicsTable.hh"
+#include "G4PhysicsLogVector.hh"
+#include "G4PhysicsTableHelper.hh"
+#include "G4ProductionCutsTable.hh"
+#include "G4MaterialCutsCouple.hh"
+#include "Randomize.hh"
+#include "G4Log.hh"
+#include <iostream>
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4GammaGeneralProcess::G4GammaGeneralProcess(const G4String& pname):
+  G4VEmProcess(pname),
+  theTotalTable(nullptr),
+  selectedProcess(nullptr),
+  currCouple(nullptr),
+  preStepKinE(0.0),
+  preStepLambdaTable(0.0),
+  preStepLambdaTotal(0.0),
+  currCoupleIndex(0),
+  idxTotal(0),
+  isTheMaster(true)
+{
+  param = G4EmParameters::Instance();
+  SetParticle(G4Gamma::Gamma());
+  SetProcessSubType(fGammaGeneralProcess);
+  SetBuildTableFlag(false);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4GammaGeneralProcess::~G4GammaGeneralProcess()
+{
+  // sub-processes are deleted by G4LossTableManager
+  if(isTheMaster) {
+    if(theTotalTable) {
+      theTotalTable->clearAndDestroy();
+      delete theTotalTable;
+    }
+    for(size_t i=0; i<theFractionTables.size(); ++i) {
+      theFractionTables[i]->clearAndDestroy();
+      delete theFractionTables[i];
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool G4GammaGeneralProcess::IsApplicable(const G4ParticleDefinition& p)
+{
+  return (&p == G4Gamma::Gamma());
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::AddEmProcess(G4VEmProcess* p)
+{
+  if(!p) { return; }
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    if(theProcesses[i] == p) { return; }
+  }
+  theProcesses.push_back(p);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::SetMasterProcess(G4VProcess* masterP)
+{
+  G4VEmProcess::SetMasterProcess(masterP);
+
+  // sub-processes are not known to process manager, so the
+  // master sub-processes are defined here
+  G4GammaGeneralProcess* master =
+    static_cast<G4GammaGeneralProcess*>(masterP);
+  size_t n = theProcesses.size();
+  for(size_t i=0; i<n; ++i) {
+    if(!master || master == this) {
+      theProcesses[i]->SetMasterProcess(theProcesses[i]);
+    } else if(i < master->theProcesses.size()) {
+      theProcesses[i]->SetMasterProcess(master->theProcesses[i]);
+    }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::InitialiseProcess(const G4ParticleDefinition*)
+{}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::PreparePhysicsTable(const G4ParticleDefinition& part)
+{
+  const G4VProcess* masterProc = GetMasterProcess();
+  isTheMaster = (!masterProc || masterProc == this);
+
+  if(isTheMaster) { SetVerboseLevel(param->Verbose()); }
+  else {  SetVerboseLevel(param->WorkerVerbose()); }
+
+  if(1 < verboseLevel) {
+    G4cout << "G4GammaGeneralProcess::PreparePhysicsTable() for "
+           << GetProcessName()
+           << " and particle " << part.GetParticleName()
+           << " with " << theProcesses.size() << " sub-processes"
+           << G4endl;
+  }
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    theProcesses[i]->PreparePhysicsTable(part);
+  }
+  currCouple = nullptr;
+  selectedProcess = nullptr;
+  preStepLambdaTable = preStepLambdaTotal = 0.0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::BuildPhysicsTable(const G4ParticleDefinition& part)
+{
+  if(1 < verboseLevel) {
+    G4cout << "### G4GammaGeneralProcess::BuildPhysicsTable() for "
+           << GetProcessName()
+           << " and particle " << part.GetParticleName()
+           << " isMaster= " << isTheMaster
+           << G4endl;
+  }
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    theProcesses[i]->BuildPhysicsTable(part);
+  }
+
+  // processes with lambda tables are summed in the total table,
+  // others (for example, photo-effect with absorption edges) are 
+  // computed on fly
+  tableProcesses.clear();
+  directProcesses.clear();
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    G4VEmProcess* p = theProcesses[i];
+    if(p->LambdaTable()) {
+      tableProcesses.push_back(p);
+    } else {
+      directProcesses.push_back(p);
+    }
+  }
+  directLambda.resize(directProcesses.size(), 0.0);
+
+  if(isTheMaster) {
+    BuildTotalTable();
+  } else {
+    const G4GammaGeneralProcess* masterProc =
+      static_cast<const G4GammaGeneralProcess*>(GetMasterProcess());
+    theTotalTable = masterProc->theTotalTable;
+    theFractionTables = masterProc->theFractionTables;
+  }
+  idxFraction.resize(theFractionTables.size(), 0);
+  idxTotal = 0;
+
+  if(1 < verboseLevel ||
+     (0 < verboseLevel && isTheMaster && part.GetParticleName() == "gamma")) {
+    G4cout << G4endl << GetProcessName() << ":   for  "
+           << part.GetParticleName()
+           << "    SubType= " << GetProcessSubType() << G4endl;
+    PrintInfo();
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::BuildTotalTable()
+{
+  const G4ProductionCutsTable* theCoupleTable=
+        G4ProductionCutsTable::GetProductionCutsTable();
+  size_t numOfCouples = theCoupleTable->GetTableSize();
+
+  size_t ntab = tableProcesses.size();
+  size_t nfrac = (ntab > 0) ? ntab - 1 : 0;
+
+  // fraction of the last process is not needed
+  for(size_t j=nfrac; j<theFractionTables.size(); ++j) {
+    theFractionTables[j]->clearAndDestroy();
+    delete theFractionTables[j];
+  }
+  theFractionTables.resize(nfrac, nullptr);
+  for(size_t j=0; j<nfrac; ++j) {
+    theFractionTables[j] =
+      G4PhysicsTableHelper::PreparePhysicsTable(theFractionTables[j]);
+  }
+  theTotalTable = G4PhysicsTableHelper::PreparePhysicsTable(theTotalTable);
+  if(0 == ntab) { return; }
+
+  // binning is not coarser than the binning of any sub-process table
+  G4double emin = param->MinKinEnergy();
+  G4double emax = param->MaxKinEnergy();
+  G4double scale = std::log10(emax/emin);
+  G4double nbin = G4double(param->NumberOfBins());
+  for(size_t j=0; j<ntab; ++j) {
+    const G4PhysicsTable* t = tableProcesses[j]->LambdaTable();
+    for(size_t i=0; i<t->length(); ++i) {
+      const G4PhysicsVector* v = (*t)[i];
+      if(v && v->GetVectorLength() > 1 && v->GetMaxEnergy() > v->Energy(0)) {
+        G4double x = (v->GetVectorLength() - 1)*scale
+          /std::log10(v->GetMaxEnergy()/v->Energy(0));
+        nbin = std::max(nbin, x);
+        break;
+      }
+    }
+  }
+  G4int nbins = std::max(G4int(std::ceil(nbin)), 3);
+  G4bool spline = param->Spline();
+  G4bool pack = param->PackedTables();
+  std::vector<G4double> lambda(ntab, 0.0);
+  std::vector<G4PhysicsVector*> frac(nfrac, nullptr);
+
+  for(size_t i=0; i<numOfCouples; ++i) {
+
+    if(!theTotalTable->GetFlag(i) && (*theTotalTable)[i]) { continue; }
+    const G4MaterialCutsCouple* couple =
+      theCoupleTable->GetMaterialCutsCouple(i);
+    currCouple = couple;
+    currCoupleIndex = i;
+
+    delete (*theTotalTable)[i];
+    G4PhysicsVector* total = new G4PhysicsLogVector(emin, emax, nbins);
+    for(size_t j=0; j<nfrac; ++j) {
+      delete (*theFractionTables[j])[i];
+      frac[j] = new G4PhysicsLogVector(emin, emax, nbins);
+    }
+
+    size_t n = total->GetVectorLength();
+    for(size_t k=0; k<n; ++k) {
+      G4double e = total->Energy(k);
+      G4double sum = 0.0;
+      for(size_t j=0; j<ntab; ++j) {
+        lambda[j] = SubProcessLambda(tableProcesses[j], e);
+        sum += lambda[j];
+      }
+      total->PutValue(k, sum);
+
+      // cumulative fractions are monotonic in the index of process
+      // also after linear interpolation
+      G4double cumul = 0.0;
+      for(size_t j=0; j<nfrac; ++j) {
+        cumul += lambda[j];
+        frac[j]->PutValue(k, (sum > 0.0) ? cumul/sum : 1.0);
+      }
+    }
+    if(spline) {
+      total->SetSpline(true);
+      total->FillSecondDerivatives();
+    }
+    if(pack) { total->PackData(); }
+    G4PhysicsTableHelper::SetPhysicsVector(theTotalTable, i, total);
+    for(size_t j=0; j<nfrac; ++j) {
+      if(pack) { frac[j]->PackData(); }
+      G4PhysicsTableHelper::SetPhysicsVector(theFractionTables[j], i, frac[j]);
+    }
+  }
+  currCouple = nullptr;
+
+  if(1 < verboseLevel) {
+    G4cout << "Total cross section table is built for "
+           << GetProcessName() << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::StartTracking(G4Track* track)
+{
+  G4VEmProcess::StartTracking(track);
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    theProcesses[i]->StartTracking(track);
+  }
+  theNumberOfInteractionLengthLeft = -1.0;
+  selectedProcess = nullptr;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::DefineCouple(const G4MaterialCutsCouple* couple)
+{
+  if(couple != currCouple) {
+    currCouple = couple;
+    currCoupleIndex = couple->GetIndex();
+    idxTotal = 0;
+    for(size_t j=0; j<idxFraction.size(); ++j) { idxFraction[j] = 0; }
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double
+G4GammaGeneralProcess::SubProcessLambda(G4VEmProcess* p, G4double e)
+{
+  G4double ee = e;
+  G4double x = p->GetLambda(ee, currCouple);
+  if(!p->SelectModelForMaterial(e, currCoupleIndex)->IsActive(e)) {
+    x = 0.0;
+  }
+  return std::max(x, 0.0);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4GammaGeneralProcess::ComputeLambda(G4double e)
+{
+  const G4PhysicsVector* v =
+    (theTotalTable) ? (*theTotalTable)[currCoupleIndex] : nullptr;
+  preStepLambdaTable = (v) ? v->Value(e, idxTotal) : 0.0;
+  G4double x = preStepLambdaTable;
+  for(size_t j=0; j<directProcesses.size(); ++j) {
+    directLambda[j] = SubProcessLambda(directProcesses[j], e);
+    x += directLambda[j];
+  }
+  return x;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4GammaGeneralProcess::PostStepGetPhysicalInteractionLength(
+                             const G4Track& track,
+                             G4double   previousStepSize,
+                             G4ForceCondition* condition)
+{
+  *condition = NotForced;
+  G4double x = DBL_MAX;
+
+  preStepKinE = track.GetKineticEnergy();
+  DefineCouple(track.GetMaterialCutsCouple());
+  preStepLambdaTotal = ComputeLambda(preStepKinE);
+
+  // zero cross section
+  if(preStepLambdaTotal <= 0.0) {
+    theNumberOfInteractionLengthLeft = -1.0;
+    currentInteractionLength = DBL_MAX;
+    return x;
+  }
+
+  if (theNumberOfInteractionLengthLeft < 0.0) {
+
+    // beggining of tracking (or just after DoIt of this process)
+    theNumberOfInteractionLengthLeft =  -G4Log( G4UniformRand() );
+    theInitialNumberOfInteractionLength = theNumberOfInteractionLengthLeft;
+
+  } else if(currentInteractionLength < DBL_MAX) {
+
+    // subtract NumberOfInteractionLengthLeft using previous step
+    theNumberOfInteractionLengthLeft -=
+      previousStepSize/currentInteractionLength;
+    theNumberOfInteractionLengthLeft =
+      std::max(theNumberOfInteractionLengthLeft, 0.0);
+  }
+
+  // new mean free path and step limit for the next step
+  currentInteractionLength = 1.0/preStepLambdaTotal;
+  x = theNumberOfInteractionLengthLeft * currentInteractionLength;
+  return x;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VParticleChange* G4GammaGeneralProcess::PostStepDoIt(const G4Track& track,
+                                                       const G4Step& step)
+{
+  // In all cases clear number of interaction lengths
+  theNumberOfInteractionLengthLeft = -1.0;
+  selectedProcess = nullptr;
+
+  // gamma energy is not changed along step, so the cross sections
+  // computed at pre-step point are used for selection of the process
+  G4VEmProcess* proc = nullptr;
+  G4double q = G4UniformRand()*preStepLambdaTotal;
+  if(q < preStepLambdaTable) {
+    G4double r = q/preStepLambdaTable;
+    size_t nfrac = theFractionTables.size();
+    size_t k = 0;
+    for(; k<nfrac; ++k) {
+      const G4PhysicsVector* v = (*theFractionTables[k])[currCoupleIndex];
+      if(r <= v->Value(preStepKinE, idxFraction[k])) { break; }
+    }
+    proc = tableProcesses[k];
+  } else {
+    q -= preStepLambdaTable;
+    size_t n = directProcesses.size();
+    for(size_t j=0; j<n; ++j) {
+      if(q < directLambda[j] || j + 1 == n) {
+        proc = directProcesses[j];
+        break;
+      }
+      q -= directLambda[j];
+    }
+  }
+  if(!proc) {
+    fParticleChange.InitializeForPostStep(track);
+    return &fParticleChange;
+  }
+  selectedProcess = proc;
+  proc->CurrentSetup(currCouple, preStepKinE);
+  return proc->PostStepDoIt(track, step);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double G4GammaGeneralProcess::GetMeanFreePath(const G4Track& track,
+                                                G4double,
+                                                G4ForceCondition* condition)
+{
+  *condition = NotForced;
+  G4double x = TotalCrossSectionPerVolume(track.GetKineticEnergy(),
+                                          track.GetMaterialCutsCouple());
+  return (x > 0.0) ? 1.0/x : DBL_MAX;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4double
+G4GammaGeneralProcess::TotalCrossSectionPerVolume(G4double e,
+                                   const G4MaterialCutsCouple* couple)
+{
+  DefineCouple(couple);
+  return ComputeLambda(e);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool G4GammaGeneralProcess::StorePhysicsTable(const G4ParticleDefinition* part,
+                                                const G4String& directory,
+                                                G4bool ascii)
+{
+  G4bool yes = true;
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    if(!theProcesses[i]->StorePhysicsTable(part, directory, ascii)) {
+      yes = false;
+    }
+  }
+  return yes;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4bool
+G4GammaGeneralProcess::RetrievePhysicsTable(const G4ParticleDefinition* part,
+                                            const G4String& directory,
+                                            G4bool ascii)
+{
+  // the total table is built from retrieved tables of sub-processes
+  G4bool yes = true;
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    if(!theProcesses[i]->RetrievePhysicsTable(part, directory, ascii)) {
+      yes = false;
+    }
+  }
+  return yes;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+G4VEmProcess* G4GammaGeneralProcess::GetEmProcess(const G4String& nam) const
+{
+  G4VEmProcess* p = nullptr;
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    if(theProcesses[i]->GetProcessName() == nam) {
+      p = theProcesses[i];
+      break;
+    }
+  }
+  return p;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::PrintInfo()
+{
+  G4cout << "      Total cross section table of";
+  for(size_t i=0; i<tableProcesses.size(); ++i) {
+    G4cout << " " << tableProcesses[i]->GetProcessName();
+  }
+  G4cout << G4endl;
+  if(theTotalTable) {
+    for(size_t i=0; i<theTotalTable->length(); ++i) {
+      const G4PhysicsVector* v = (*theTotalTable)[i];
+      if(v) {
+        G4double emin = v->Energy(0);
+        G4double emax = v->GetMaxEnergy();
+        G4int nbin = v->GetVectorLength() - 1;
+        G4cout << "      from " << G4BestUnit(emin,"Energy")
+               << " to " << G4BestUnit(emax,"Energy")
+               << ", " << G4lrint(nbin/std::log10(emax/emin))
+               << " bins per decade, spline: " << param->Spline()
+               << G4endl;
+        break;
+      }
+    }
+  }
+  if(!directProcesses.empty()) {
+    G4cout << "      Cross section computed on fly for";
+    for(size_t i=0; i<directProcesses.size(); ++i) {
+      G4cout << " " << directProcesses[i]->GetProcessName();
+    }
+    G4cout << G4endl;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4GammaGeneralProcess::ProcessDescription(std::ostream& out) const
+{
+  out << "EM process <" << GetProcessName()
+      << "> combining gamma processes:";
+  for(size_t i=0; i<theProcesses.size(); ++i) {
+    out << " <" << theProcesses[i]->GetProcessName() << ">";
+  }
+  out << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -46,6 +46,7 @@
 // 16-01-07 Fill new (not old) DEDX table (V.Ivanchenko)
 // 12-02-07 Use G4LPhysicsFreeVector for the inverse range table (V.Ivanchenko)
 // 24-06-09 Removed hidden bin in G4PhysicsVector (V.Ivanchenko)
+// 19-10-26 Parallel build of dedx, range and inverse range vectors
 //
 // Class Description:
 //
@@ -72,7 +73,9 @@
 G4LossTableBuilder::G4LossTableBuilder() 
 {
   splineFlag = true;
+  packFlag = false;
   isInitialized = false;
+  nThreads = 1;
 
   theDensityFactor = new std::vector<G4double>;
   theDensityIdx = new std::vector<G4int>;
@@ -102,25 +105,30 @@ G4LossTableBuilder::BuildDEDXTable(G4PhysicsTable* dedxTable,
   size_t nCouples = dedxTable->size();
   if(0 >= nCouples) { return; }
 
-  for (size_t i=0; i<nCouples; ++i) {
+  std::vector<G4PhysicsVector*> vec(nCouples, nullptr);
+  BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
     //    if ((*theFlag)[i]) {
     G4PhysicsLogVector* pv0 = 
       static_cast<G4PhysicsLogVector*>((*(list[0]))[i]);
-    if(pv0) {
-      size_t npoints = pv0->GetVectorLength();
-      G4PhysicsLogVector* pv = new G4PhysicsLogVector(*pv0);
-      pv->SetSpline(splineFlag);
-      for (size_t j=0; j<npoints; ++j) {
-        G4double dedx = 0.0;
-        for (size_t k=0; k<n_processes; ++k) {
-          G4PhysicsVector* pv1   = (*(list[k]))[i];
-          dedx += (*pv1)[j];
-        }
-        pv->PutValue(j, dedx);
+    if(!pv0) { return nullptr; }
+    size_t npoints = pv0->GetVectorLength();
+    G4PhysicsLogVector* pv = new G4PhysicsLogVector(*pv0);
+    pv->SetSpline(splineFlag);
+    for (size_t j=0; j<npoints; ++j) {
+      G4double dedx = 0.0;
+      for (size_t k=0; k<n_processes; ++k) {
+        G4PhysicsVector* pv1   = (*(list[k]))[i];
+        dedx += (*pv1)[j];
       }
-      if(splineFlag) { pv->FillSecondDerivatives(); }
-      G4PhysicsTableHelper::SetPhysicsVector(dedxTable, i, pv);
+      pv->PutValue(j, dedx);
     }
+    if(splineFlag) { pv->FillSecondDerivatives(); }
+    if(packFlag)   { pv->PackData(); }
+    return pv;
+  });
+
+  for (size_t i=0; i<nCouples; ++i) {
+    if(vec[i]) { G4PhysicsTableHelper::SetPhysicsVector(dedxTable, i, vec[i]); }
   }
 }
 
@@ -137,9 +145,13 @@ void G4LossTableBuilder::BuildRangeTable(const G4PhysicsTable* dedxTable,
   size_t n = 100;
   G4double del = 1.0/(G4double)n;
 
-  for (size_t i=0; i<nCouples; ++i) {
+  // flag of the vector for which dedx is exact zero
+  std::vector<char> zeroDEDX(nCouples, 0);
+
+  std::vector<G4PhysicsVector*> vec(nCouples, nullptr);
+  BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
     if(isIonisation) {
-      if( !(*theFlag)[i] ) { continue; }
+      if( !(*theFlag)[i] ) { return nullptr; }
     }
     G4PhysicsLogVector* pv = static_cast<G4PhysicsLogVector*>((*dedxTable)[i]);
     size_t npoints = pv->GetVectorLength();
@@ -168,7 +180,6 @@ void G4LossTableBuilder::BuildRangeTable(const G4PhysicsTable* dedxTable,
     // initialisation of a new vector
     if(npoints < 2) { npoints = 2; }
 
-    delete (*rangeTable)[i];
     G4PhysicsLogVector* v;
     if(0 == bin0) { v = new G4PhysicsLogVector(*pv); }
     else { v = new G4PhysicsLogVector(elow, ehigh, npoints-1); }
@@ -177,8 +188,8 @@ void G4LossTableBuilder::BuildRangeTable(const G4PhysicsTable* dedxTable,
     if(2 == npoints) {
       v->PutValue(0,1000.);
       v->PutValue(1,2000.);
-      G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, v);
-      return;
+      zeroDEDX[i] = 1;
+      return v;
     }
     v->SetSpline(splineFlag);
 
@@ -206,7 +217,22 @@ void G4LossTableBuilder::BuildRangeTable(const G4PhysicsTable* dedxTable,
       energy1 = energy2;
     }
     if(splineFlag) { v->FillSecondDerivatives(); }
-    G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, v);
+    if(packFlag)   { v->PackData(); }
+    return v;
+  });
+
+  // vectors are set in the order of couples; the filling stops after 
+  // a vector with zero dedx as in sequential mode
+  G4bool stop = false;
+  for (size_t i=0; i<nCouples; ++i) {
+    if(!vec[i]) { continue; }
+    if(stop) { 
+      delete vec[i];
+      continue;
+    }
+    delete (*rangeTable)[i];
+    G4PhysicsTableHelper::SetPhysicsVector(rangeTable, i, vec[i]);
+    if(zeroDEDX[i]) { stop = true; }
   }
 }
 
@@ -221,17 +247,17 @@ G4LossTableBuilder::BuildInverseRangeTable(const G4PhysicsTable* rangeTable,
   size_t nCouples = rangeTable->size();
   if(0 >= nCouples) { return; }
 
-  for (size_t i=0; i<nCouples; ++i) {
+  std::vector<G4PhysicsVector*> vec(nCouples, nullptr);
+  BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
 
     if(isIonisation) {
-      if( !(*theFlag)[i] ) { continue; }
+      if( !(*theFlag)[i] ) { return nullptr; }
     }
     G4PhysicsVector* pv = (*rangeTable)[i];
     size_t npoints = pv->GetVectorLength();
     G4double rlow  = (*pv)[0];
     G4double rhigh = (*pv)[npoints-1];
       
-    delete (*invRangeTable)[i];
     G4LPhysicsFreeVector* v = new G4LPhysicsFreeVector(npoints,rlow,rhigh);
     v->SetSpline(splineFlag);
 
@@ -241,9 +267,65 @@ G4LossTableBuilder::BuildInverseRangeTable(const G4PhysicsTable* rangeTable,
       v->PutValues(j,r,e);
     }
     if(splineFlag) { v->FillSecondDerivatives(); }
+    if(packFlag)   { v->PackData(); }
+    return v;
+  });
+
+  for (size_t i=0; i<nCouples; ++i) {
+    if(!vec[i]) { continue; }
+    delete (*invRangeTable)[i];
+    G4PhysicsTableHelper::SetPhysicsVector(invRangeTable, i, vec[i]);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
+
+void G4LossTableBuilder::BuildVectors(std::vector<G4PhysicsVector*>& vec,
+                    const std::function<G4PhysicsVector*(size_t)>& func,
+                    G4bool threadSafe)
+{
+  size_t n = vec.size();
+#ifdef G4MULTITHREADED
+  size_t nthreads = std::min(n, size_t(std::max(nThreads, 1)));
+  if(nthreads > 1 && threadSafe) {
+    // each thread fills every nthreads-th vector, the calling thread
+    // takes the first share
+    std::vector<BuildVectorsTask> tasks(nthreads);
+    std::vector<G4Thread> threads(nthreads);
+    for(size_t t=0; t<nthreads; ++t) {
+      tasks[t].func   = &func;
+      tasks[t].result = &vec;
+      tasks[t].first  = t;
+      tasks[t].step   = nthreads;
+    }
+    for(size_t t=1; t<nthreads; ++t) {
+      G4Thread* th = &threads[t];
+      G4THREADCREATE(th, &G4LossTableBuilder::BuildVectorsThread, &tasks[t]);
+    }
+    BuildVectorsThread(&tasks[0]);
+    for(size_t t=1; t<nthreads; ++t) { G4THREADJOIN(threads[t]); }
+    return;
+  }
+#endif
+  for(size_t i=0; i<n; ++i) { vec[i] = func(i); }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
 
-    G4PhysicsTableHelper::SetPhysicsVector(invRangeTable, i, v);
+G4ThreadFunReturnType 
+G4LossTableBuilder::BuildVectorsThread(G4ThreadFunArgType arg)
+{
+  BuildVectorsTask* task = static_cast<BuildVectorsTask*>(arg);
+  // only the calling thread, which takes the first share, has G4cout
+  G4bool spawned = (task->first > 0);
+  if(spawned) { G4iosInitialization(); }
+  std::vector<G4PhysicsVector*>& vec = *(task->result);
+  size_t n = vec.size();
+  for(size_t i=task->first; i<n; i+=task->step) { 
+    vec[i] = (*(task->func))(i); 
   }
+  if(spawned) { G4iosFinalization(); }
+  return 0;
 }
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -426,44 +508,39 @@ G4LossTableBuilder::BuildTableForModel(G4PhysicsTable* aTable,
         G4ProductionCutsTable::GetProductionCutsTable();
   size_t numOfCouples = theCoupleTable->GetTableSize();
 
-  G4PhysicsLogVector* aVector = 0;
-
+  // lower edges are defined before vectors are filled, possibly
+  // in parallel over couples
+  std::vector<G4double> tmin(numOfCouples, 0.0);
   for(size_t i=0; i<numOfCouples; ++i) {
+    if (GetFlag(i)) {
+      const G4Material* mat = 
+        theCoupleTable->GetMaterialCutsCouple(i)->GetMaterial();
+      tmin[i] = std::max(emin,model->MinPrimaryEnergy(mat,part));
+      if(0.0 >= tmin[i]) { tmin[i] = eV; }
+    }
+  }
 
-    //G4cout<< "i= " << i << " Flag=  " << GetFlag(i) << G4endl;
+  std::vector<G4PhysicsVector*> vec(numOfCouples, nullptr);
+  BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
+    if(!GetFlag(i) || tmin[i] >= emax) { return nullptr; }
+    const G4MaterialCutsCouple* couple = 
+      theCoupleTable->GetMaterialCutsCouple(i);
+    G4int n = nbins*G4int(std::log10(emax/tmin[i]) + 0.5);
+    if(n < 3) { n = 3; }
+    G4PhysicsLogVector* aVector = new G4PhysicsLogVector(tmin[i], emax, n);
+    aVector->SetSpline(spline);
+    for(G4int j=0; j<=n; ++j) {
+      aVector->PutValue(j, model->Value(couple, part, aVector->Energy(j)));
+    }
+    if(spline) { aVector->FillSecondDerivatives(); }
+    if(packFlag) { aVector->PackData(); }
+    return aVector;
+  }, model->ThreadSafeTables());
 
+  for(size_t i=0; i<numOfCouples; ++i) {
     if (GetFlag(i)) {
-
-      // create physics vector and fill it
-      const G4MaterialCutsCouple* couple = 
-        theCoupleTable->GetMaterialCutsCouple(i);
       delete (*table)[i];
-
-      // if start from zero then change the scale
-
-      const G4Material* mat = couple->GetMaterial();
-
-      G4double tmin = std::max(emin,model->MinPrimaryEnergy(mat,part));
-      if(0.0 >= tmin) { tmin = eV; }
-      G4int n = nbins;
-
-      if(tmin >= emax) {
-        aVector = 0;
-      } else {
-        n *= G4int(std::log10(emax/tmin) + 0.5);
-        if(n < 3) { n = 3; }
-        aVector = new G4PhysicsLogVector(tmin, emax, n);
-      }
-
-      if(aVector) {
-        aVector->SetSpline(spline);
-        for(G4int j=0; j<=n; ++j) {
-          aVector->PutValue(j, model->Value(couple, part, 
-                                            aVector->Energy(j)));
-        }
-        if(spline) { aVector->FillSecondDerivatives(); }
-      }
-      G4PhysicsTableHelper::SetPhysicsVector(table, i, aVector);
+      G4PhysicsTableHelper::SetPhysicsVector(table, i, vec[i]);
     }
   }
   /*
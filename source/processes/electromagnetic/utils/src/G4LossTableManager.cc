@@ -258,6 +258,8 @@ void G4LossTableManager::ResetParameters()
     verbose = theParameters->WorkerVerbose();
   }
   tableBuilder->SetSplineFlag(theParameters->Spline());
+  tableBuilder->SetPackFlag(theParameters->PackedTables());
+  tableBuilder->SetNumberOfThreads(theParameters->NumberOfThreadsForTables());
   tableBuilder->SetInitialisationFlag(false); 
   emCorrections->SetVerbose(verbose); 
   if(emSaturation) { emSaturation->SetVerbose(verbose); } 
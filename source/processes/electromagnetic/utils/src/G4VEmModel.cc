@@ -82,6 +82,7 @@ G4VEmModel::G4VEmModel(const G4String& nam):
   localTable = true;
   useAngularGenerator = false;
   isLocked = false;
+  threadSafeTables = nullptr;
   idxTable = 0;
 
   fManager = G4LossTableManager::Instance();
@@ -267,14 +268,13 @@ G4double G4VEmModel::CrossSectionPerVolume(const G4Material* material,
   const G4double* theAtomNumDensityVector = 
     material->GetVecNbOfAtomsPerVolume();
   G4int nelm = material->GetNumberOfElements(); 
-  if(nelm > nsec) {
-    xsec.resize(nelm);
-    nsec = nelm;
-  }
+  // current element is not changed if tables may be built in parallel
+  G4bool safe = ThreadSafeTables();
   for (G4int i=0; i<nelm; ++i) {
-    cross += theAtomNumDensityVector[i]*
-      ComputeCrossSectionPerAtom(p,(*theElementVector)[i],ekin,emin,emax);
-    xsec[i] = cross;
+    const G4Element* elm = (*theElementVector)[i];
+    cross += theAtomNumDensityVector[i]*(safe 
+      ? ComputeCrossSectionPerAtom(p,ekin,elm->GetZ(),elm->GetN(),emin,emax)
+      : ComputeCrossSectionPerAtom(p,elm,ekin,emin,emax));
   }
   return cross;
 }
@@ -296,8 +296,21 @@ const G4Element* G4VEmModel::SelectRandomAtom(const G4Material* material,
   G4int n = material->GetNumberOfElements() - 1;
   fCurrentElement = (*theElementVector)[n];
   if (n > 0) {
-    G4double x = G4UniformRand()*
-      G4VEmModel::CrossSectionPerVolume(material,pd,kinEnergy,tcut,tmax);
+    SetupForMaterial(pd, material, kinEnergy);
+    const G4double* theAtomNumDensityVector = 
+      material->GetVecNbOfAtomsPerVolume();
+    if(n >= nsec) {
+      nsec = n + 1;
+      xsec.resize(nsec);
+    }
+    G4double cross = 0.0;
+    for (G4int i=0; i<=n; ++i) {
+      cross += theAtomNumDensityVector[i]*
+        ComputeCrossSectionPerAtom(pd,(*theElementVector)[i],kinEnergy,
+                                   tcut,tmax);
+      xsec[i] = cross;
+    }
+    G4double x = G4UniformRand()*cross;
     for(G4int i=0; i<n; ++i) {
       if (x <= xsec[i]) {
         fCurrentElement = (*theElementVector)[i];
@@ -369,7 +382,7 @@ void G4VEmModel::CorrectionsAlongStep(const G4MaterialCutsCouple*,
 G4double G4VEmModel::Value(const G4MaterialCutsCouple* couple,
                            const G4ParticleDefinition* p, G4double e)
 {
-  SetCurrentCouple(couple);
+  if(!ThreadSafeTables()) { SetCurrentCouple(couple); }
   return e*e*CrossSectionPerVolume(couple->GetMaterial(),p,e,0.0,DBL_MAX);
 }
 
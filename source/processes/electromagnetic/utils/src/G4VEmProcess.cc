@@ -81,9 +81,11 @@
 #include "G4Electron.hh"
 #include "G4Positron.hh"
 #include "G4PhysicsTableHelper.hh"
+#include "G4PhysicsTableArchive.hh"
 #include "G4EmBiasingManager.hh"
 #include "G4GenericIon.hh"
 #include "G4Log.hh"
+#include "G4EmProfiler.hh"
 #include <iostream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -107,6 +109,7 @@ G4VEmProcess::G4VEmProcess(const G4String& name, G4ProcessType type):
   currentCouple(nullptr)
 {
   theParameters = G4EmParameters::Instance();
+  profiler = 0;
   SetVerboseLevel(1);
 
   // Size of tables assuming spline
@@ -440,10 +443,8 @@ void G4VEmProcess::BuildLambdaTable()
   size_t numOfCouples = theCoupleTable->GetTableSize();
 
   G4LossTableBuilder* bld = lManager->GetTableBuilder();
-
-  G4PhysicsLogVector* aVector = nullptr;
-  G4PhysicsLogVector* aVectorPrim = nullptr;
-  G4PhysicsLogVector* bVectorPrim = nullptr;
+  G4bool threadSafe = modelManager->ThreadSafeTables();
+  G4bool packFlag = theParameters->PackedTables();
 
   G4double scale = 
     G4Log(theParameters->MaxKinEnergy()/theParameters->MinKinEnergy()); 
@@ -451,60 +452,77 @@ void G4VEmProcess::BuildLambdaTable()
   if(actBinning) { nbin = std::max(nbin, nLambdaBins); }
   G4double emax1 = std::min(maxKinEnergy, minKinEnergyPrim);
   if(!actSpline) { splineFlag = theParameters->Spline(); }
-    
-  for(size_t i=0; i<numOfCouples; ++i) {
-
-    if (bld->GetFlag(i)) {
-
-      // create physics vector and fill it
-      const G4MaterialCutsCouple* couple = 
-        theCoupleTable->GetMaterialCutsCouple(i);
 
-      // build main table
-      if(buildLambdaTable) {
-        delete (*theLambdaTable)[i];
+  // build main table
+  if(buildLambdaTable) {
 
-        // if start from zero then change the scale
-        G4double emin = minKinEnergy;
-        G4bool startNull = false;
-        if(startFromNull) {
-          G4double e = MinPrimaryEnergy(particle,couple->GetMaterial());
-          if(e >= emin) {
-            emin = e;
-            startNull = true;
+    // lower edges are defined before vectors are filled, possibly 
+    // in parallel over couples
+    std::vector<G4double> emin(numOfCouples, minKinEnergy);
+    std::vector<G4bool> startNull(numOfCouples, false);
+    if(startFromNull) {
+      for(size_t i=0; i<numOfCouples; ++i) {
+        if (bld->GetFlag(i)) {
+          G4double e = MinPrimaryEnergy(particle,
+                     theCoupleTable->GetMaterialCutsCouple(i)->GetMaterial());
+          if(e >= emin[i]) {
+            emin[i] = e;
+            startNull[i] = true;
           }
         }
-        G4double emax = emax1;
-        if(emax <= emin) { emax = 2*emin; }
-        G4int bin = G4lrint(nbin*G4Log(emax/emin)/scale);
-        if(bin < 3) { bin = 3; }
-        aVector = new G4PhysicsLogVector(emin, emax, bin);
-        aVector->SetSpline(splineFlag);
-        modelManager->FillLambdaVector(aVector, couple, startNull);
-        if(splineFlag) { aVector->FillSecondDerivatives(); }
-        G4PhysicsTableHelper::SetPhysicsVector(theLambdaTable, i, aVector);
       }
-      // build high energy table 
-      if(minKinEnergyPrim < maxKinEnergy) { 
-        delete (*theLambdaTablePrim)[i];
+    }
 
-        // start not from zero
-        if(!bVectorPrim) {
-          G4int bin = G4lrint(nbin*G4Log(maxKinEnergy/minKinEnergyPrim)/scale);
-          if(bin < 3) { bin = 3; }
-          aVectorPrim = 
-            new G4PhysicsLogVector(minKinEnergyPrim, maxKinEnergy, bin);
-          bVectorPrim = aVectorPrim;
-        } else {
-          aVectorPrim = new G4PhysicsLogVector(*bVectorPrim);
-        }
-        // always use spline
-        aVectorPrim->SetSpline(splineFlag);
-        modelManager->FillLambdaVector(aVectorPrim, couple, false, 
-                                       fIsCrossSectionPrim);
-        aVectorPrim->FillSecondDerivatives();
+    std::vector<G4PhysicsVector*> vec(numOfCouples, nullptr);
+    bld->BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
+      if(!bld->GetFlag(i)) { return nullptr; }
+      G4double emax = emax1;
+      if(emax <= emin[i]) { emax = 2*emin[i]; }
+      G4int bin = G4lrint(nbin*G4Log(emax/emin[i])/scale);
+      if(bin < 3) { bin = 3; }
+      G4PhysicsLogVector* aVector = 
+        new G4PhysicsLogVector(emin[i], emax, bin);
+      aVector->SetSpline(splineFlag);
+      modelManager->FillLambdaVector(aVector, 
+                                     theCoupleTable->GetMaterialCutsCouple(i),
+                                     startNull[i]);
+      if(splineFlag) { aVector->FillSecondDerivatives(); }
+      if(packFlag) { aVector->PackData(); }
+      return aVector;
+    }, threadSafe);
+
+    for(size_t i=0; i<numOfCouples; ++i) {
+      if (bld->GetFlag(i)) {
+        delete (*theLambdaTable)[i];
+        G4PhysicsTableHelper::SetPhysicsVector(theLambdaTable, i, vec[i]);
+      }
+    }
+  }
+  // build high energy table, start not from zero 
+  if(minKinEnergyPrim < maxKinEnergy) { 
+    G4int bin = G4lrint(nbin*G4Log(maxKinEnergy/minKinEnergyPrim)/scale);
+    if(bin < 3) { bin = 3; }
+
+    std::vector<G4PhysicsVector*> vec(numOfCouples, nullptr);
+    bld->BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
+      if(!bld->GetFlag(i)) { return nullptr; }
+      G4PhysicsLogVector* aVectorPrim = 
+        new G4PhysicsLogVector(minKinEnergyPrim, maxKinEnergy, bin);
+      // always use spline
+      aVectorPrim->SetSpline(splineFlag);
+      modelManager->FillLambdaVector(aVectorPrim, 
+                                     theCoupleTable->GetMaterialCutsCouple(i),
+                                     false, fIsCrossSectionPrim);
+      aVectorPrim->FillSecondDerivatives();
+      if(packFlag) { aVectorPrim->PackData(); }
+      return aVectorPrim;
+    }, threadSafe);
+
+    for(size_t i=0; i<numOfCouples; ++i) {
+      if (bld->GetFlag(i)) {
+        delete (*theLambdaTablePrim)[i];
         G4PhysicsTableHelper::SetPhysicsVector(theLambdaTablePrim, i, 
-                                               aVectorPrim);
+                                               vec[i]);
       }
     }
   }
@@ -599,6 +617,7 @@ void G4VEmProcess::StartTracking(G4Track* track)
   currentParticle = track->GetParticleDefinition();
   theNumberOfInteractionLengthLeft = -1.0;
   mfpKinEnergy = DBL_MAX; 
+  profiler = (theParameters->ProfilerActive()) ? G4EmProfiler::Instance() : 0;
 
   // forced biasing only for primary particles
   if(biasManager) {
@@ -697,6 +716,9 @@ G4double G4VEmProcess::PostStepGetPhysicalInteractionLength(
 G4VParticleChange* G4VEmProcess::PostStepDoIt(const G4Track& track,
                                               const G4Step& step)
 {
+  G4EmProfileScope scope(profiler, this, currentModel, &fParticleChange, 
+                         step, false);
+
   // In all cases clear number of interaction lengths
   theNumberOfInteractionLengthLeft = -1.0;
   mfpKinEnergy = DBL_MAX; 
@@ -861,7 +883,11 @@ G4bool G4VEmProcess::StorePhysicsTable(const G4ParticleDefinition* part,
   if ( theLambdaTable && part == particle) {
     const G4String name = 
       GetPhysicsTableFileName(part,directory,"Lambda",ascii);
-    yes = theLambdaTable->StorePhysicsTable(name,ascii);
+    if(theParameters->MappedTables() && !ascii) {
+      yes = G4PhysicsTableArchive::Store(theLambdaTable,name);
+    } else {
+      yes = theLambdaTable->StorePhysicsTable(name,ascii);
+    }
 
     if ( yes ) {
       G4cout << "Physics table is stored for " << particle->GetParticleName()
@@ -879,7 +905,11 @@ G4bool G4VEmProcess::StorePhysicsTable(const G4ParticleDefinition* part,
   if ( theLambdaTablePrim && part == particle) {
     const G4String name = 
       GetPhysicsTableFileName(part,directory,"LambdaPrim",ascii);
-    yes = theLambdaTablePrim->StorePhysicsTable(name,ascii);
+    if(theParameters->MappedTables() && !ascii) {
+      yes = G4PhysicsTableArchive::Store(theLambdaTablePrim,name);
+    } else {
+      yes = theLambdaTablePrim->StorePhysicsTable(name,ascii);
+    }
 
     if ( yes ) {
       G4cout << "Physics table prim is stored for " 
@@ -936,6 +966,7 @@ G4bool G4VEmProcess::RetrievePhysicsTable(const G4ParticleDefinition* part,
           }
         }
       }
+      if(theParameters->PackedTables()) { theLambdaTable->PackData(); }
     } else {
       if (1 < verboseLevel) {
         G4cout << "Lambda table for " << particleName << " in file <"
@@ -963,6 +994,7 @@ G4bool G4VEmProcess::RetrievePhysicsTable(const G4ParticleDefinition* part,
           }
         }
       }
+      if(theParameters->PackedTables()) { theLambdaTablePrim->PackData(); }
     } else {
       if (1 < verboseLevel) {
         G4cout << "Lambda table prim for " << particleName << " in file <"
@@ -153,6 +153,7 @@
 #include "G4Region.hh"
 #include "G4RegionStore.hh"
 #include "G4PhysicsTableHelper.hh"
+#include "G4PhysicsTableArchive.hh"
 #include "G4SafetyHelper.hh"
 #include "G4TransportationManager.hh"
 #include "G4EmConfigurator.hh"
@@ -160,6 +161,7 @@
 #include "G4VSubCutProducer.hh"
 #include "G4EmBiasingManager.hh"
 #include "G4Log.hh"
+#include "G4EmProfiler.hh"
 #include <iostream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -199,6 +201,7 @@ G4VEnergyLossProcess::G4VEnergyLossProcess(const G4String& name,
   mfpKinEnergy(0.0)
 {
   theParameters = G4EmParameters::Instance();
+  profiler = 0;
   SetVerboseLevel(1);
 
   // low energy limit
@@ -840,8 +843,22 @@ G4PhysicsTable* G4VEnergyLossProcess::BuildDEDXTable(G4EmTableType tType)
 
   G4LossTableBuilder* bld = lManager->GetTableBuilder();
   G4bool splineFlag = theParameters->Spline();
-  G4PhysicsLogVector* aVector = nullptr;
-  G4PhysicsLogVector* bVector = nullptr;
+  G4bool packFlag = theParameters->PackedTables();
+
+  // vectors of different couples may be filled in parallel
+  std::vector<G4PhysicsVector*> vec(numOfCouples, nullptr);
+  bld->BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
+    if(!bld->GetFlag(i)) { return nullptr; }
+    G4PhysicsLogVector* aVector = 
+      new G4PhysicsLogVector(minKinEnergy, emax, bin);
+    aVector->SetSpline(splineFlag);
+    modelManager->FillDEDXVector(aVector, 
+                                 theCoupleTable->GetMaterialCutsCouple(i), 
+                                 tType);
+    if(splineFlag) { aVector->FillSecondDerivatives(); }
+    if(packFlag)   { aVector->PackData(); }
+    return aVector;
+  }, modelManager->ThreadSafeTables());
 
   for(size_t i=0; i<numOfCouples; ++i) {
 
@@ -851,24 +868,10 @@ G4PhysicsTable* G4VEnergyLossProcess::BuildDEDXTable(G4EmTableType tType)
              << " Flag= " << bld->GetFlag(i) << G4endl;
     }
     if(bld->GetFlag(i)) {
-
-      // create physics vector and fill it
-      const G4MaterialCutsCouple* couple = 
-        theCoupleTable->GetMaterialCutsCouple(i);
       if((*table)[i]) { delete (*table)[i]; }
-      if(bVector) {
-        aVector = new G4PhysicsLogVector(*bVector);
-      } else {
-        bVector = new G4PhysicsLogVector(minKinEnergy, emax, bin);
-        aVector = bVector;
-      }
-      aVector->SetSpline(splineFlag);
-
-      modelManager->FillDEDXVector(aVector, couple, tType);
-      if(splineFlag) { aVector->FillSecondDerivatives(); }
 
       // Insert vector for this material into the table
-      G4PhysicsTableHelper::SetPhysicsVector(table, i, aVector);
+      G4PhysicsTableHelper::SetPhysicsVector(table, i, vec[i]);
     }
   }
 
@@ -919,38 +922,48 @@ G4PhysicsTable* G4VEnergyLossProcess::BuildLambdaTable(G4EmTableType tType)
   theDensityIdx = bld->GetCoupleIndexes();
 
   G4bool splineFlag = theParameters->Spline();
-  G4PhysicsLogVector* aVector = nullptr;
+  G4bool packFlag = theParameters->PackedTables();
   G4double scale = G4Log(maxKinEnergy/minKinEnergy);
 
+  // lower edges are defined before vectors are filled, possibly 
+  // in parallel over couples
+  std::vector<G4double> emin(numOfCouples, minKinEnergy);
+  std::vector<G4bool> startNull(numOfCouples, false);
   for(size_t i=0; i<numOfCouples; ++i) {
-
     if (bld->GetFlag(i)) {
-
-      // create physics vector and fill it
-      const G4MaterialCutsCouple* couple = 
-        theCoupleTable->GetMaterialCutsCouple(i);
-      delete (*table)[i];
-
-      G4bool startNull = true;
-      G4double emin = 
-        MinPrimaryEnergy(particle,couple->GetMaterial(),(*theCuts)[i]);
-      if(minKinEnergy > emin) { 
-        emin = minKinEnergy; 
-        startNull = false;
+      G4double e = MinPrimaryEnergy(particle,
+                     theCoupleTable->GetMaterialCutsCouple(i)->GetMaterial(),
+                     (*theCuts)[i]);
+      if(minKinEnergy <= e) { 
+        emin[i] = e; 
+        startNull[i] = true;
       }
+    }
+  }
 
-      G4double emax = maxKinEnergy;
-      if(emax <= emin) { emax = 2*emin; }
-      G4int bin = G4lrint(nBins*G4Log(emax/emin)/scale);
-      bin = std::max(bin, 3);
-      aVector = new G4PhysicsLogVector(emin, emax, bin);
-      aVector->SetSpline(splineFlag);
+  std::vector<G4PhysicsVector*> vec(numOfCouples, nullptr);
+  bld->BuildVectors(vec, [&](size_t i) -> G4PhysicsVector* {
+    if(!bld->GetFlag(i)) { return nullptr; }
+    G4double emax = maxKinEnergy;
+    if(emax <= emin[i]) { emax = 2*emin[i]; }
+    G4int bin = G4lrint(nBins*G4Log(emax/emin[i])/scale);
+    bin = std::max(bin, 3);
+    G4PhysicsLogVector* aVector = new G4PhysicsLogVector(emin[i], emax, bin);
+    aVector->SetSpline(splineFlag);
+    modelManager->FillLambdaVector(aVector, 
+                                   theCoupleTable->GetMaterialCutsCouple(i), 
+                                   startNull[i], tType);
+    if(splineFlag) { aVector->FillSecondDerivatives(); }
+    if(packFlag)   { aVector->PackData(); }
+    return aVector;
+  }, modelManager->ThreadSafeTables());
 
-      modelManager->FillLambdaVector(aVector, couple, startNull, tType);
-      if(splineFlag) { aVector->FillSecondDerivatives(); }
+  for(size_t i=0; i<numOfCouples; ++i) {
+    if (bld->GetFlag(i)) {
+      delete (*table)[i];
 
       // Insert vector for this material into the table
-      G4PhysicsTableHelper::SetPhysicsVector(table, i, aVector);
+      G4PhysicsTableHelper::SetPhysicsVector(table, i, vec[i]);
     }
   }
 
@@ -1083,6 +1096,7 @@ void G4VEnergyLossProcess::StartTracking(G4Track* track)
   theNumberOfInteractionLengthLeft = -1.0;
   currentInteractionLength = mfpKinEnergy = DBL_MAX; 
   preStepRangeEnergy = 0.0;
+  profiler = (theParameters->ProfilerActive()) ? G4EmProfiler::Instance() : 0;
 
   // reset ion
   if(isIon) {
@@ -1245,6 +1259,8 @@ G4double G4VEnergyLossProcess::PostStepGetPhysicalInteractionLength(
 G4VParticleChange* G4VEnergyLossProcess::AlongStepDoIt(const G4Track& track,
                                                        const G4Step& step)
 {
+  G4EmProfileScope scope(profiler, this, currentModel, &fParticleChange, 
+                         step, true);
   fParticleChange.InitializeForAlongStep(track);
   // The process has range table - calculate energy loss
   if(!isIonisation || !currentModel->IsActive(preStepScaledEnergy)) {
@@ -1616,6 +1632,9 @@ G4VEnergyLossProcess::SampleSubCutSecondaries(std::vector<G4Track*>& tracks,
 G4VParticleChange* G4VEnergyLossProcess::PostStepDoIt(const G4Track& track,
                                                       const G4Step& step)
 {
+  G4EmProfileScope scope(profiler, this, currentModel, &fParticleChange, 
+                         step, false);
+
   // In all cases clear number of interaction lengths
   theNumberOfInteractionLengthLeft = -1.0;
   mfpKinEnergy = currentInteractionLength = DBL_MAX; 
@@ -1889,7 +1908,9 @@ G4bool G4VEnergyLossProcess::StoreTable(const G4ParticleDefinition* part,
     const G4String name = GetPhysicsTableFileName(part,directory,tname,ascii);
     G4cout << name << G4endl;
     //G4cout << *aTable << G4endl;
-    if( !aTable->StorePhysicsTable(name,ascii)) res = false;
+    if(theParameters->MappedTables() && !ascii) {
+      res = G4PhysicsTableArchive::Store(aTable,name);
+    } else if( !aTable->StorePhysicsTable(name,ascii)) { res = false; }
   }
   return res;
 }
@@ -1916,6 +1937,7 @@ G4VEnergyLossProcess::RetrieveTable(const G4ParticleDefinition* part,
             if((*aTable)[i]) { (*aTable)[i]->SetSpline(true); }
           }
         }
+        if(theParameters->PackedTables()) { aTable->PackData(); }
         if (0 < verboseLevel) {
           G4cout << tname << " table for " << part->GetParticleName() 
                  << " is Retrieved from <" << filename << ">"
@@ -84,6 +84,7 @@
 #include "G4ParticleTable.hh"
 #include "G4ProcessVector.hh"
 #include "G4ProcessManager.hh"
+#include "G4EmProfiler.hh"
 #include <iostream>
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo....
@@ -107,6 +108,7 @@ G4VMultipleScattering::G4VMultipleScattering(const G4String& name,
   fNewDirection(0.,0.,1.)
 {
   theParameters = G4EmParameters::Instance();
+  profiler = 0;
   SetVerboseLevel(1);
   SetProcessSubType(fMultipleScattering);
   if("ionmsc" == name) { firstParticle = G4GenericIon::GenericIon(); }
@@ -375,6 +377,7 @@ void G4VMultipleScattering::PrintInfoDefinition()
 
 void G4VMultipleScattering::StartTracking(G4Track* track)
 {
+  profiler = (theParameters->ProfilerActive()) ? G4EmProfiler::Instance() : 0;
   G4VEnergyLossProcess* eloss = nullptr;
   if(track->GetParticleDefinition() != currParticle) {
     currParticle = track->GetParticleDefinition();
@@ -475,6 +478,9 @@ G4VMultipleScattering::PostStepGetPhysicalInteractionLength(
 G4VParticleChange* 
 G4VMultipleScattering::AlongStepDoIt(const G4Track& track, const G4Step& step)
 {
+  G4VEmModel* mscModel = currentModel;
+  G4EmProfileScope scope(profiler, this, mscModel, 0, step, true);
+
   fParticleChange.ProposeMomentumDirection(
     step.GetPostStepPoint()->GetMomentumDirection());
   fNewPosition = step.GetPostStepPoint()->GetPosition();
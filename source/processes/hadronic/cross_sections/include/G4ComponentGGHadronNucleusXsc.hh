@@ -33,6 +33,7 @@
 //
 //
 // 25.04.12 V. Grichine - first implementation based on G4GlauberGribovCrossSection old interface
+// 19.10.26 optional shared tables of cross sections (G4ComponentGGXscTable)
 //
 //
 
@@ -44,6 +45,8 @@
 #include "G4Nucleus.hh"
 
 #include "G4VComponentCrossSection.hh"
+#include "G4ComponentGGXscTable.hh"
+#include <map>
 
 class G4ParticleDefinition;
 class G4HadronNucleonXsc;
@@ -159,6 +162,12 @@ virtual
 
 private:
 
+  // analytic calculation of all cross sections
+  G4double ComputeIsoCrossSection(const G4DynamicParticle*, G4int Z, G4int A);
+
+  const G4ComponentGGXscTable::XscData* GetTableData(const G4ParticleDefinition*,
+                                                      G4int Z, G4int A);
+
 //  const G4double fUpperLimit;
   G4double fLowerLimit; 
   const G4double fRadiusConst;
@@ -211,6 +220,12 @@ private:
 
   G4HadronNucleonXsc* hnXsc;
 
+  // thread local access to shared tables
+  const G4ParticleDefinition* fTableParticle;
+  G4int fTableZA;
+  const G4ComponentGGXscTable::XscData* fTableData;
+  std::map<std::pair<const G4ParticleDefinition*,G4int>,
+           const G4ComponentGGXscTable::XscData*> fTableCache;
 };
 
 ////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 //
 //
 // 24.11.08 V. Grichine - first implementation based on G4GlauberGribovCrossSection
+// 19.10.26 optional shared tables of cross sections (G4ComponentGGXscTable)
 //
 //
 
@@ -43,6 +44,8 @@
 #include "G4NistManager.hh"
 
 #include "G4VComponentCrossSection.hh"
+#include "G4ComponentGGXscTable.hh"
+#include <map>
 
 class G4ParticleDefinition;
 class G4HadronNucleonXsc;
@@ -152,6 +155,12 @@ public:
 
 private:
 
+  // analytic calculation of all cross sections
+  G4double ComputeZandACrossSection(const G4DynamicParticle*, G4int Z, G4int A);
+
+  const G4ComponentGGXscTable::XscData* GetTableData(const G4ParticleDefinition*,
+                                                      G4int Z, G4int A);
+
 //  const G4double fUpperLimit;
   G4double fLowerLimit; 
   const G4double fRadiusConst;
@@ -167,6 +176,14 @@ private:
   G4DynamicParticle cacheDP;
   G4DynamicParticle dProton;
   G4DynamicParticle dNeutron;
+
+  // thread local access to shared tables, keyed by 1000*Z + A of
+  // the projectile and of the target
+  const G4ParticleDefinition* fTableParticle;
+  G4int fTableZA;
+  const G4ComponentGGXscTable::XscData* fTableData;
+  std::map<std::pair<G4int,G4int>,
+           const G4ComponentGGXscTable::XscData*> fTableCache;
 };
 
 ////////////////////////////////////////////////////////////////
@@ -0,0 +1,125 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// Tables of Glauber-Gribov cross sections (total, inelastic, elastic,
+// production, diffraction) on a logarithmic grid of kinetic energy 
+// (per nucleon for nuclei), per projectile and target nucleus. The
+// projectile is identified by an integer code given by the user of the
+// tables, the PDG code of a hadron or 1000*Z + A of a nucleus.
+// Tables are built on first use of a projectile and target and are 
+// shared by all threads. At build time the linear interpolation is 
+// compared with the computation at the centre of each bin; bins where
+// it differs more than the tolerance are flagged and the cross 
+// sections are computed analytically there.
+// The tables are inactive by default, they may be activated by
+// SetActive(true) or the environment variable G4GG_XS_TABLES. 
+//
+//
+// 19.10.26 - first implementation
+//
+//
+
+#ifndef G4ComponentGGXscTable_h
+#define G4ComponentGGXscTable_h 1
+
+#include "globals.hh"
+#include "G4Threading.hh"
+#include "G4Log.hh"
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+
+class G4ComponentGGXscTable
+{
+public:
+
+  // total, inelastic, elastic, production, diffraction
+  enum { nXsc = 5 };
+
+  struct XscData {
+    std::vector<G4double> node;   // [node*nXsc + component]
+    std::vector<G4bool> analytic; // per bin
+  };
+
+  // fills the nXsc cross sections for a kinetic energy
+  typedef std::function<void(G4double, G4double*)> XscFunction;
+
+  G4ComponentGGXscTable(G4double emin, G4double emax,
+                        G4int binsPerDecade, G4double tolerance);
+
+  ~G4ComponentGGXscTable();
+
+  // Shared data for the projectile and target, built by the function 
+  // on first use
+  const XscData* GetData(G4int projectile, G4int Z, G4int A, 
+                         const XscFunction&);
+
+  // Interpolated cross sections, false if the energy is outside tables
+  // or the bin should be computed analytically
+  inline G4bool GetCrossSections(const XscData*, G4double e, 
+                                 G4double* xsc) const;
+
+  static void SetActive(G4bool val);
+  static G4bool IsActive();
+
+private:
+
+  G4ComponentGGXscTable & operator=(const G4ComponentGGXscTable &right);
+  G4ComponentGGXscTable(const G4ComponentGGXscTable&);
+
+  typedef std::pair<G4int, G4int> XscKey;
+
+  std::map<XscKey, XscData*> fData;
+
+  G4double fEmin;
+  G4double fEmax;
+  G4double fLogEmin;
+  G4double fInvLogStep;
+  G4double fTolerance;
+  G4int fBins;
+  std::vector<G4double> fEnergy;
+
+  static G4bool fActive;
+  static G4Mutex fMutex;
+};
+
+inline G4bool 
+G4ComponentGGXscTable::GetCrossSections(const XscData* data, G4double e,
+                                        G4double* xsc) const
+{
+  if(e < fEmin || e > fEmax) { return false; }
+  G4double x = (G4Log(e) - fLogEmin)*fInvLogStep;
+  G4int bin = std::min(G4int(x), fBins-1);
+  if(data->analytic[bin]) { return false; }
+  x -= bin;
+  const G4double* y1 = &(data->node[bin*nXsc]);
+  const G4double* y2 = y1 + nXsc;
+  for(G4int i=0; i<nXsc; ++i) { xsc[i] = y1[i] + (y2[i] - y1[i])*x; }
+  return true;
+}
+
+#endif
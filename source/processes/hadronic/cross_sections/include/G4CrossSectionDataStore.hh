@@ -31,6 +31,7 @@
 // Modifications:
 // 23.01.2009 V.Ivanchenko move constructor and destructor to source,
 //                         use STL vector instead of C-array
+// 19.10.2026 memo of element cross sections (G4CrossSectionMemo)
 //
 // August 2011  Re-designed
 //              by G. Folger, V. Ivantchenko, T. Koi and D.H. Wright
@@ -48,6 +49,7 @@
 #include "globals.hh"
 #include "G4VCrossSectionDataSet.hh"
 #include "G4FastPathHadronicCrossSection.hh"
+#include "G4CrossSectionMemo.hh"
 #include "G4DynamicParticle.hh"
 #include "G4PhysicsVector.hh"
 #include <vector>
@@ -98,6 +100,9 @@ public:
 
   inline void SetVerboseLevel(G4int value);
 
+  // Statistics of the cross section memo, if it is active
+  void DumpMemoStatistics(std::ostream&) const;
+
 private:
 
   G4double GetIsoCrossSection(const G4DynamicParticle*, G4int Z, G4int A,
@@ -129,6 +134,10 @@ private:
 
   G4int nDataSetList;
   G4int verboseLevel;
+
+  // thread local memo of element cross sections, if activated
+  G4CrossSectionMemo* memo;
+
   //Fast path: caching
 public:
   inline const G4FastPathHadronicCrossSection::fastPathParameters&
@@ -0,0 +1,160 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// -------------------------------------------------------------------
+// File name:     G4CrossSectionMemo
+//
+// Creation date: 19 October 2026
+//
+// Modifications:
+//
+
+// Class Description
+// Memo of element cross sections of a G4CrossSectionDataStore on a 
+// logarithmic energy grid per particle and material. Values at grid
+// nodes are computed by the data set chain on first use. A bin is 
+// interpolated only if the interpolation at its centre agrees with the
+// direct computation within the tolerance, otherwise the data sets
+// are called for each request in this bin. The memo is used for the 
+// cross section per volume and the partial sums of SampleZandA, 
+// it is owned by the data store and so is thread local.
+// Parameters are common to all data stores and are applied at
+// initialisation; the memo is inactive by default, it may be
+// activated by the environment variable G4HADRONIC_XS_MEMO.
+// Class Description - End
+
+#ifndef G4CrossSectionMemo_h
+#define G4CrossSectionMemo_h 1
+
+#include "globals.hh"
+#include "G4DynamicParticle.hh"
+#include <vector>
+#include <map>
+#include <iostream>
+
+class G4CrossSectionDataStore;
+class G4ParticleDefinition;
+class G4Element;
+class G4Material;
+
+class G4CrossSectionMemo
+{
+public:
+
+  G4CrossSectionMemo();
+
+  ~G4CrossSectionMemo();
+
+  // Clear memo and apply parameters, called at initialisation
+  void Initialise();
+
+  // Select table for the particle and material, returns false if 
+  // the energy is outside the memo range
+  inline G4bool SelectTable(const G4DynamicParticle*, const G4Material*);
+
+  // Element cross section for the element of index idx in the material 
+  // of the selected table
+  G4double GetElementCrossSection(G4CrossSectionDataStore*,
+                                  const G4DynamicParticle*, G4int idx,
+                                  const G4Element*, const G4Material*);
+
+  void DumpStatistics(std::ostream&) const;
+
+  // Common parameters
+  static void SetActive(G4bool val);
+  static G4bool IsActive();
+
+  static void SetEnergyRange(G4double emin, G4double emax);
+  static void SetBinsPerDecade(G4int val);
+  static void SetTolerance(G4double val);
+
+private:
+
+  struct MemoTable {
+    G4int nElements;
+    std::vector<G4double> node;   // [node*nElements + element], <0 not computed
+    std::vector<G4int> state;     // [bin*nElements + element]
+  };
+
+  enum { notChecked = 0, interpolated, direct };
+
+  G4bool FindTable(const G4ParticleDefinition*, const G4Material*);
+
+  G4double NodeValue(G4CrossSectionDataStore*, G4int node, G4int idx,
+                     const G4Element*, const G4Material*);
+
+  G4double Compute(G4CrossSectionDataStore*, G4double e,
+                   const G4Element*, const G4Material*);
+
+  G4CrossSectionMemo & operator=(const G4CrossSectionMemo &right);
+  G4CrossSectionMemo(const G4CrossSectionMemo&);
+
+  std::map<const G4ParticleDefinition*, std::vector<MemoTable*> > tables;
+
+  // last selected table
+  const G4ParticleDefinition* lastParticle;
+  const G4Material* lastMaterial;
+  MemoTable* table;
+
+  G4DynamicParticle* probe;
+
+  G4double emin;
+  G4double emax;
+  G4double logEmin;
+  G4double invLogStep;
+  G4double tolerance;
+  G4int nBins;
+  std::vector<G4double> nodeEnergy;
+
+  // statistics
+  G4double nInterpolated;
+  G4double nDirect;
+  G4double nOutOfRange;
+  G4double nComputed;
+  G4int nCheckedBins;
+  G4int nDirectBins;
+
+  static G4bool active;
+  static G4double defEmin;
+  static G4double defEmax;
+  static G4int defBinsPerDecade;
+  static G4double defTolerance;
+};
+
+inline G4bool 
+G4CrossSectionMemo::SelectTable(const G4DynamicParticle* part, 
+                                const G4Material* mat)
+{
+  G4double e = part->GetKineticEnergy();
+  if(e < emin || e > emax) {
+    nOutOfRange += 1.0;
+    return false; 
+  }
+  return (part->GetDefinition() == lastParticle && mat == lastMaterial) 
+    ? true : FindTable(part->GetDefinition(), mat);
+}
+
+#endif
@@ -70,9 +70,11 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_xsect
 	G4ComponentBarNucleonNucleusXsc.hh
 	G4ComponentGGHadronNucleusXsc.hh
 	G4ComponentGGNuclNuclXsc.hh
+	G4ComponentGGXscTable.hh
 	G4ComponentSAIDTotalXS.hh
 	G4CrossSectionDataSetRegistry.hh
 	G4CrossSectionDataStore.hh
+	G4CrossSectionMemo.hh
 	G4CrossSectionElastic.hh
 	G4CrossSectionFactory.hh
 	G4CrossSectionInelastic.hh
@@ -140,9 +142,11 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_xsect
 	G4ComponentBarNucleonNucleusXsc.cc
 	G4ComponentGGHadronNucleusXsc.cc
 	G4ComponentGGNuclNuclXsc.cc
+	G4ComponentGGXscTable.cc
 	G4ComponentSAIDTotalXS.cc
 	G4CrossSectionDataSetRegistry.cc
 	G4CrossSectionDataStore.cc
+	G4CrossSectionMemo.cc
 	G4CrossSectionElastic.cc
 	G4CrossSectionInelastic.cc
 	G4CrossSectionPairGG.cc
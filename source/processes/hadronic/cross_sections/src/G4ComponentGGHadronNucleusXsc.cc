@@ -26,6 +26,7 @@
 // author: V. Grichine
 // 
 // 25.04.12 V. Grichine - first implementation
+// 19.10.26 optional shared tables of cross sections
 
 #include "G4ComponentGGHadronNucleusXsc.hh"
 
@@ -40,6 +41,13 @@
 #include "G4Exp.hh"
 #include "G4Pow.hh"
 
+namespace
+{
+  // shared by all threads, keyed by PDG code of hadrons, for A > 1 only 
+  // as H values are not complete
+  G4ComponentGGXscTable hadronNucleusTables(10*MeV, 100*TeV, 20, 0.001);
+}
+
 //////////////////////////////////////////////////////////////////////////////
 //
 
@@ -49,7 +57,8 @@ G4ComponentGGHadronNucleusXsc::G4ComponentGGHadronNucleusXsc()
    fLowerLimit(10.*MeV),// fLowerLimit(3*GeV),
    fRadiusConst(1.08*fermi),  // 1.1, 1.3 ?
    fTotalXsc(0.0), fElasticXsc(0.0), fInelasticXsc(0.0), fProductionXsc(0.0),
-   fDiffractionXsc(0.0)
+   fDiffractionXsc(0.0),
+   fTableParticle(0), fTableZA(0), fTableData(0)
 // , fHadronNucleonXsc(0.0)
 {
   theGamma    = G4Gamma::Gamma();
@@ -296,6 +305,73 @@ G4ComponentGGHadronNucleusXsc::GetIsoCrossSection(const G4DynamicParticle* aPart
 						const G4Isotope*,
 						const G4Element*,
 						const G4Material*)
+{
+  const G4ParticleDefinition* theParticle = aParticle->GetDefinition();
+  if( A > 1 && G4ComponentGGXscTable::IsActive() &&
+      theParticle->GetPDGEncoding() != 0 && 
+      std::abs(theParticle->GetBaryonNumber()) <= 1 )
+  {
+    G4double xsc[G4ComponentGGXscTable::nXsc];
+    if( hadronNucleusTables.GetCrossSections(
+          GetTableData(theParticle, Z, A), 
+          aParticle->GetKineticEnergy(), xsc) )
+    {
+      fTotalXsc       = xsc[0];
+      fInelasticXsc   = xsc[1];
+      fElasticXsc     = xsc[2];
+      fProductionXsc  = xsc[3];
+      fDiffractionXsc = xsc[4];
+      return fTotalXsc;
+    }
+  }
+  return ComputeIsoCrossSection(aParticle, Z, A);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+//
+// Tables of the projectile and target nucleus, built by this thread if
+// not yet available
+
+const G4ComponentGGXscTable::XscData* 
+G4ComponentGGHadronNucleusXsc::GetTableData(const G4ParticleDefinition* theParticle,
+                                            G4int Z, G4int A)
+{
+  G4int za = 1000*Z + A;
+  if( theParticle == fTableParticle && za == fTableZA ) return fTableData;
+
+  fTableParticle = theParticle;
+  fTableZA = za;
+  std::pair<const G4ParticleDefinition*,G4int> key(theParticle, za);
+  std::map<std::pair<const G4ParticleDefinition*,G4int>,
+           const G4ComponentGGXscTable::XscData*>::iterator it = fTableCache.find(key);
+  if( it != fTableCache.end() )
+  {
+    fTableData = it->second;
+  }
+  else
+  {
+    G4DynamicParticle dp(theParticle, G4ParticleMomentum(1.,0.,0.), 0.);
+    fTableData = hadronNucleusTables.GetData(theParticle->GetPDGEncoding(), Z, A,
+      [this, &dp, Z, A](G4double e, G4double* xsc)
+      {
+        dp.SetKineticEnergy(e);
+        ComputeIsoCrossSection(&dp, Z, A);
+        xsc[0] = fTotalXsc;
+        xsc[1] = fInelasticXsc;
+        xsc[2] = fElasticXsc;
+        xsc[3] = fProductionXsc;
+        xsc[4] = fDiffractionXsc;
+      });
+    fTableCache[key] = fTableData;
+  }
+  return fTableData;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////
+
+G4double 
+G4ComponentGGHadronNucleusXsc::ComputeIsoCrossSection(const G4DynamicParticle* aParticle, 
+                                                      G4int Z, G4int A)
 {
   G4double xsection, sigma, cofInelastic, cofTotal, nucleusSquare, ratio;
   G4double hpInXsc(0.), hnInXsc(0.);
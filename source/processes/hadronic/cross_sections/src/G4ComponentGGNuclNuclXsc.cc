@@ -24,6 +24,7 @@
 // ********************************************************************
 //
 // 24.11.08 V. Grichine - first implementation
+// 19.10.26 optional shared tables of cross sections
 //
 
 #include "G4ComponentGGNuclNuclXsc.hh"
@@ -36,6 +37,14 @@
 #include "G4HadTmpUtil.hh"
 #include "G4HadronNucleonXsc.hh"
 
+namespace
+{
+  // shared by all threads, energy per nucleon, keyed by 1000*Z + A of 
+  // the projectile and of the target; a table is built for each pair
+  // of nuclei met in the run (about 20 kB per pair)
+  G4ComponentGGXscTable nuclNuclTables(10*MeV, 100*TeV, 20, 0.001);
+}
+
 
 G4ComponentGGNuclNuclXsc::G4ComponentGGNuclNuclXsc() 
  : G4VComponentCrossSection("Glauber-Gribov nucleus nucleus"),
@@ -46,7 +55,8 @@ G4ComponentGGNuclNuclXsc::G4ComponentGGNuclNuclXsc()
    fDiffractionXsc(0.0),
     cacheDP(G4Proton::Proton(),G4ParticleMomentum(1.,0,0),0),
     dProton(G4Proton::Proton(),G4ParticleMomentum(1.,0,0),0),
-    dNeutron(G4Neutron::Neutron(),G4ParticleMomentum(1.,0,0),0)
+    dNeutron(G4Neutron::Neutron(),G4ParticleMomentum(1.,0,0),0),
+    fTableParticle(0), fTableZA(0), fTableData(0)
 // , fHadronNucleonXsc(0.0)
 {
   theProton   = G4Proton::Proton();
@@ -203,6 +213,74 @@ GetElementCrossSection(const G4DynamicParticle* aParticle, G4int Z,
 G4double G4ComponentGGNuclNuclXsc::
 GetZandACrossSection(const G4DynamicParticle* aParticle,
                      G4int tZ, G4int tA)
+{
+  const G4ParticleDefinition* theParticle = aParticle->GetDefinition();
+  if( G4ComponentGGXscTable::IsActive() && theParticle->GetBaryonNumber() > 0 )
+  {
+    G4double xsc[G4ComponentGGXscTable::nXsc];
+    if( nuclNuclTables.GetCrossSections(GetTableData(theParticle, tZ, tA), 
+          aParticle->GetKineticEnergy()/theParticle->GetBaryonNumber(), xsc) )
+    {
+      fTotalXsc      = xsc[0];
+      fInelasticXsc  = xsc[1];
+      fElasticXsc    = xsc[2];
+      fProductionXsc = xsc[3];
+      return fInelasticXsc;
+    }
+  }
+  return ComputeZandACrossSection(aParticle, tZ, tA);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Tables of the projectile and target nucleus, built by this thread if
+// not yet available; ions and fragments with the same Z and A, in any
+// excitation state, share the table; diffraction is not computed here
+
+const G4ComponentGGXscTable::XscData* G4ComponentGGNuclNuclXsc::
+GetTableData(const G4ParticleDefinition* theParticle, G4int tZ, G4int tA)
+{
+  G4int za = 1000*tZ + tA;
+  if( theParticle == fTableParticle && za == fTableZA ) return fTableData;
+
+  fTableParticle = theParticle;
+  fTableZA = za;
+  G4int projectile = 1000*G4lrint(theParticle->GetPDGCharge()/eplus) 
+                     + theParticle->GetBaryonNumber();
+  std::pair<G4int,G4int> key(projectile, za);
+  std::map<std::pair<G4int,G4int>,
+           const G4ComponentGGXscTable::XscData*>::iterator it = fTableCache.find(key);
+  if( it != fTableCache.end() )
+  {
+    fTableData = it->second;
+  }
+  else
+  {
+    G4double pA = theParticle->GetBaryonNumber();
+    G4DynamicParticle dp(theParticle, G4ParticleMomentum(1.,0.,0.), 0.);
+    fTableData = nuclNuclTables.GetData(projectile, tZ, tA,
+      [this, &dp, pA, tZ, tA](G4double e, G4double* xsc)
+      {
+        dp.SetKineticEnergy(e*pA);
+        ComputeZandACrossSection(&dp, tZ, tA);
+        xsc[0] = fTotalXsc;
+        xsc[1] = fInelasticXsc;
+        xsc[2] = fElasticXsc;
+        xsc[3] = fProductionXsc;
+        xsc[4] = 0.0;
+      });
+    fTableCache[key] = fTableData;
+  }
+  return fTableData;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+//
+// Analytic calculation
+
+G4double G4ComponentGGNuclNuclXsc::
+ComputeZandACrossSection(const G4DynamicParticle* aParticle,
+                         G4int tZ, G4int tA)
 {
   G4double xsection;
   G4double sigma;
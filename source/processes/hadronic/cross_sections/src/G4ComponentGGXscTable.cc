@@ -0,0 +1,113 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 19.10.26 - first implementation
+
+#include "G4ComponentGGXscTable.hh"
+#include "G4AutoLock.hh"
+#include "G4Exp.hh"
+#include <cstdlib>
+
+G4bool G4ComponentGGXscTable::fActive = (getenv("G4GG_XS_TABLES") != 0);
+G4Mutex G4ComponentGGXscTable::fMutex = G4MUTEX_INITIALIZER;
+
+//////////////////////////////////////////////////////////////////////////////
+//
+
+G4ComponentGGXscTable::G4ComponentGGXscTable(G4double emin, G4double emax,
+                                             G4int binsPerDecade,
+                                             G4double tolerance)
+  : fEmin(emin), fEmax(emax), fTolerance(tolerance)
+{
+  fLogEmin = G4Log(fEmin);
+  G4double logRange = G4Log(fEmax) - fLogEmin;
+  fBins = std::max(1, G4int(logRange*binsPerDecade/G4Log(10.) + 0.5));
+  fInvLogStep = fBins/logRange;
+  fEnergy.resize(fBins+1);
+  for(G4int i=0; i<=fBins; ++i) { fEnergy[i] = G4Exp(fLogEmin + i/fInvLogStep); }
+  fEnergy[0] = fEmin;
+  fEnergy[fBins] = fEmax;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+
+G4ComponentGGXscTable::~G4ComponentGGXscTable()
+{
+  std::map<XscKey, XscData*>::iterator it = fData.begin();
+  for(; it != fData.end(); ++it) { delete it->second; }
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+// Data are built under lock by the calling thread with its own
+// instance of the cross section component
+
+const G4ComponentGGXscTable::XscData* 
+G4ComponentGGXscTable::GetData(G4int projectile, G4int Z, G4int A,
+                               const XscFunction& compute)
+{
+  G4AutoLock l(&fMutex);
+  XscKey key(projectile, 1000*Z + A);
+  std::map<XscKey, XscData*>::iterator it = fData.find(key);
+  if(it != fData.end()) { return it->second; }
+
+  XscData* data = new XscData();
+  data->node.resize((fBins+1)*nXsc, 0.0);
+  data->analytic.resize(fBins, false);
+  for(G4int i=0; i<=fBins; ++i) { compute(fEnergy[i], &(data->node[i*nXsc])); }
+
+  G4double xsc[nXsc];
+  for(G4int i=0; i<fBins; ++i) {
+    compute(std::sqrt(fEnergy[i]*fEnergy[i+1]), xsc);
+    const G4double* y1 = &(data->node[i*nXsc]);
+    const G4double* y2 = y1 + nXsc;
+    for(G4int j=0; j<nXsc; ++j) {
+      if(std::abs(0.5*(y1[j] + y2[j]) - xsc[j]) > fTolerance*xsc[j]) {
+        data->analytic[i] = true;
+        break;
+      }
+    }
+  }
+  fData[key] = data;
+  return data;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+
+void G4ComponentGGXscTable::SetActive(G4bool val)
+{
+  fActive = val;
+}
+
+//////////////////////////////////////////////////////////////////////////////
+//
+
+G4bool G4ComponentGGXscTable::IsActive()
+{
+  return fActive;
+}
@@ -38,6 +38,8 @@
 // 14.03.2011 V.Ivanchenko fixed DumpPhysicsTable
 // 15.08.2011 G.Folger, V.Ivanchenko, T.Koi, D.Wright redesign the class
 // 07.03.2013 M.Maire cosmetic in DumpPhysicsTable
+// 19.10.2026 use G4CrossSectionMemo for cross section per volume and
+//            element selection, if activated
 //
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -61,7 +63,7 @@
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 G4CrossSectionDataStore::G4CrossSectionDataStore() :
-  nDataSetList(0), verboseLevel(0),fastPathFlags(),fastPathParams(),
+  nDataSetList(0), verboseLevel(0), memo(0), fastPathFlags(),fastPathParams(),
   counters(),fastPathCache()
 {
   nist = G4NistManager::Instance();
@@ -74,7 +76,9 @@ G4CrossSectionDataStore::G4CrossSectionDataStore() :
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
 G4CrossSectionDataStore::~G4CrossSectionDataStore()
-{}
+{
+  delete memo;
+}
 
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -229,10 +233,20 @@ G4CrossSectionDataStore::GetCrossSection(const G4DynamicParticle* part,
 
 	  if(G4int(xsecelm.size()) < nElements) { xsecelm.resize(nElements); }
 
-	  for(G4int i=0; i<nElements; ++i) {
-		  matCrossSection += nAtomsPerVolume[i] *
-				  GetCrossSection(part, (*mat->GetElementVector())[i], mat);
-		  xsecelm[i] = matCrossSection;
+	  //The memo is not used to build the fast-path
+	  if ( memo != nullptr && !fastPathFlags.initializationPhase
+		  && memo->SelectTable(part, mat) ) {
+		  for(G4int i=0; i<nElements; ++i) {
+			  matCrossSection += nAtomsPerVolume[i] *
+					  memo->GetElementCrossSection(this, part, i, (*mat->GetElementVector())[i], mat);
+			  xsecelm[i] = matCrossSection;
+		  }
+	  } else {
+		  for(G4int i=0; i<nElements; ++i) {
+			  matCrossSection += nAtomsPerVolume[i] *
+					  GetCrossSection(part, (*mat->GetElementVector())[i], mat);
+			  xsecelm[i] = matCrossSection;
+		  }
 	  }
   }
   //Stop measurement of cpu cycles
@@ -507,6 +521,15 @@ G4CrossSectionDataStore::BuildPhysicsTable(const G4ParticleDefinition& aParticle
   for (G4int i=0; i<nDataSetList; ++i) {
     dataSetList[i]->BuildPhysicsTable(aParticleType);
   } 
+  if (G4CrossSectionMemo::IsActive()) {
+    if (!memo) { memo = new G4CrossSectionMemo(); }
+    memo->Initialise();
+  } else if (memo) {
+    delete memo;
+    memo = 0;
+  }
+  // results of the previous run are not kept
+  currentMaterial = elmMaterial = 0;
   //A.Dotti: if fast-path has been requested we can now create the surrogate
   //         model for fast path.
   if ( fastPathFlags.useFastPathIfAvailable ) {
@@ -531,6 +554,13 @@ G4CrossSectionDataStore::BuildPhysicsTable(const G4ParticleDefinition& aParticle
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
+void G4CrossSectionDataStore::DumpMemoStatistics(std::ostream& os) const
+{
+  if (memo) { memo->DumpStatistics(os); }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
 void G4CrossSectionDataStore::ActivateFastPath( const G4ParticleDefinition* pdef, const G4Material* mat, G4double min_cutoff)
 {
 	assert(pdef!=nullptr&&mat!=nullptr);
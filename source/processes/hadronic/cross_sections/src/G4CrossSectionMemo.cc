@@ -0,0 +1,245 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// -------------------------------------------------------------------
+//
+// GEANT4 Class file
+//
+//
+// File name:     G4CrossSectionMemo
+//
+// Creation date: 19 October 2026
+//
+// Modifications:
+//
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+#include "G4CrossSectionMemo.hh"
+#include "G4CrossSectionDataStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4Element.hh"
+#include "G4Material.hh"
+#include "G4Log.hh"
+#include "G4Exp.hh"
+#include <cstdlib>
+
+G4bool G4CrossSectionMemo::active = (getenv("G4HADRONIC_XS_MEMO") != 0);
+G4double G4CrossSectionMemo::defEmin = 20*MeV;
+G4double G4CrossSectionMemo::defEmax = 100*TeV;
+G4int G4CrossSectionMemo::defBinsPerDecade = 20;
+G4double G4CrossSectionMemo::defTolerance = 0.001;
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4CrossSectionMemo::G4CrossSectionMemo()
+  : lastParticle(0), lastMaterial(0), table(0),
+    emin(0.0), emax(0.0), logEmin(0.0), invLogStep(0.0), 
+    tolerance(0.0), nBins(0),
+    nInterpolated(0.0), nDirect(0.0), nOutOfRange(0.0), nComputed(0.0),
+    nCheckedBins(0), nDirectBins(0)
+{
+  probe = new G4DynamicParticle();
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4CrossSectionMemo::~G4CrossSectionMemo()
+{
+  Initialise();
+  delete probe;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::Initialise()
+{
+  std::map<const G4ParticleDefinition*, std::vector<MemoTable*> >::iterator
+    it = tables.begin();
+  for(; it != tables.end(); ++it) {
+    for(size_t i=0; i<(it->second).size(); ++i) { delete (it->second)[i]; }
+  }
+  tables.clear();
+  lastParticle = 0;
+  lastMaterial = 0;
+  table = 0;
+
+  emin = defEmin;
+  emax = defEmax;
+  logEmin = G4Log(emin);
+  G4double step = G4Log(10.)/G4double(defBinsPerDecade);
+  invLogStep = 1.0/step;
+  nBins = std::max(1, G4int((G4Log(emax) - logEmin)*invLogStep + 0.5));
+  invLogStep = G4double(nBins)/(G4Log(emax) - logEmin);
+  nodeEnergy.resize(nBins+1);
+  for(G4int i=0; i<=nBins; ++i) { 
+    nodeEnergy[i] = G4Exp(logEmin + i/invLogStep); 
+  }
+  nodeEnergy[0] = emin;
+  nodeEnergy[nBins] = emax;
+  tolerance = defTolerance;
+
+  nInterpolated = nDirect = nOutOfRange = nComputed = 0.0;
+  nCheckedBins = nDirectBins = 0;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4bool G4CrossSectionMemo::FindTable(const G4ParticleDefinition* part, 
+                                     const G4Material* mat)
+{
+  lastParticle = part;
+  lastMaterial = mat;
+  std::vector<MemoTable*>& v = tables[part];
+  size_t idx = mat->GetIndex();
+  if(v.size() <= idx) { v.resize(idx+1, 0); }
+  if(!v[idx]) {
+    MemoTable* t = new MemoTable();
+    t->nElements = mat->GetNumberOfElements();
+    t->node.resize((nBins+1)*t->nElements, -1.0);
+    t->state.resize(nBins*t->nElements, notChecked);
+    v[idx] = t;
+  }
+  table = v[idx];
+  return true;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4double 
+G4CrossSectionMemo::GetElementCrossSection(G4CrossSectionDataStore* store,
+                                           const G4DynamicParticle* part, 
+                                           G4int idx,
+                                           const G4Element* elm, 
+                                           const G4Material* mat)
+{
+  G4double x = (G4Log(part->GetKineticEnergy()) - logEmin)*invLogStep;
+  G4int bin = std::min(std::max(G4int(x), 0), nBins-1);
+  G4int n = table->nElements;
+  G4int& st = table->state[bin*n + idx];
+
+  if(notChecked == st) {
+    G4double x1 = NodeValue(store, bin, idx, elm, mat);
+    G4double x2 = NodeValue(store, bin+1, idx, elm, mat);
+    G4double xm = Compute(store, std::sqrt(nodeEnergy[bin]*nodeEnergy[bin+1]),
+                          elm, mat);
+    ++nCheckedBins;
+    if(std::abs(0.5*(x1 + x2) - xm) <= tolerance*xm) { 
+      st = interpolated; 
+    } else { 
+      st = direct; 
+      ++nDirectBins;
+    }
+  }
+  if(interpolated == st) {
+    nInterpolated += 1.0;
+    G4double x1 = table->node[bin*n + idx];
+    return x1 + (table->node[(bin+1)*n + idx] - x1)*(x - bin);
+  }
+  nDirect += 1.0;
+  return store->GetCrossSection(part, elm, mat);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4double G4CrossSectionMemo::NodeValue(G4CrossSectionDataStore* store,
+                                       G4int node, G4int idx,
+                                       const G4Element* elm, 
+                                       const G4Material* mat)
+{
+  G4double& y = table->node[node*table->nElements + idx];
+  if(y < 0.0) { y = Compute(store, nodeEnergy[node], elm, mat); }
+  return y;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4double G4CrossSectionMemo::Compute(G4CrossSectionDataStore* store,
+                                     G4double e,
+                                     const G4Element* elm, 
+                                     const G4Material* mat)
+{
+  nComputed += 1.0;
+  probe->SetDefinition(lastParticle);
+  probe->SetKineticEnergy(e);
+  return std::max(store->GetCrossSection(probe, elm, mat), 0.0);
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::DumpStatistics(std::ostream& os) const
+{
+  G4double nCalls = nInterpolated + nDirect + nOutOfRange;
+  os << "  Cross section memo: " << nCalls << " element requests, "
+     << nInterpolated << " interpolated, " << nDirect << " direct, "
+     << nOutOfRange << " out of range ";
+  if(nCalls > 0.0) {
+    os << "(hit rate " << 100.*nInterpolated/nCalls << " %)";
+  }
+  os << "\n    " << nComputed << " data set calls for nodes and checks, "
+     << nCheckedBins << " bins checked, " << nDirectBins 
+     << " above tolerance " << tolerance << G4endl;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::SetActive(G4bool val)
+{
+  active = val;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+G4bool G4CrossSectionMemo::IsActive()
+{
+  return active;
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::SetEnergyRange(G4double e1, G4double e2)
+{
+  if(e1 > 0.0 && e2 > e1) {
+    defEmin = e1;
+    defEmax = e2;
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::SetBinsPerDecade(G4int val)
+{
+  if(val > 0) { defBinsPerDecade = val; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
+void G4CrossSectionMemo::SetTolerance(G4double val)
+{
+  if(val >= 0.0) { defTolerance = val; }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
@@ -205,6 +205,9 @@ public:
 
   void SetProcessRelLevel(G4double relativeLevel);
 
+  // Statistics of cross section memo of processes of this thread
+  void DumpCrossSectionMemo();
+
 private:
 
   // constructor
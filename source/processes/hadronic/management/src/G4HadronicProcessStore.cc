@@ -920,6 +920,16 @@ void G4HadronicProcessStore::SetEpReportLevel(G4int level)
 
 //....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
 
+void G4HadronicProcessStore::DumpCrossSectionMemo()
+{
+  for (G4int i = 0; i < G4int(process.size()); ++i) {
+    G4cout << " Process: " << process[i]->GetProcessName() << G4endl;
+    process[i]->GetCrossSectionDataStore()->DumpMemoStatistics(G4cout);
+  }
+}
+
+//....oooOO0OOooo........oooOO0OOooo........oooOO0OOooo........oooOO0OOooo.....
+
 void G4HadronicProcessStore::SetProcessAbsLevel(G4double abslevel)
 {
   G4cout << " Setting absolute energy/momentum test level to " << abslevel 
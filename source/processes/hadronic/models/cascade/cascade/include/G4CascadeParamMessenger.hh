@@ -32,6 +32,7 @@
 // 20130703  M. Kelsey -- Add flag for USE_PHASESPACE
 // 20141030  M. Kelsey -- Add flag to enable direct pi-N absorption
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to double, for energy cut
+// 20261019  Add command for size of nuclear model cache
 
 #ifndef G4CascadeParamMessenger_hh
 #define G4CascadeParamMessenger_hh
@@ -87,6 +88,8 @@ private:
   G4UIcmdWithADouble*   nucFermiScaleCmd;
   G4UIcmdWithADouble*   nucXsecScaleCmd;
   G4UIcmdWithADouble*   nucGammaQDCmd;
+  G4UIcmdWithAnInteger* nucCacheSizeCmd;
+  G4UIcmdWithABool*     nucCacheStatsCmd;
   G4UIcmdWithADouble*   coalDPmax2Cmd;
   G4UIcmdWithADouble*   coalDPmax3Cmd;
   G4UIcmdWithADouble*   coalDPmax4Cmd;
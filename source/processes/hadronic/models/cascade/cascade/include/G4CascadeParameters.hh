@@ -34,6 +34,7 @@
 // 20140311  G. Cosmo -- Implement standard (non-const) singleton pattern
 // 20141030  M. Kelsey -- Add flag to enable direct pi-N absorption
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to double, for energy cut
+// 20261019  Add size of per-thread cache of nuclear model configurations
 
 #ifndef G4CascadeParameters_hh
 #define G4CascadeParameters_hh 1
@@ -69,6 +70,8 @@ public:
   static G4double fermiScale()     { return Instance()->FERMI_SCALE; }
   static G4double xsecScale()      { return Instance()->XSEC_SCALE; }
   static G4double gammaQDScale()   { return Instance()->GAMMAQD_SCALE; }
+  static G4int modelCacheSize()    { return Instance()->MODEL_CACHE; }
+  static G4bool modelCacheStats()  { return Instance()->MODEL_CACHE_STATS; }
 
   // Final-state clustering cuts
   static G4double dpMaxDoublet() { return Instance()->DPMAX_DOUBLET; }
@@ -96,6 +99,8 @@ private:	// Environment variable values, null pointers mean not set
   const char* G4NUCMODEL_FERMI_SCALE;
   const char* G4NUCMODEL_XSEC_SCALE;
   const char* G4NUCMODEL_GAMMAQD;
+  const char* G4NUCMODEL_CACHE_SIZE;
+  const char* G4NUCMODEL_CACHE_STATS;
   const char* DPMAX_2CLUSTER;
   const char* DPMAX_3CLUSTER;
   const char* DPMAX_4CLUSTER;
@@ -121,6 +126,8 @@ private:	// Environment variable values, null pointers mean not set
   G4double FERMI_SCALE;
   G4double XSEC_SCALE;
   G4double GAMMAQD_SCALE;
+  G4int MODEL_CACHE;
+  G4bool MODEL_CACHE_STATS;
 
   G4double DPMAX_DOUBLET;	// Final-state clustering cuts
   G4double DPMAX_TRIPLET;
@@ -56,6 +56,7 @@
 // 20130628  Add function to split dibaryon into particle_kinds list
 // 20141009  M. Kelsey -- Add pion absorption by single nucleons, with
 //		nuclear recoil.  Improves pi- capture performance.
+// 20261019  Add buffer for three-body momenta in muon absorption
 
 #ifndef G4ELEMENTARY_PARTICLE_COLLIDER_HH
 #define G4ELEMENTARY_PARTICLE_COLLIDER_HH
@@ -65,6 +66,7 @@
 #include "G4CascadeInterpolator.hh"
 #include "G4InuclElementaryParticle.hh"
 #include "G4LorentzVector.hh"
+#include "G4ThreeVector.hh"
 #include <iosfwd>
 #include <vector>
 
@@ -119,6 +121,7 @@ private:
   // Internal buffers for lists of secondaries
   std::vector<G4InuclElementaryParticle> particles;
   std::vector<G4LorentzVector> scm_momentums;
+  std::vector<G4ThreeVector> momenta3;	// From G4GDecay3
   std::vector<G4double> modules;
   std::vector<G4double> masses;
   std::vector<G4double> masses2;
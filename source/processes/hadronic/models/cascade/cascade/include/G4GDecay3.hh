@@ -50,6 +50,9 @@ class G4GDecay3 {
   
     std::vector<G4ThreeVector> GetThreeBodyMomenta();
 
+    // Fill caller's buffer; empty on failure
+    void GetThreeBodyMomenta(std::vector<G4ThreeVector>& pVect);
+
   private:
     G4bool CalculateMomentumMagnitudes();
 
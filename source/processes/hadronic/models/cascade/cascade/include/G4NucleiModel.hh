@@ -74,11 +74,14 @@
 // 20131001  M. Kelsey -- Move QDinterp object to data member, thread local
 // 20140116  M. Kelsey -- Move statics to const data members to avoid weird
 //		interactions with MT.
+// 20261019  Add buffers for trajectory CDF in choosePointAlongTraj()
+// 20261019  Add LRU cache of nuclear configurations, keyed by (A,Z)
 
 #ifndef G4NUCLEI_MODEL_HH
 #define G4NUCLEI_MODEL_HH
 
 #include <algorithm>
+#include <iosfwd>
 #include <vector>
 
 #include "G4InuclElementaryParticle.hh"
@@ -109,6 +112,11 @@ public:
 
   void printModel() const; 
 
+  // Statistics for cache of nuclear configurations
+  G4int getCacheHits() const { return cacheHits; }
+  G4double getSetupTimeSaved() const { return setupTimeSaved; }	// seconds
+  void printCacheStatistics(std::ostream& os) const;
+
   G4double getDensity(G4int ip, G4int izone) const {
     return nucleon_densities[ip - 1][izone];
   }
@@ -221,6 +229,10 @@ protected:
 
   void fillPotentials(G4int type, G4double tot_vol);
 
+  // Cache of fully built configurations; least recently used is replaced
+  G4bool fetchFromCache(G4int a, G4int z);
+  void storeInCache(G4double buildTime);
+
   G4double zoneIntegralWoodsSaxon(G4double ur1, G4double ur2,
 				  G4double nuclearRadius) const;
 
@@ -259,6 +271,9 @@ private:
 
   std::vector<G4ThreeVector> collisionPts;
 
+  std::vector<G4double> traj_wtlen;	// for choosePointAlongTraj()
+  std::vector<G4double> traj_len;
+
   // Temporary buffers for computing nuclear model
   G4double ur[7];		// Number of skin depths for each zone
   G4double v[6];		// Density integrals by zone
@@ -291,6 +306,27 @@ private:
   G4int current_nucl1;
   G4int current_nucl2;
 
+  struct ModelConfig {
+    G4int A, Z;
+    G4int number_of_zones;
+    G4double nuclei_radius;
+    G4double nuclei_volume;
+    std::vector<std::vector<G4double> > nucleon_densities;
+    std::vector<std::vector<G4double> > zone_potentials;
+    std::vector<std::vector<G4double> > fermi_momenta;
+    std::vector<G4double> zone_radii;
+    std::vector<G4double> zone_volumes;
+    std::vector<G4double> binding_energies;
+    G4double buildTime;		// Seconds to generate configuration
+    unsigned long lastUsed;	// Sequence number for LRU replacement
+  };
+
+  std::vector<ModelConfig> modelCache;
+  const size_t modelCacheSize;
+  unsigned long cacheSequence;
+  G4int cacheHits;
+  G4double setupTimeSaved;
+
   G4CascadeInterpolator<30> gammaQDinterp;	// quasideuteron interpolator
 
   // Symbolic names for nuclear potentials
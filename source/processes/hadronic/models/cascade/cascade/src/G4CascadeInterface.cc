@@ -102,6 +102,7 @@
 // 20140929  M. Kelsey -- Explicitly call useCascadeDeexcitation() in ctor
 // 20150506  M. Kelsey -- Call Initialize() in ctor for master thread only
 // 20150608  M. Kelsey -- Label all while loops as terminating.
+// 20261019  Preallocate output list in copyOutputToReactionProducts()
 
 #include <cmath>
 #include <iostream>
@@ -589,6 +590,7 @@ G4ReactionProductVector* G4CascadeInterface::copyOutputToReactionProducts() {
   const std::vector<G4InuclNuclei>& fragments = output->getOutgoingNuclei();
 
   G4ReactionProductVector* propResult = new G4ReactionProductVector;
+  propResult->reserve(particles.size() + fragments.size());
 
   G4ReactionProduct* rp = 0;	// Buffers to create outgoing tracks
   G4DynamicParticle* dp = 0;
@@ -32,6 +32,7 @@
 // 20130703  M. Kelsey -- Add flag for USE_PHASESPACE
 // 20141030  M. Kelsey -- Add flag to enable direct pi-N absorption
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to double, for energy cut
+// 20261019  Add command for size of nuclear model cache
 
 #include "G4CascadeParamMessenger.hh"
 #include "G4CascadeParameters.hh"
@@ -91,6 +92,10 @@ G4CascadeParamMessenger::G4CascadeParamMessenger(G4CascadeParameters* params)
 			"Scale fator for total cross-sections");
   nucGammaQDCmd = CreateCommand<G4UIcmdWithADouble>("gammaQuasiDeutScale",
 			"Scale factor for gamma-quasideutron cross-sections");
+  nucCacheSizeCmd = CreateCommand<G4UIcmdWithAnInteger>("nuclearModelCacheSize",
+			"Number of nuclear configurations kept per thread");
+  nucCacheStatsCmd = CreateCommand<G4UIcmdWithABool>("nuclearModelCacheStatistics",
+			"Report reuse of nuclear configurations at end of thread");
   coalDPmax2Cmd = CreateCommand<G4UIcmdWithADouble>("cluster2DPmax",
 			"Maximum momentum for p-n clusters");
   coalDPmax3Cmd = CreateCommand<G4UIcmdWithADouble>("cluster3DPmax",
@@ -119,6 +124,8 @@ G4CascadeParamMessenger::~G4CascadeParamMessenger() {
   delete nucFermiScaleCmd;
   delete nucXsecScaleCmd;
   delete nucGammaQDCmd;
+  delete nucCacheSizeCmd;
+  delete nucCacheStatsCmd;
   delete coalDPmax2Cmd;
   delete coalDPmax3Cmd;
   delete coalDPmax4Cmd;
@@ -209,6 +216,12 @@ void G4CascadeParamMessenger::SetNewValue(G4UIcommand* cmd, G4String arg) {
   if (cmd == nucGammaQDCmd)
     theParams->G4NUCMODEL_GAMMAQD = strdup(arg.c_str());
 
+  if (cmd == nucCacheSizeCmd)
+    theParams->G4NUCMODEL_CACHE_SIZE = strdup(arg.c_str());
+
+  if (cmd == nucCacheStatsCmd)
+    theParams->G4NUCMODEL_CACHE_STATS = StoB(arg) ? strdup(arg.c_str()) : 0;
+
   if (cmd == coalDPmax2Cmd)
     theParams->DPMAX_2CLUSTER = strdup(arg.c_str());
 
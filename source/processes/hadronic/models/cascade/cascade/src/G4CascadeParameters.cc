@@ -39,6 +39,8 @@
 //		and trailing effect.
 // 20141121  Use G4AutoDelete to avoid end-of-thread memory leaks
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to double, for energy cut
+// 20261019  Add G4NUCMODEL_CACHE_SIZE for cache of nuclear configurations
+// 20261019  Add G4NUCMODEL_CACHE_STATS to report reuse of the cache
 
 #include "G4CascadeParameters.hh"
 #include "G4CascadeParamMessenger.hh"
@@ -85,6 +87,8 @@ G4CascadeParameters::G4CascadeParameters()
     G4NUCMODEL_FERMI_SCALE(getenv("G4NUCMODEL_FERMI_SCALE")),
     G4NUCMODEL_XSEC_SCALE(getenv("G4NUCMODEL_XSEC_SCALE")),
     G4NUCMODEL_GAMMAQD(getenv("G4NUCMODEL_GAMMAQD")),
+    G4NUCMODEL_CACHE_SIZE(getenv("G4NUCMODEL_CACHE_SIZE")),
+    G4NUCMODEL_CACHE_STATS(getenv("G4NUCMODEL_CACHE_STATS")),
     DPMAX_2CLUSTER(getenv("DPMAX_2CLUSTER")),
     DPMAX_3CLUSTER(getenv("DPMAX_3CLUSTER")),
     DPMAX_4CLUSTER(getenv("DPMAX_4CLUSTER")),
@@ -122,6 +126,9 @@ void G4CascadeParameters::Initialize() {
   XSEC_SCALE = (G4NUCMODEL_XSEC_SCALE ? strtod(G4NUCMODEL_XSEC_SCALE,0)
 		: (BEST_PAR?0.1:1.0) );
   GAMMAQD_SCALE = (G4NUCMODEL_GAMMAQD?strtod(G4NUCMODEL_GAMMAQD,0):1.);
+  MODEL_CACHE = (G4NUCMODEL_CACHE_SIZE ? atoi(G4NUCMODEL_CACHE_SIZE) : 8);
+  MODEL_CACHE_STATS = (0!=G4NUCMODEL_CACHE_STATS &&
+		       G4NUCMODEL_CACHE_STATS[0]!='0');
   DPMAX_DOUBLET = (DPMAX_2CLUSTER ? strtod(DPMAX_2CLUSTER,0) : 0.090);
   DPMAX_TRIPLET = (DPMAX_3CLUSTER ? strtod(DPMAX_3CLUSTER,0) : 0.108);
   DPMAX_ALPHA = (DPMAX_4CLUSTER ? strtod(DPMAX_4CLUSTER,0) : 0.115);
@@ -171,6 +178,10 @@ void G4CascadeParameters::DumpConfig(std::ostream& os) const {
     os << "G4NUCMODEL_XSEC_SCALE = " << G4NUCMODEL_XSEC_SCALE << endl;
   if (G4NUCMODEL_GAMMAQD)
     os << "G4NUCMODEL_GAMMAQD = " << G4NUCMODEL_GAMMAQD << endl;
+  if (G4NUCMODEL_CACHE_SIZE)
+    os << "G4NUCMODEL_CACHE_SIZE = " << G4NUCMODEL_CACHE_SIZE << endl;
+  if (G4NUCMODEL_CACHE_STATS)
+    os << "G4NUCMODEL_CACHE_STATS = " << G4NUCMODEL_CACHE_STATS << endl;
   if (DPMAX_2CLUSTER)
     os << "DPMAX_2CLUSTER = " << DPMAX_2CLUSTER << endl;
   if (DPMAX_3CLUSTER)
@@ -108,6 +108,7 @@
 // 20141211  M. Kelsey -- Change PIN_ABSORPTION flag to double, probability;
 //		fix handling of boosts for pi-N absorption.
 // 20150608  M. Kelsey -- Label all while loops as terminating.
+// 20261019  Fill three-body momenta into data member buffer
 
 #include "G4ElementaryParticleCollider.hh"
 #include "G4CascadeChannel.hh"
@@ -481,9 +482,9 @@ G4ElementaryParticleCollider::generateSCMmuonAbsorption(G4double etot_scm,
   fillOutgoingMasses();
 
   G4GDecay3 breakup(etot_scm, masses[0], masses[1], masses[2]);
-  std::vector<G4ThreeVector> theMomenta = breakup.GetThreeBodyMomenta();
+  breakup.GetThreeBodyMomenta(momenta3);
 
-  if (theMomenta.empty()) {
+  if (momenta3.empty()) {
     G4cerr << " generateSCMmuonAbsorption: GetThreeBodyMomenta() failed"
 	   << " for " << type2 << " dibaryon" << G4endl;
     particle_kinds.clear();
@@ -492,7 +493,7 @@ G4ElementaryParticleCollider::generateSCMmuonAbsorption(G4double etot_scm,
   }
 
   for (size_t i=0; i<3; i++) {
-    scm_momentums[i].setVectM(theMomenta[i], masses[i]);
+    scm_momentums[i].setVectM(momenta3[i], masses[i]);
     particles[i].fill(scm_momentums[i], particle_kinds[i], G4InuclParticle::EPCollider);
   }
 } 
@@ -35,6 +35,7 @@
 // 20130620  Address Coverity #51433, initializing all data members
 // 20141201  Fix error message text to show correct class name
 // 20150608  M. Kelsey -- Label all while loops as terminating.
+// 20261019  Add GetThreeBodyMomenta() filling a caller-owned buffer
 
 #include "G4GDecay3.hh"
 #include "G4PhysicalConstants.hh"
@@ -99,8 +100,15 @@ G4bool G4GDecay3::CalculateMomentumMagnitudes()
 
 std::vector<G4ThreeVector> G4GDecay3::GetThreeBodyMomenta()
 {
-
   std::vector<G4ThreeVector> pVect;
+  GetThreeBodyMomenta(pVect);
+  return pVect;
+}
+
+
+void G4GDecay3::GetThreeBodyMomenta(std::vector<G4ThreeVector>& pVect)
+{
+  pVect.clear();
 
   if (CalculateMomentumMagnitudes() ) {
     
@@ -134,7 +142,5 @@ std::vector<G4ThreeVector> G4GDecay3::GetThreeBodyMomenta()
     G4cerr << "G4GDecay3::GetThreeBodyMomenta: " << loopMax
            << " or more loops in momentum magnitude calculation " << G4endl;
   }
-
-  return pVect;
 }
 
@@ -71,6 +71,7 @@
 // 20150220  M. Kelsey -- Improve photonuclearOkay() filter by just checking
 //		final-state nucleus vs. target, rather than all secondaries.
 // 20150608  M. Kelsey -- Label all while loops as terminating.
+// 20261019  Fill realigned bullet into data members, instead of new/delete
 
 #include "G4InuclCollider.hh"
 #include "G4CascadeChannelTables.hh"
@@ -226,10 +227,13 @@ void G4InuclCollider::collide(G4InuclParticle* bullet, G4InuclParticle* target,
 
   // Need to make copy of bullet with momentum realigned
   G4InuclParticle* zbullet = 0;
-  if (interCase.hadNucleus())
-    zbullet = new G4InuclElementaryParticle(bmom, btype);
-  else
-    zbullet = new G4InuclNuclei(bmom, ab, zb);
+  if (interCase.hadNucleus()) {
+    hadronBullet.fill(bmom, btype);
+    zbullet = &hadronBullet;
+  } else {
+    nucleusBullet.fill(bmom, ab, zb);
+    zbullet = &nucleusBullet;
+  }
 
   G4int itry = 0;
   while (itry < itry_max) {	/* Loop checking 08.06.2015 MHK */
@@ -265,7 +269,6 @@ void G4InuclCollider::collide(G4InuclParticle* bullet, G4InuclParticle* target,
     if (globalOutput.acceptable()) {
       if (verboseLevel) 
 	G4cout << " InuclCollider output after trials " << itry << G4endl;
-      delete zbullet;
       return;
     } else {
       if (verboseLevel>2)
@@ -279,8 +282,6 @@ void G4InuclCollider::collide(G4InuclParticle* bullet, G4InuclParticle* target,
   }
   
   globalOutput.trivialise(bullet, target);
-
-  delete zbullet;
   return;
 }
 
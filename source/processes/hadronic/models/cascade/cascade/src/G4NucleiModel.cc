@@ -158,6 +158,9 @@
 // 20141001  M. Kelsey -- Change sign of "dv" in boundaryTransition
 // 20150608  M. Kelsey -- Label all while loops as terminating.
 // 20150622  M. Kelsey -- Use G4AutoDelete for _TLS_ buffers.
+// 20261019  Use data member buffers for CDF in choosePointAlongTraj()
+// 20261019  Keep LRU cache of built configurations, size from parameters
+// 20261019  Report cache statistics at deletion if requested in parameters
 
 #include "G4NucleiModel.hh"
 #include "G4AutoDelete.hh"
@@ -184,6 +187,7 @@
 #include "G4SystemOfUnits.hh"
 #include <vector>
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <numeric>
 
@@ -228,7 +232,10 @@ G4NucleiModel::G4NucleiModel()
   : verboseLevel(0), nuclei_radius(0.), nuclei_volume(0.), number_of_zones(0),
     A(0), Z(0), theNucleus(0), neutronNumber(0), protonNumber(0),
     neutronNumberCurrent(0), protonNumberCurrent(0), current_nucl1(0),
-    current_nucl2(0), gammaQDinterp(kebins),
+    current_nucl2(0),
+    modelCacheSize(std::max(G4CascadeParameters::modelCacheSize(),0)),
+    cacheSequence(0), cacheHits(0), setupTimeSaved(0.),
+    gammaQDinterp(kebins),
     crossSectionUnits(G4CascadeParameters::xsecScale()),
     radiusUnits(G4CascadeParameters::radiusScale()),
     skinDepth(0.611207*radiusUnits),
@@ -245,7 +252,10 @@ G4NucleiModel::G4NucleiModel(G4int a, G4int z)
   : verboseLevel(0), nuclei_radius(0.), nuclei_volume(0.), number_of_zones(0),
     A(0), Z(0), theNucleus(0), neutronNumber(0), protonNumber(0),
     neutronNumberCurrent(0), protonNumberCurrent(0), current_nucl1(0),
-    current_nucl2(0), gammaQDinterp(kebins),
+    current_nucl2(0),
+    modelCacheSize(std::max(G4CascadeParameters::modelCacheSize(),0)),
+    cacheSequence(0), cacheHits(0), setupTimeSaved(0.),
+    gammaQDinterp(kebins),
     crossSectionUnits(G4CascadeParameters::xsecScale()),
     radiusUnits(G4CascadeParameters::radiusScale()),
     skinDepth(0.611207*radiusUnits),
@@ -264,7 +274,10 @@ G4NucleiModel::G4NucleiModel(G4InuclNuclei* nuclei)
   : verboseLevel(0), nuclei_radius(0.), nuclei_volume(0.), number_of_zones(0),
     A(0), Z(0), theNucleus(0), neutronNumber(0), protonNumber(0),
     neutronNumberCurrent(0), protonNumberCurrent(0), current_nucl1(0),
-    current_nucl2(0), gammaQDinterp(kebins),
+    current_nucl2(0),
+    modelCacheSize(std::max(G4CascadeParameters::modelCacheSize(),0)),
+    cacheSequence(0), cacheHits(0), setupTimeSaved(0.),
+    gammaQDinterp(kebins),
     crossSectionUnits(G4CascadeParameters::xsecScale()),
     radiusUnits(G4CascadeParameters::radiusScale()),
     skinDepth(0.611207*radiusUnits),
@@ -280,6 +293,8 @@ G4NucleiModel::G4NucleiModel(G4InuclNuclei* nuclei)
 }
 
 G4NucleiModel::~G4NucleiModel() {
+  if (G4CascadeParameters::modelCacheStats() && cacheSequence > 0)
+    printCacheStatistics(G4cout);
   delete theNucleus;
   theNucleus = 0;
 }
@@ -317,6 +332,16 @@ void G4NucleiModel::generateModel(G4int a, G4int z) {
     return;
   }
 
+  // Reuse configuration built for earlier interaction, if available
+  if (fetchFromCache(a,z)) {
+    if (verboseLevel > 1) G4cout << " model restored from cache" << G4endl;
+    reset();
+    return;
+  }
+
+  std::chrono::steady_clock::time_point buildStart =
+    std::chrono::steady_clock::now();
+
   A = a;
   Z = z;
   delete theNucleus;
@@ -373,10 +398,87 @@ void G4NucleiModel::generateModel(G4int a, G4int z) {
   nuclei_radius = zone_radii.back();
   nuclei_volume = std::accumulate(zone_volumes.begin(),zone_volumes.end(),0.);
 
+  storeInCache(std::chrono::duration<G4double>
+	       (std::chrono::steady_clock::now()-buildStart).count());
+
   if (verboseLevel > 3) printModel();
 }
 
 
+// Copy configuration for (a,z) from cache into active buffers
+
+G4bool G4NucleiModel::fetchFromCache(G4int a, G4int z) {
+  std::vector<ModelConfig>::iterator cfg = modelCache.begin();
+  for (; cfg != modelCache.end(); ++cfg) {
+    if (cfg->A == a && cfg->Z == z) break;
+  }
+  if (cfg == modelCache.end()) return false;
+
+  cfg->lastUsed = ++cacheSequence;
+  cacheHits++;
+  setupTimeSaved += cfg->buildTime;
+
+  A = a;
+  Z = z;
+  if (theNucleus) theNucleus->fill(A,Z);
+  else theNucleus = new G4InuclNuclei(A,Z);
+
+  neutronNumber = A - Z;
+  protonNumber = Z;
+
+  number_of_zones = cfg->number_of_zones;
+  nuclei_radius = cfg->nuclei_radius;
+  nuclei_volume = cfg->nuclei_volume;
+  nucleon_densities = cfg->nucleon_densities;
+  zone_potentials = cfg->zone_potentials;
+  fermi_momenta = cfg->fermi_momenta;
+  zone_radii = cfg->zone_radii;
+  zone_volumes = cfg->zone_volumes;
+  binding_energies = cfg->binding_energies;
+
+  return true;
+}
+
+// Save current configuration, replacing least recently used if full
+
+void G4NucleiModel::storeInCache(G4double buildTime) {
+  if (modelCacheSize == 0) return;
+
+  std::vector<ModelConfig>::iterator cfg;
+  if (modelCache.size() < modelCacheSize) {
+    modelCache.push_back(ModelConfig());
+    cfg = modelCache.end()-1;
+  } else {
+    cfg = modelCache.begin();
+    std::vector<ModelConfig>::iterator iter = cfg;
+    for (++iter; iter != modelCache.end(); ++iter) {
+      if (iter->lastUsed < cfg->lastUsed) cfg = iter;
+    }
+  }
+
+  cfg->A = A;
+  cfg->Z = Z;
+  cfg->number_of_zones = number_of_zones;
+  cfg->nuclei_radius = nuclei_radius;
+  cfg->nuclei_volume = nuclei_volume;
+  cfg->nucleon_densities = nucleon_densities;
+  cfg->zone_potentials = zone_potentials;
+  cfg->fermi_momenta = fermi_momenta;
+  cfg->zone_radii = zone_radii;
+  cfg->zone_volumes = zone_volumes;
+  cfg->binding_energies = binding_energies;
+  cfg->buildTime = buildTime;
+  cfg->lastUsed = ++cacheSequence;
+}
+
+void G4NucleiModel::printCacheStatistics(std::ostream& os) const {
+  os << " G4NucleiModel cache: " << modelCache.size() << " of "
+     << modelCacheSize << " configurations, " << cacheHits
+     << " reused, setup time saved " << setupTimeSaved*1e3 << " ms"
+     << G4endl;
+}
+
+
 // Load binding energy array for current nucleus
 
 void G4NucleiModel::fillBindingEnergies() {
@@ -1179,7 +1281,6 @@ void G4NucleiModel::choosePointAlongTraj(G4CascadParticle& cparticle) {
   // Get trajectory through nucleus by computing exit point of line,
   // assuming that current position is on surface
 
-  // FIXME:  These need to be reusable (static) buffers
   G4ThreeVector pos  = cparticle.getPosition();
   G4ThreeVector rhat = pos.unit();
 
@@ -1218,9 +1319,10 @@ void G4NucleiModel::choosePointAlongTraj(G4CascadParticle& cparticle) {
 	   << " ncross " << ncross << G4endl;
   }
 
-  // FIXME:  These need to be reusable (static) buffers
-  std::vector<G4double> wtlen(ncross,0.);	// CDF from entry point
-  std::vector<G4double> len(ncross,0.);		// Distance from entry point
+  std::vector<G4double>& wtlen = traj_wtlen;	// CDF from entry point
+  std::vector<G4double>& len = traj_len;	// Distance from entry point
+  wtlen.assign(ncross,0.);
+  len.assign(ncross,0.);
 
   // Work from outside in, to accumulate CDF steps properly
   G4int i;				// Loop variable, used multiple times
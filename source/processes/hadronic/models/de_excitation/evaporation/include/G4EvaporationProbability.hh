@@ -30,12 +30,17 @@
 // Hadronic Process: Nuclear De-excitations
 // by V. Lara (Oct 1998)
 //
+// 19.10.26 optional shared tables of total probability 
+//          (G4EvaporationProbabilityTable)
+//
 #ifndef G4EvaporationProbability_h
 #define G4EvaporationProbability_h 1
 
 #include "G4VEmissionProbability.hh"
 #include "G4VLevelDensityParameter.hh"
 #include "G4EvaporationLevelDensityParameter.hh"
+#include "G4EvaporationProbabilityTable.hh"
+#include <map>
 
 class G4VCoulombBarrier;
 
@@ -78,6 +83,11 @@ private:
 
   G4double CrossSection(G4double K);  
 
+  // total probability for the current nucleus at excitation exc
+  G4double ComputeTotalProbability(G4double exc);
+
+  const G4EvaporationProbabilityTable::ProbData* GetTableData();
+
   // Copy constructor
   G4EvaporationProbability(const G4EvaporationProbability &right);
 
@@ -106,6 +116,14 @@ private:
   G4double Gamma;
 
   G4double probability[11];
+
+  // spectrum is integrated in SampleKineticEnergy if the total 
+  // probability is taken from tables
+  G4bool integrationPending;
+
+  G4int fTableKey;
+  const G4EvaporationProbabilityTable::ProbData* fTableData;
+  std::map<G4int, const G4EvaporationProbabilityTable::ProbData*> fTableCache;
 };
 
 #endif
@@ -0,0 +1,119 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// Hadronic Process: Nuclear De-excitations
+//
+// Tables of the total emission probability of an evaporated particle
+// on a uniform grid of excitation energy, per inverse cross section 
+// option, emitted particle and decaying nucleus (A, Z). A table is 
+// built on first use of the nucleus and is shared by all threads. 
+// The probability is interpolated linearly in its logarithm; at build 
+// time the interpolation is compared with the computation at the 
+// centre of each bin, bins where it differs more than the tolerance 
+// or where the probability vanishes (pairing and emission thresholds)
+// are flagged and the probability is integrated there as before.
+// The tables are inactive by default, they may be activated by
+// SetActive(true), G4ExcitationHandler::UseTabulatedEvaporation() or 
+// the environment variable G4EVAPORATION_TABLES.
+//
+// 19.10.26 - first implementation
+//
+
+#ifndef G4EvaporationProbabilityTable_h
+#define G4EvaporationProbabilityTable_h 1
+
+#include "globals.hh"
+#include "G4Threading.hh"
+#include "G4Exp.hh"
+#include <vector>
+#include <map>
+#include <functional>
+#include <algorithm>
+
+class G4EvaporationProbabilityTable
+{
+public:
+
+  struct ProbData {
+    std::vector<G4double> node;   // logarithm of probability 
+    std::vector<G4bool> direct;   // per bin
+  };
+
+  // total emission probability for an excitation energy
+  typedef std::function<G4double(G4double)> ProbFunction;
+
+  G4EvaporationProbabilityTable(G4double umax, G4double ustep, 
+                                G4double tolerance);
+
+  ~G4EvaporationProbabilityTable();
+
+  // Shared data for the key (cross section option, particle, nucleus),
+  // built by the function on first use
+  const ProbData* GetData(G4int key, const ProbFunction&);
+
+  // Interpolated probability, false if the excitation is above tables
+  // or the bin should be computed directly
+  inline G4bool GetProbability(const ProbData*, G4double U, 
+                               G4double& prob) const;
+
+  static void SetActive(G4bool val);
+  static G4bool IsActive();
+
+private:
+
+  G4EvaporationProbabilityTable & operator=
+  (const G4EvaporationProbabilityTable &right);
+  G4EvaporationProbabilityTable(const G4EvaporationProbabilityTable&);
+
+  std::map<G4int, ProbData*> fData;
+
+  G4double fUmax;
+  G4double fStep;
+  G4double fInvStep;
+  G4double fTolerance;
+  G4int fBins;
+
+  static G4bool fActive;
+  static G4Mutex fMutex;
+};
+
+inline G4bool 
+G4EvaporationProbabilityTable::GetProbability(const ProbData* data, 
+                                              G4double U,
+                                              G4double& prob) const
+{
+  if(U < 0.0 || U >= fUmax) { return false; }
+  G4double x = U*fInvStep;
+  G4int bin = std::min(G4int(x), fBins-1);
+  if(data->direct[bin]) { return false; }
+  x -= bin;
+  G4double y1 = data->node[bin];
+  prob = G4Exp(y1 + (data->node[bin+1] - y1)*x);
+  return true;
+}
+
+#endif
@@ -56,6 +56,7 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_deex_evaporation
         G4EvaporationDefaultGEMFactory.hh
         G4EvaporationFactory.hh
         G4EvaporationProbability.hh
+        G4EvaporationProbabilityTable.hh
         G4He3EvaporationChannel.hh
         G4He3EvaporationProbability.hh
         G4NeutronEvaporationChannel.hh
@@ -76,6 +77,7 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_deex_evaporation
         G4EvaporationDefaultGEMFactory.cc
         G4EvaporationFactory.cc
         G4EvaporationProbability.cc
+        G4EvaporationProbabilityTable.cc
         G4He3EvaporationChannel.cc
         G4He3EvaporationProbability.cc
         G4NeutronEvaporationChannel.cc
@@ -36,6 +36,9 @@
 // JMQ (14 february 2009) bug fixed in emission width: hbarc instead of 
 //                        hbar_Planck in the denominator
 //
+// 19.10.26 optional shared tables of total probability for OPTxs > 0,
+//          the spectrum is integrated only for the sampled channel
+//
 #include "G4EvaporationProbability.hh"
 #include "G4VCoulombBarrier.hh"
 #include "G4PhysicalConstants.hh"
@@ -53,6 +56,13 @@ static const G4double explim = 350.;
 static const G4double invmev = 1./CLHEP::MeV;
 static const G4double ssqr3  = 1.5*std::sqrt(3.0);
 
+namespace
+{
+  // shared by all threads, above 150 MeV the probability is integrated
+  G4EvaporationProbabilityTable evaporationTables(150*CLHEP::MeV, 
+                                                  0.5*CLHEP::MeV, 0.001);
+}
+
 G4EvaporationProbability::G4EvaporationProbability(G4int anA, G4int aZ, 
 						   G4double aGamma, 
 						   G4VCoulombBarrier*) 
@@ -67,6 +77,9 @@ G4EvaporationProbability::G4EvaporationProbability(G4int anA, G4int aZ,
   if(1 == theZ) { index = theA; }
   else { index = theA + 1; }
   for(G4int i=0; i<11; ++i) { probability[i] = 0.0; }
+  integrationPending = false;
+  fTableKey = -1;
+  fTableData = 0;
 }
 
 G4EvaporationProbability::~G4EvaporationProbability() 
@@ -82,6 +95,7 @@ G4double G4EvaporationProbability::EmissionProbability(
 G4double G4EvaporationProbability::TotalProbability(
          const G4Fragment & fragment, G4double minEnergy, G4double maxEnergy)
 {
+  integrationPending = false;
   if (maxEnergy <= minEnergy) { return 0.0; }
 
   fragA = fragment.GetA_asInt();
@@ -128,13 +142,24 @@ G4double G4EvaporationProbability::TotalProbability(
              
   } else {
 
-    a0 = theEvapLDPptr->LevelDensityParameter(fragA,fragZ,U - delta0);
     // compute power once
     if(OPTxs <= 2) { 
       muu =  G4ChatterjeeCrossSection::ComputePowerParameter(resA, index);
     } else {
       muu = G4KalbachCrossSection::ComputePowerParameter(resA, index);
     }
+    // tables are valid if there is no Coulomb barrier cutoff, 
+    // the maximal energy is defined by the excitation
+    if(0.0 == minEnergy && G4EvaporationProbabilityTable::IsActive()) {
+      const G4EvaporationProbabilityTable::ProbData* data = GetTableData();
+      U = fragment.GetExcitationEnergy();
+      if(evaporationTables.GetProbability(data, U, Width)) {
+        a0 = theEvapLDPptr->LevelDensityParameter(fragA,fragZ,U - delta0);
+        integrationPending = true;
+        return Width;
+      }
+    }
+    a0 = theEvapLDPptr->LevelDensityParameter(fragA,fragZ,U - delta0);
     // if Coulomb barrier cutoff is superimposed for all cross sections 
     // then the limit is the Coulomb Barrier
     Width = IntegrateEmissionProbability(minEnergy, maxEnergy);
@@ -142,6 +167,46 @@ G4double G4EvaporationProbability::TotalProbability(
   return Width;
 }
 
+// Same as in G4EvaporationChannel::GetEmissionProbability
+G4double G4EvaporationProbability::ComputeTotalProbability(G4double exc)
+{
+  U = exc;
+  if(U < delta0) { return 0.0; }
+  G4double etot = fragMass + U;
+  G4double mres = resMass + delta1;
+  if(etot <= mres + partMass) { return 0.0; }
+  G4double maxEnergy = 
+    ((etot - mres)*(etot + mres) + partMass*partMass)/(2.0*etot) - partMass;
+  if(maxEnergy <= 0.0) { return 0.0; }
+  a0 = theEvapLDPptr->LevelDensityParameter(fragA,fragZ,U - delta0);
+  return IntegrateEmissionProbability(0.0, maxEnergy);
+}
+
+// Tables of the current nucleus, built by this thread if not yet 
+// available
+const G4EvaporationProbabilityTable::ProbData* 
+G4EvaporationProbability::GetTableData()
+{
+  // index is the same for neutron and deuteron, so the emitted 
+  // particle is given by its Z and A
+  G4int key = 
+    ((((OPTxs*10 + theZ)*10 + theA)*1000 + fragZ)*1000 + fragA);
+  if(key == fTableKey) { return fTableData; }
+
+  fTableKey = key;
+  std::map<G4int, 
+    const G4EvaporationProbabilityTable::ProbData*>::iterator it = 
+    fTableCache.find(key);
+  if(it != fTableCache.end()) {
+    fTableData = it->second;
+  } else {
+    fTableData = evaporationTables.GetData(key, 
+      [this](G4double exc) { return ComputeTotalProbability(exc); });
+    fTableCache[key] = fTableData;
+  }
+  return fTableData;
+}
+
 G4double 
 G4EvaporationProbability::IntegrateEmissionProbability(G4double low, G4double up)
 {
@@ -245,6 +310,10 @@ G4EvaporationProbability::SampleKineticEnergy(G4double minKinEnergy,
 
   } else { 
 
+    if(integrationPending) {
+      IntegrateEmissionProbability(minKinEnergy, maxKinEnergy);
+      integrationPending = false;
+    }
     G4double p =  probability[nbins]*G4UniformRand();
     G4int i = 0;
     for(; i<nbins; ++i) { if(p <= probability[i+1]) { break; } }
@@ -0,0 +1,94 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// Hadronic Process: Nuclear De-excitations
+//
+// 19.10.26 - first implementation
+
+#include "G4EvaporationProbabilityTable.hh"
+#include "G4AutoLock.hh"
+#include "G4Log.hh"
+#include <cstdlib>
+
+G4bool G4EvaporationProbabilityTable::fActive = 
+  (getenv("G4EVAPORATION_TABLES") != 0);
+G4Mutex G4EvaporationProbabilityTable::fMutex = G4MUTEX_INITIALIZER;
+
+G4EvaporationProbabilityTable::G4EvaporationProbabilityTable(
+  G4double umax, G4double ustep, G4double tolerance)
+  : fTolerance(tolerance)
+{
+  fBins = std::max(1, G4int(umax/ustep + 0.5));
+  fStep = umax/G4double(fBins);
+  fInvStep = 1.0/fStep;
+  fUmax = fStep*fBins;
+}
+
+G4EvaporationProbabilityTable::~G4EvaporationProbabilityTable()
+{
+  std::map<G4int, ProbData*>::iterator it = fData.begin();
+  for(; it != fData.end(); ++it) { delete it->second; }
+}
+
+// Data are built under lock by the calling thread with its own
+// instance of the emission probability
+
+const G4EvaporationProbabilityTable::ProbData* 
+G4EvaporationProbabilityTable::GetData(G4int key, 
+                                       const ProbFunction& compute)
+{
+  G4AutoLock l(&fMutex);
+  std::map<G4int, ProbData*>::iterator it = fData.find(key);
+  if(it != fData.end()) { return it->second; }
+
+  ProbData* data = new ProbData();
+  data->node.resize(fBins+1, 0.0);
+  data->direct.resize(fBins, true);
+  std::vector<G4double> w(fBins+1, 0.0);
+  for(G4int i=0; i<=fBins; ++i) { 
+    w[i] = compute(i*fStep); 
+    if(w[i] > 0.0) { data->node[i] = G4Log(w[i]); }
+  }
+  for(G4int i=0; i<fBins; ++i) {
+    if(w[i] <= 0.0 || w[i+1] <= 0.0) { continue; }
+    G4double wc = compute((i + 0.5)*fStep);
+    data->direct[i] = 
+      (std::abs(std::sqrt(w[i]*w[i+1]) - wc) > fTolerance*wc);
+  }
+  fData[key] = data;
+  return data;
+}
+
+void G4EvaporationProbabilityTable::SetActive(G4bool val)
+{
+  fActive = val;
+}
+
+G4bool G4EvaporationProbabilityTable::IsActive()
+{
+  return fActive;
+}
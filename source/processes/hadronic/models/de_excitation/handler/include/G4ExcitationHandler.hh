@@ -44,6 +44,7 @@
 //    superimposed Coulomb barrier (if useSICBis set true, by default is false)  
 // 23 January 2012 by V.Ivanchenko remove obsolete data members; added access
 //    methods to deexcitation components
+// 19 October 2026 option of tabulated evaporation probabilities
 //                   
 
 #ifndef G4ExcitationHandler_h
@@ -97,6 +98,10 @@ public:
   // for superimposed Coulomb Barrir for inverse cross sections
   inline void UseSICB();
 
+  // fast mode: total evaporation probabilities are interpolated from
+  // tables shared by all threads (OPTxs > 0 without SICB)
+  void UseTabulatedEvaporation(G4bool val = true);
+
 private:
 
   void SetParameters();
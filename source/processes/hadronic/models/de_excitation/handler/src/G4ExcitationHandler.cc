@@ -61,6 +61,7 @@
 // 23 January 2012 by V.Ivanchenko general cleanup including destruction of 
 //    objects, propagate G4PhotonEvaporation pointer to G4Evaporation class and 
 //    not delete it here 
+// 19 October 2026 option of tabulated evaporation probabilities
 
 #include "G4ExcitationHandler.hh"
 #include "G4SystemOfUnits.hh"
@@ -76,6 +77,7 @@
 #include "G4VEvaporation.hh"
 #include "G4VEvaporationChannel.hh"
 #include "G4Evaporation.hh"
+#include "G4EvaporationProbabilityTable.hh"
 #include "G4StatMF.hh"
 #include "G4FermiBreakUp.hh"
 #include "G4FermiFragmentsPool.hh"
@@ -453,6 +455,11 @@ void G4ExcitationHandler::SetMinEForMultiFrag(G4double anE)
 {
   minEForMultiFrag = anE;
 }
+void G4ExcitationHandler::UseTabulatedEvaporation(G4bool val)
+{
+  G4EvaporationProbabilityTable::SetActive(val);
+}
+
 void G4ExcitationHandler::ModelDescription(std::ostream& outFile) const
 {
     outFile << "G4ExcitationHandler description\n"
@@ -48,6 +48,9 @@
 #include "G4ParticleDefinition.hh"
 #include "G4PhysicsTable.hh"
 
+class G4ParticleHPThermalBroadening;
+class G4ParticleHPUnionisedGrid;
+
 class G4ParticleHPCaptureData : public G4VCrossSectionDataSet
 {
    public:
@@ -92,6 +95,15 @@ class G4ParticleHPCaptureData : public G4VCrossSectionDataSet
       G4PhysicsTable * theCrossSections;
 
       G4bool onFlightDB;
+
+      // Doppler broadened cross sections, if computed at initialisation
+      G4ParticleHPThermalBroadening* theBroadening;
+
+      // Material energy grids and the bin of the last lookup
+      G4ParticleHPUnionisedGrid* theGrid;
+      const G4Material* lastMaterial;
+      G4double lastEnergy;
+      G4int lastBin;
 };
 
 #endif
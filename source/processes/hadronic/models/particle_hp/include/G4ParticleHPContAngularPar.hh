@@ -107,6 +107,7 @@ class G4ParticleHPContAngularPar
   G4double MeanEnergyOfThisInteraction()
   {
     G4double result;
+    if ( fCache.Get() == NULL ) cacheInit();
     if(fCache.Get()->currentMeanEnergy<-1)
     {
       return 0;
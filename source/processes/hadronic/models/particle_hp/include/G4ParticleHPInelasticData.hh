@@ -46,6 +46,9 @@
 #include "G4Element.hh"
 #include "G4ParticleDefinition.hh"
 #include "G4PhysicsTable.hh"
+
+class G4ParticleHPThermalBroadening;
+class G4ParticleHPUnionisedGrid;
 #include "G4Neutron.hh"
 
 class G4ParticleHPData;
@@ -98,6 +101,15 @@ class G4ParticleHPInelasticData : public G4VCrossSectionDataSet
 
       G4bool onFlightDB;
 
+      // Doppler broadened cross sections, if computed at initialisation
+      G4ParticleHPThermalBroadening* theBroadening;
+
+      // Material energy grids and the bin of the last lookup
+      G4ParticleHPUnionisedGrid* theGrid;
+      const G4Material* lastMaterial;
+      G4double lastEnergy;
+      G4int lastBin;
+
   G4ParticleDefinition* theProjectile;
 
       G4ParticleHPData* theHPData;
@@ -47,6 +47,9 @@ class G4ParticleHPChannelList;
 class G4ParticleHPMessenger;
 class G4ParticleHPVector;
 class G4PhysicsTable;
+class G4ParticleHPThermalBroadening;
+class G4ParticleHPUnionisedGrid;
+class G4ParticleHPDataPack;
 struct E_isoAng;
 struct E_P_E_isoAng;
 
@@ -73,6 +76,10 @@ class G4ParticleHPManager
 
       void GetDataStream( G4String , std::istringstream& iss );
       void GetDataStream2( G4String , std::istringstream& iss );
+      // Data files are taken from the pack if they are in it; dataDir 
+      // overrides the data directory recorded in the pack
+      G4bool UseDataPack( const G4String& packFile , const G4String& dataDir = "" );
+      G4bool WriteDataPack( const G4String& dataDir , const G4String& packFile );
       void SetVerboseLevel( G4int i ); 
       G4int GetVerboseLevel() {return verboseLevel; }; 
 
@@ -82,11 +89,16 @@ class G4ParticleHPManager
       void SetUseOnlyPhotoEvaporation( G4bool val ) { USE_ONLY_PHOTONEVAPORATION = val; };
       G4bool GetSkipMissingIsotopes() { return SKIP_MISSING_ISOTOPES; };
       G4bool GetNeglectDoppler() { return NEGLECT_DOPPLER; };
+      G4bool GetDopplerPreBroadening() { return DOPPLER_PRE_BROADENING; };
+      G4int GetUnionisedGridType() { return UNIONISED_GRID_TYPE; };
       G4bool GetDoNotAdjustFinalState() { return DO_NOT_ADJUST_FINAL_STATE; };
       G4bool GetProduceFissionFragments() { return PRODUCE_FISSION_FRAGMENTS; };
 
       void SetSkipMissingIsotopes( G4bool val ) { SKIP_MISSING_ISOTOPES = val; };
       void SetNeglectDoppler( G4bool val ) { NEGLECT_DOPPLER = val; };
+      void SetDopplerPreBroadening( G4bool val ) { DOPPLER_PRE_BROADENING = val; };
+      // 0 - no unionised grid, 1 - full union, 2 - hashed union
+      void SetUnionisedGridType( G4int val ) { UNIONISED_GRID_TYPE = val; };
       void SetDoNotAdjustFinalState( G4bool val ) { DO_NOT_ADJUST_FINAL_STATE = val; };
       void SetProduceFissionFragments( G4bool val ) { PRODUCE_FISSION_FRAGMENTS = val; };
 
@@ -98,6 +110,12 @@ class G4ParticleHPManager
       G4PhysicsTable* GetInelasticCrossSections(const G4ParticleDefinition* );
       void RegisterFissionCrossSections( G4PhysicsTable* val ){ theFissionCrossSections = val; };
       G4PhysicsTable* GetFissionCrossSections(){ return theFissionCrossSections; };
+      // Doppler broadened tables attached to a registered 0 K table
+      void RegisterBroadenedCrossSections( const G4PhysicsTable* , G4ParticleHPThermalBroadening* );
+      G4ParticleHPThermalBroadening* GetBroadenedCrossSections( const G4PhysicsTable* );
+      // Material energy grids attached to a registered 0 K table
+      void RegisterUnionisedGrid( const G4PhysicsTable* , G4ParticleHPUnionisedGrid* );
+      G4ParticleHPUnionisedGrid* GetUnionisedGrid( const G4PhysicsTable* );
 
       std::vector<G4ParticleHPChannel*>* GetElasticFinalStates() { return theElasticFSs; };
       void RegisterElasticFinalStates( std::vector<G4ParticleHPChannel*>* val ) { theElasticFSs = val; };
@@ -125,6 +143,8 @@ class G4ParticleHPManager
 
    private:
       void register_data_file( G4String , G4String );
+      G4bool FindInDataPacks( const G4String& , const char*& , size_t& );
+      std::vector<G4ParticleHPDataPack*> theDataPacks;
       std::map<G4String,G4String> mDataEvaluation;
       /*G4ParticleHPReactionWhiteBoard* RWB;*/
 
@@ -134,6 +154,8 @@ class G4ParticleHPManager
       G4bool USE_ONLY_PHOTONEVAPORATION;
       G4bool SKIP_MISSING_ISOTOPES;
       G4bool NEGLECT_DOPPLER;
+      G4bool DOPPLER_PRE_BROADENING;
+      G4int UNIONISED_GRID_TYPE;
       G4bool DO_NOT_ADJUST_FINAL_STATE;
       G4bool PRODUCE_FISSION_FRAGMENTS;
 
@@ -141,6 +163,8 @@ class G4ParticleHPManager
       G4PhysicsTable* theCaptureCrossSections;
       std::map< const G4ParticleDefinition* , G4PhysicsTable* > theInelasticCrossSections;
       G4PhysicsTable* theFissionCrossSections;
+      std::map< const G4PhysicsTable* , G4ParticleHPThermalBroadening* > theBroadenedCrossSections;
+      std::map< const G4PhysicsTable* , G4ParticleHPUnionisedGrid* > theUnionisedGrids;
 
       std::vector<G4ParticleHPChannel*>* theElasticFSs;
       std::map< const G4ParticleDefinition* , std::vector<G4ParticleHPChannelList*>* > theInelasticFSs;
@@ -33,6 +33,7 @@ class G4ParticleHPManager;
 class G4UIdirectory;
 class G4UIcmdWithAString;
 class G4UIcmdWithAnInteger;
+class G4UIcommand;
 
 class G4ParticleHPMessenger: public G4UImessenger
 {
@@ -49,6 +50,10 @@ class G4ParticleHPMessenger: public G4UImessenger
       G4UIcmdWithAString* PhotoEvaCmd;
       G4UIcmdWithAString* SkipMissingCmd;
       G4UIcmdWithAString* NeglectDopplerCmd;
+      G4UIcmdWithAString* PreBroadeningCmd;
+      G4UIcmdWithAString* UnionisedGridCmd;
+      G4UIcommand* UseDataPackCmd;
+      G4UIcommand* WriteDataPackCmd;
       G4UIcmdWithAString* DoNotAdjustFSCmd;
       G4UIcmdWithAString* ProduceFissionFragementCmd;
       G4UIcmdWithAnInteger* VerboseCmd;
@@ -57,6 +62,9 @@ class G4ParticleHPMessenger: public G4UImessenger
  * #setenv G4NEUTRONHP_USE_ONLY_PHOTONEVAPORATION 1
  * #setenv G4NEUTRONHP_SKIP_MISSING_ISOTOPES 1 
  * #setenv G4NEUTRONHP_NEGLECT_DOPPLER 1
+ * #setenv G4PHP_DOPPLER_PRE_BROADENING 1
+ * #setenv G4PHP_UNIONISED_GRID full (or hashed)
+ * #setenv G4PHP_DATA_PACK file_name
  * #setenv G4NEUTRONHP_DO_NOT_ADJUST_FINAL_STATE 1
  * #setenv G4NEUTRONHP_PRODUCE_FISSION_FRAGMENTS 1
  *
@@ -0,0 +1,97 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 261019 First implementation of Doppler pre-broadening
+//
+#ifndef G4ParticleHPThermalBroadening_h
+#define G4ParticleHPThermalBroadening_h 1
+
+// Class Description
+// Doppler broadened cross sections of elements, computed at initialisation
+// for each temperature of the materials containing the element. 
+// The free gas kernel is integrated over the pointwise 0 K cross section,
+// which gives the mean value of the on the fly Monte Carlo integration
+// done by the ParticleHP cross section data sets. The broadened vectors 
+// use the energy grid of the 0 K element vector (union of the grids of 
+// the isotopes), so a lookup is a single interpolation.
+// Tables are built by the master thread and shared with workers.
+// Class Description - End
+
+#include "globals.hh"
+#include "G4PhysicsVector.hh"
+#include <vector>
+#include <utility>
+
+class G4Element;
+class G4PhysicsTable;
+
+class G4ParticleHPThermalBroadening
+{
+   public:
+
+      G4ParticleHPThermalBroadening();
+
+      ~G4ParticleHPThermalBroadening();
+
+      // Builds broadened vectors for all (element, temperature) pairs of the 
+      // material table; massOfProjectile is used for the target mass ratio
+      void Build( const G4PhysicsTable* zeroKelvinTable , G4double massOfProjectile );
+
+      // Returns NULL if the element has no table at this temperature
+      inline const G4PhysicsVector* GetVector( G4int elementIndex , G4double aT ) const;
+
+      // Broadened cross section at the temperature aT of a target having 
+      // mass ratio theA to the projectile
+      static G4PhysicsVector* Broaden( const G4PhysicsVector* zeroKelvin , 
+                                       G4double theA , G4double aT );
+
+      static G4double TargetMassRatio( const G4Element* , G4double massOfProjectile );
+
+      size_t NumberOfVectors() const;
+
+   private:
+
+      void Clear();
+
+      G4ParticleHPThermalBroadening( const G4ParticleHPThermalBroadening& );
+      G4ParticleHPThermalBroadening& operator=( const G4ParticleHPThermalBroadening& );
+
+      // per element index, list of (temperature, broadened vector)
+      std::vector< std::vector< std::pair< G4double , G4PhysicsVector* > > > theTable;
+};
+
+inline const G4PhysicsVector* 
+G4ParticleHPThermalBroadening::GetVector( G4int elementIndex , G4double aT ) const
+{
+   if ( elementIndex >= (G4int)theTable.size() ) return 0;
+   const std::vector< std::pair< G4double , G4PhysicsVector* > >& v = theTable[elementIndex];
+   for ( size_t i = 0 ; i < v.size() ; ++i ) {
+      if ( v[i].first == aT ) return v[i].second;
+   }
+   return 0;
+}
+
+#endif
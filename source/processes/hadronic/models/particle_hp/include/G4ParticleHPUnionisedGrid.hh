@@ -0,0 +1,119 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 261019 First implementation of unionised energy grid
+//
+#ifndef G4ParticleHPUnionisedGrid_h
+#define G4ParticleHPUnionisedGrid_h 1
+
+// Class Description
+// Material level energy grid for the lookup of element cross sections of 
+// a ParticleHP data set. The position of the energy is found once on the 
+// grid of the material and gives the bin in the vectors of all its elements.
+// Two types are available:
+//  fullUnion   - union of the energy points of all elements of the material,
+//                with the bin of each element stored for each point; one
+//                binary search per energy, no search per element
+//  hashedUnion - fixed number of equal bins in log(E), with the first 
+//                point of each element stored for each bin; no search per 
+//                energy and a short search per element, much less memory
+// The grid is built by the master thread and shared with workers; the bin
+// found for the last (material, energy) is kept by the caller.
+// Class Description - End
+
+#include "globals.hh"
+#include "G4PhysicsVector.hh"
+#include "G4Material.hh"
+#include <vector>
+#include <algorithm>
+#include <cmath>
+
+class G4PhysicsTable;
+class G4Element;
+
+class G4ParticleHPUnionisedGrid
+{
+   public:
+
+      enum GridType { noUnion = 0 , fullUnion , hashedUnion };
+
+      G4ParticleHPUnionisedGrid( GridType type , G4int nHashBins = 8192 );
+
+      ~G4ParticleHPUnionisedGrid();
+
+      // Builds grids for all materials of the material table
+      void Build( const G4PhysicsTable* elementTable );
+
+      // Returns -1 if the material has no grid
+      inline G4int FindBin( const G4Material* , G4double energy ) const;
+
+      // Value of an element vector of the table, or of a vector having the 
+      // same energy points, for the bin found by FindBin 
+      G4double GetValue( const G4PhysicsVector* , const G4Material* , 
+                         const G4Element* , G4int bin , G4double energy ) const;
+
+      GridType GetType() const { return theType; };
+
+      size_t MemoryUsage() const;
+
+   private:
+
+      // First point of the vector not above energy, searched in [iLow, iHigh]
+      static G4int FindPoint( const G4PhysicsVector* , G4double energy , 
+                              G4int iLow , G4int iHigh );
+
+      G4ParticleHPUnionisedGrid( const G4ParticleHPUnionisedGrid& );
+      G4ParticleHPUnionisedGrid& operator=( const G4ParticleHPUnionisedGrid& );
+
+      GridType theType;
+      G4int nBins;
+      G4double logEmin;
+      G4double invLogStep;
+
+      // per material index
+      std::vector< std::vector<G4double> > theEnergies;   // fullUnion only
+      std::vector< std::vector<G4int> > thePoints;        // bin * nElements + slot
+      std::vector< std::vector<G4int> > theElements;      // element indices
+};
+
+inline G4int 
+G4ParticleHPUnionisedGrid::FindBin( const G4Material* aMat , G4double energy ) const
+{
+   size_t index = aMat->GetIndex();
+   if ( index >= thePoints.size() || thePoints[index].empty() ) return -1;
+   if ( theType == fullUnion ) {
+      const std::vector<G4double>& en = theEnergies[index];
+      if ( energy <= en.front() ) return 0;
+      if ( energy >= en.back() ) return en.size() - 1;
+      return std::upper_bound( en.begin() , en.end() , energy ) - en.begin() - 1;
+   }
+   G4double x = ( std::log( energy ) - logEmin )*invLogStep;
+   if ( x <= 0.0 ) return 0;
+   if ( x >= nBins ) return nBins - 1;
+   return G4int( x );
+}
+
+#endif
@@ -88,6 +88,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPDAInelasticFS.hh
     G4ParticleHPDInelasticFS.hh
     G4ParticleHPData.hh
+    G4ParticleHPDataPack.hh
     G4ParticleHPDataPoint.hh
     G4ParticleHPDataUsed.hh
     G4ParticleHPDeExGammas.hh
@@ -157,9 +158,11 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPTCFissionFS.hh
     G4ParticleHPTInelasticFS.hh
     G4ParticleHPThermalBoost.hh
+    G4ParticleHPThermalBroadening.hh
     G4ParticleHPThermalScattering.hh
     G4ParticleHPThermalScatteringData.hh
     G4ParticleHPThermalScatteringNames.hh
+    G4ParticleHPUnionisedGrid.hh
     G4ParticleHPWattSpectrum.hh
     G4VParticleHPEnergyAngular.hh
     G4ParticleHPBGGNucleonInelasticXS.hh
@@ -338,6 +341,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPDAInelasticFS.cc
     G4ParticleHPDInelasticFS.cc
     G4ParticleHPData.cc
+    G4ParticleHPDataPack.cc
     G4ParticleHPDeExGammas.cc
     G4ParticleHPDiscreteTwoBody.cc
     G4ParticleHPElastic.cc
@@ -402,9 +406,11 @@ GEANT4_DEFINE_MODULE(NAME G4had_par_hp
     G4ParticleHPT2AInelasticFS.cc
     G4ParticleHPTCFissionFS.cc
     G4ParticleHPTInelasticFS.cc
+    G4ParticleHPThermalBroadening.cc
     G4ParticleHPThermalScattering.cc
     G4ParticleHPThermalScatteringData.cc
     G4ParticleHPThermalScatteringNames.cc
+    G4ParticleHPUnionisedGrid.cc
     G4ParticleHPWattSpectrum.cc
     G4ParticleHPBGGNucleonInelasticXS.cc
     G4ParticleHPManager.cc
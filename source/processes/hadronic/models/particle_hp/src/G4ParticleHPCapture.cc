@@ -82,12 +82,15 @@
   {
     //delete [] theCapture;
 //    G4cout << "Leaving G4ParticleHPCapture::~G4ParticleHPCapture"<<G4endl;
+     // The channels are owned by the master and shared with the workers
+     if ( theCapture != NULL && !G4Threading::IsWorkerThread() ) {
      for ( std::vector<G4ParticleHPChannel*>::iterator 
            ite = theCapture->begin() ; ite != theCapture->end() ; ite++ )
      {
         delete *ite;
      }
      theCapture->clear();
+     }
   }
   
   #include "G4ParticleHPThermalBoost.hh"
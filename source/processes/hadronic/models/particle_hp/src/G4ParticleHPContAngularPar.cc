@@ -60,8 +60,7 @@
 G4ParticleHPContAngularPar::G4ParticleHPContAngularPar( G4ParticleDefinition* projectile)
 {  
   theAngular = 0;
-  fCache.Get()->currentMeanEnergy = -2;
-  fCache.Get()->fresh = true;
+  fCache.Put(NULL);
   adjustResult = true;
   if ( getenv( "G4PHP_DO_NOT_ADJUST_FINAL_STATE" ) ) adjustResult = false;
 
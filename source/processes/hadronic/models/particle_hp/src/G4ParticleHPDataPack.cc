@@ -0,0 +1,296 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 261019 First implementation of G4NDL data pack
+//
+#include "G4ParticleHPDataPack.hh"
+#include "zlib.h"
+#include <fstream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+namespace
+{
+   const char     packMagic[8] = {'G','4','N','D','L','P','A','K'};
+   const uint32_t byteOrderMark = 0x01020304;
+
+   struct PackHeader
+   {
+      char     magic[8];
+      uint32_t version;
+      uint32_t byteOrder;
+      uint64_t nFiles;
+      uint64_t indexOffset;
+      uint64_t dirLength;
+   };
+
+#ifndef WIN32
+   // relative name of file -> (full name, compressed)
+   typedef std::map< G4String , std::pair< G4String , G4bool > > FileList;
+
+   void ListFiles( const G4String& dir , const G4String& relDir , FileList& files )
+   {
+      DIR* dp = opendir( dir.c_str() );
+      if ( dp == NULL ) return;
+      struct dirent* entry;
+      while ( ( entry = readdir( dp ) ) != NULL ) { 
+         G4String name( entry->d_name );
+         if ( name == "." || name == ".." ) continue;
+         G4String full = dir + "/" + name;
+         G4String rel = relDir.empty() ? name : relDir + "/" + name;
+         struct stat st;
+         if ( stat( full.c_str() , &st ) != 0 ) continue;
+         if ( S_ISDIR( st.st_mode ) ) {
+            ListFiles( full , rel , files );
+         } else if ( S_ISREG( st.st_mode ) ) {
+            // the compressed file is used if both versions exist, as in 
+            // G4ParticleHPManager::GetDataStream 
+            if ( rel.size() > 2 && rel.substr( rel.size()-2 ) == ".z" ) {
+               files[ rel.substr( 0 , rel.size()-2 ) ] = std::make_pair( full , true );
+            } else if ( files.find( rel ) == files.end() ) {
+               files[ rel ] = std::make_pair( full , false );
+            }
+         }
+      }
+      closedir( dp );
+   }
+#endif
+}
+
+G4String G4ParticleHPDataPack::Normalise( const G4String& name )
+{
+   G4String result;
+   for ( size_t i = 0 ; i < name.size() ; ++i ) {
+      if ( name[i] == '/' && !result.empty() && result[result.size()-1] == '/' ) continue;
+      result += name[i];
+   }
+   while ( result.size() > 1 && result[result.size()-1] == '/' ) result.erase( result.size()-1 );
+   return result;
+}
+
+G4bool G4ParticleHPDataPack::Inflate( const G4String& fileName , std::string& content )
+{
+   std::ifstream in( fileName , std::ios::binary | std::ios::ate );
+   if ( !in.good() ) return false;
+   G4int file_size = in.tellg();
+   in.seekg( 0 , std::ios::beg );
+   std::vector<Bytef> compdata( std::max( 1 , file_size ) );
+   in.read( (char*)&compdata[0] , file_size );
+   if ( in.gcount() != file_size ) return false;
+
+   uLongf complen = (uLongf) ( file_size*4 + 16 );
+   std::vector<Bytef> uncompdata( complen );
+   G4int status = uncompress( &uncompdata[0] , &complen , &compdata[0] , file_size );
+   while ( status == Z_BUF_ERROR && uncompdata.size() < 0x40000000 ) { // Loop checking, 19.10.2026
+      complen = 2*uncompdata.size();
+      uncompdata.resize( complen );
+      status = uncompress( &uncompdata[0] , &complen , &compdata[0] , file_size );
+   }
+   if ( status != Z_OK ) return false;
+   content.assign( (const char*)&uncompdata[0] , complen );
+   return true;
+}
+
+G4bool G4ParticleHPDataPack::Write( const G4String& dataDir , const G4String& packFile )
+{
+#ifndef WIN32
+   G4String dir = Normalise( dataDir );
+   FileList files;
+   ListFiles( dir , "" , files );
+   if ( files.empty() ) {
+      G4cerr << "G4ParticleHPDataPack::Write(): no data files found in " << dir << G4endl;
+      return false;
+   }
+
+   G4String tmpName = packFile + ".tmp";
+   std::ofstream out( tmpName , std::ios::out | std::ios::binary );
+   if ( !out ) {
+      G4cerr << "G4ParticleHPDataPack::Write(): cannot open file " << tmpName << G4endl;
+      return false;
+   }
+
+   PackHeader header;
+   std::memset( &header , 0 , sizeof header );
+   std::memcpy( header.magic , packMagic , sizeof packMagic );
+   header.version = version;
+   header.byteOrder = byteOrderMark;
+   header.nFiles = files.size();
+   header.dirLength = dir.size();
+   out.write( (const char*)&header , sizeof header );
+   out.write( dir.c_str() , dir.size() );
+
+   // content of files
+   uint64_t offset = sizeof header + dir.size();
+   std::vector< std::pair< uint64_t , uint64_t > > positions;
+   std::string content;
+   for ( FileList::const_iterator it = files.begin() ; it != files.end() ; ++it ) {
+      G4bool ok;
+      if ( it->second.second ) {
+         ok = Inflate( it->second.first , content );
+      } else {
+         std::ifstream in( it->second.first , std::ios::binary );
+         content.assign( std::istreambuf_iterator<char>( in ) , std::istreambuf_iterator<char>() );
+         ok = !in.bad();
+      }
+      if ( !ok ) {
+         G4cerr << "G4ParticleHPDataPack::Write(): cannot read file " << it->second.first << G4endl;
+         out.close();
+         std::remove( tmpName.c_str() );
+         return false;
+      }
+      out.write( content.data() , content.size() );
+      positions.push_back( std::make_pair( offset , (uint64_t)content.size() ) );
+      offset += content.size();
+   }
+
+   // index
+   header.indexOffset = offset;
+   size_t i = 0;
+   for ( FileList::const_iterator it = files.begin() ; it != files.end() ; ++it , ++i ) {
+      uint32_t len = it->first.size();
+      out.write( (const char*)&len , sizeof len );
+      out.write( it->first.c_str() , len );
+      out.write( (const char*)&positions[i].first , sizeof(uint64_t) );
+      out.write( (const char*)&positions[i].second , sizeof(uint64_t) );
+   }
+   out.seekp( 0 , std::ios::beg );
+   out.write( (const char*)&header , sizeof header );
+   out.close();
+   if ( out.fail() || 0 != std::rename( tmpName.c_str() , packFile.c_str() ) ) {
+      G4cerr << "G4ParticleHPDataPack::Write(): cannot write file " << packFile << G4endl;
+      std::remove( tmpName.c_str() );
+      return false;
+   }
+   G4cout << "G4ParticleHPDataPack: " << files.size() << " files of " << dir 
+          << " are written in " << packFile << G4endl;
+   return true;
+#else
+   G4cerr << "G4ParticleHPDataPack::Write(): not available on this platform, " 
+          << dataDir << " is not converted into " << packFile << G4endl;
+   return false;
+#endif
+}
+
+G4ParticleHPDataPack::G4ParticleHPDataPack( const G4String& packFile , const G4String& dataDir )
+:theFileName(packFile)
+,theData(0)
+,theLength(0)
+{
+#ifndef WIN32
+   G4int fd = open( packFile.c_str() , O_RDONLY );
+   if ( fd < 0 ) {
+      G4cerr << "G4ParticleHPDataPack: cannot open file " << packFile << G4endl;
+      return;
+   }
+   struct stat st;
+   if ( 0 == fstat( fd , &st ) && st.st_size >= G4int( sizeof(PackHeader) ) ) {
+      theLength = st.st_size;
+      void* p = mmap( 0 , theLength , PROT_READ , MAP_SHARED , fd , 0 );
+      if ( p != MAP_FAILED ) theData = static_cast<const char*>(p);
+   }
+   close( fd );
+   if ( theData == 0 ) {
+      G4cerr << "G4ParticleHPDataPack: cannot map file " << packFile << G4endl;
+      return;
+   }
+
+   // validation of the header and of the index
+   PackHeader header;
+   std::memcpy( &header , theData , sizeof header );
+   G4bool valid = ( 0 == std::memcmp( header.magic , packMagic , sizeof packMagic ) )
+               && ( header.version == uint32_t( version ) )
+               && ( header.byteOrder == byteOrderMark )
+               && ( sizeof header + header.dirLength <= header.indexOffset )
+               && ( header.indexOffset <= theLength );
+   if ( valid ) {
+      theDirectory = G4String( theData + sizeof header , (size_t)header.dirLength );
+      const char* p = theData + header.indexOffset;
+      const char* end = theData + theLength;
+      for ( uint64_t i = 0 ; valid && i < header.nFiles ; ++i ) {
+         uint32_t len;
+         uint64_t pos[2];
+         if ( p + sizeof len > end ) { valid = false; break; }
+         std::memcpy( &len , p , sizeof len );
+         p += sizeof len;
+         if ( p + len + sizeof pos > end ) { valid = false; break; }
+         G4String name( p , len );
+         p += len;
+         std::memcpy( pos , p , sizeof pos );
+         p += sizeof pos;
+         valid = ( pos[0] + pos[1] <= header.indexOffset );
+         theIndex[ name ] = std::make_pair( pos[0] , pos[1] );
+      }
+   }
+   if ( !valid ) {
+      G4cerr << "G4ParticleHPDataPack: invalid or corrupted data pack " << packFile << G4endl;
+      munmap( const_cast<char*>( theData ) , theLength );
+      theData = 0;
+      theLength = 0;
+      theIndex.clear();
+      return;
+   }
+   if ( !dataDir.empty() ) theDirectory = dataDir;
+   theDirectory = Normalise( theDirectory );
+#else
+   G4cerr << "G4ParticleHPDataPack: not available on this platform, " 
+          << packFile << " is not used" << G4endl;
+   (void)dataDir;
+#endif
+}
+
+G4ParticleHPDataPack::~G4ParticleHPDataPack()
+{
+#ifndef WIN32
+   if ( theData != 0 ) munmap( const_cast<char*>( theData ) , theLength );
+#endif
+}
+
+G4bool G4ParticleHPDataPack::
+Find( const G4String& fileName , const char*& data , size_t& size ) const
+{
+   if ( theData == 0 ) return false;
+   G4String name = Normalise( fileName );
+   if ( name.size() <= theDirectory.size() + 1 
+     || name.compare( 0 , theDirectory.size() , theDirectory ) != 0
+     || name[theDirectory.size()] != '/' ) return false;
+   std::map< G4String , std::pair< uint64_t , uint64_t > >::const_iterator it = 
+      theIndex.find( name.substr( theDirectory.size() + 1 ) );
+   if ( it == theIndex.end() ) return false;
+   data = theData + it->second.first;
+   size = it->second.second;
+   return true;
+}
@@ -81,7 +81,8 @@
         delete *it;
      }
      */
-     theElastic->clear();
+     // The channels are shared with the workers, only the master clears them
+     if ( theElastic != NULL && !G4Threading::IsWorkerThread() ) theElastic->clear();
   }
   
   #include "G4ParticleHPThermalBoost.hh"
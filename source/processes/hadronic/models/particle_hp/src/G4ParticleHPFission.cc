@@ -79,12 +79,15 @@
   G4ParticleHPFission::~G4ParticleHPFission()
   {
     //delete [] theFission;
+     // The channels are owned by the master and shared with the workers
+     if ( theFission != NULL && !G4Threading::IsWorkerThread() ) {
      for ( std::vector<G4ParticleHPChannel*>::iterator 
            it = theFission->begin() ; it != theFission->end() ; it++ )
      {
         delete *it;
      }
      theFission->clear();
+     }
   }
   
   #include "G4ParticleHPThermalBoost.hh"
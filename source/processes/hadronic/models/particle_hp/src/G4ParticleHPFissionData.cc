@@ -36,6 +36,8 @@
 //
 #include "G4ParticleHPFissionData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPThermalBroadening.hh"
+#include "G4ParticleHPUnionisedGrid.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4Neutron.hh"
@@ -52,6 +54,11 @@ G4ParticleHPFissionData::G4ParticleHPFissionData()
 
    theCrossSections = 0;
    onFlightDB = true;
+   theBroadening = 0;
+   theGrid = 0;
+   lastMaterial = 0;
+   lastEnergy = 0.0;
+   lastBin = -1;
    //BuildPhysicsTable(*G4Neutron::Neutron());
 }
    
@@ -62,6 +69,10 @@ G4ParticleHPFissionData::~G4ParticleHPFissionData()
      delete theCrossSections;
      theCrossSections = NULL;
    }
+   if ( !G4Threading::IsWorkerThread() ) {
+     delete theBroadening;
+     delete theGrid;
+   }
 }
 
 G4bool G4ParticleHPFissionData::IsIsoApplicable( const G4DynamicParticle* dp , 
@@ -83,6 +94,28 @@ G4double G4ParticleHPFissionData::GetIsoCrossSection( const G4DynamicParticle* d
                                    const G4Element* element ,
                                    const G4Material* material )
 {
+   if ( theGrid != NULL ) 
+   {
+      // direct lookup on the unionised grid of the material, if the cross 
+      // section does not depend on the motion of the target at the step
+      const G4PhysicsVector* physVec = 0;
+      if ( !onFlightDB ) 
+         physVec = (*theCrossSections)( element->GetIndex() );
+      else if ( theBroadening != NULL ) 
+         physVec = theBroadening->GetVector( element->GetIndex() , material->GetTemperature() );
+      if ( physVec != NULL ) 
+      {
+         G4double eKin = dp->GetKineticEnergy();
+         if ( material != lastMaterial || eKin != lastEnergy ) 
+         {
+            lastMaterial = material;
+            lastEnergy = eKin;
+            lastBin = theGrid->FindBin( material , eKin );
+         }
+         if ( lastBin >= 0 ) return theGrid->GetValue( physVec , material , element , lastBin , eKin );
+      }
+   }
+
    G4double xs = GetCrossSection( dp , element , material->GetTemperature() );
    return xs;
 }
@@ -111,6 +144,9 @@ void G4ParticleHPFissionData::BuildPhysicsTable(const G4ParticleDefinition& aP)
 
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetFissionCrossSections();
+      theBroadening = G4ParticleHPManager::GetInstance()->GetBroadenedCrossSections( theCrossSections );
+      theGrid = G4ParticleHPManager::GetInstance()->GetUnionisedGrid( theCrossSections );
+      lastMaterial = 0;
       return;
    }
 
@@ -133,6 +169,45 @@ void G4ParticleHPFissionData::BuildPhysicsTable(const G4ParticleDefinition& aP)
     theCrossSections->push_back(physVec);
   }
 
+   if ( onFlightDB && G4ParticleHPManager::GetInstance()->GetDopplerPreBroadening() )
+   {
+      if ( theBroadening == NULL ) theBroadening = new G4ParticleHPThermalBroadening();
+      theBroadening->Build( theCrossSections , G4Neutron::Neutron()->GetPDGMass() );
+      if ( GetVerboseLevel() > 0 ) 
+         G4cout << "Doppler broadened cross sections of fission reaction of " << G4Neutron::Neutron()->GetParticleName() 
+                << " are computed at initialisation for " << theBroadening->NumberOfVectors() 
+                << " combinations of element and material temperature." << G4endl;
+   }
+   else
+   {
+      delete theBroadening;
+      theBroadening = 0;
+   }
+   G4ParticleHPManager::GetInstance()->RegisterBroadenedCrossSections( theCrossSections , theBroadening );
+
+   G4int gridType = G4ParticleHPManager::GetInstance()->GetUnionisedGridType();
+   if ( gridType == G4ParticleHPUnionisedGrid::fullUnion || gridType == G4ParticleHPUnionisedGrid::hashedUnion )
+   {
+      if ( theGrid != NULL && theGrid->GetType() != gridType ) 
+      {
+         delete theGrid;
+         theGrid = 0;
+      }
+      if ( theGrid == NULL ) theGrid = new G4ParticleHPUnionisedGrid( G4ParticleHPUnionisedGrid::GridType( gridType ) );
+      theGrid->Build( theCrossSections );
+      if ( GetVerboseLevel() > 0 ) 
+         G4cout << ( gridType == G4ParticleHPUnionisedGrid::fullUnion ? "Full" : "Hashed" ) 
+                << " unionised energy grids for cross sections of fission reaction of " << G4Neutron::Neutron()->GetParticleName() 
+                << " use " << theGrid->MemoryUsage()/1024 << " kB." << G4endl;
+   }
+   else
+   {
+      delete theGrid;
+      theGrid = 0;
+   }
+   lastMaterial = 0;
+   G4ParticleHPManager::GetInstance()->RegisterUnionisedGrid( theCrossSections , theGrid );
+
    G4ParticleHPManager::GetInstance()->RegisterFissionCrossSections( theCrossSections );
 }
 
@@ -223,6 +298,13 @@ if ( ( ( *theCrossSections )( index ) )->GetVectorLength() == 0 ) return result;
      return ( (*((*theCrossSections)(index))).GetValue(eKinetic, outOfRange) )* factor; 
   }
 
+  if ( theBroadening != NULL )
+  {
+     // Doppler broadening done at initialisation
+     const G4PhysicsVector* broadened = theBroadening->GetVector( index , aT );
+     if ( broadened != NULL ) return broadened->GetValue( eKinetic , outOfRange );
+  }
+
   // prepare thermal nucleus
   G4Nucleus aNuc;
   G4double eps = 0.0001;
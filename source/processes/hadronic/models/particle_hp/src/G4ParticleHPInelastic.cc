@@ -220,7 +220,8 @@ throw G4HadronicException(__FILE__, __LINE__, "Channel: Do not know what to do w
   G4ParticleHPInelastic::~G4ParticleHPInelastic()
   {
 //    delete [] theInelastic;
-     if ( theInelastic != NULL ) {
+     // The channel lists are owned by the master and shared with the workers
+     if ( theInelastic != NULL && !G4Threading::IsWorkerThread() ) {
      for ( std::vector<G4ParticleHPChannelList*>::iterator 
            it = theInelastic->begin() ; it != theInelastic->end() ; it++ )
      {
@@ -38,6 +38,8 @@
 //
 #include "G4ParticleHPInelasticData.hh"
 #include "G4ParticleHPManager.hh"
+#include "G4ParticleHPThermalBroadening.hh"
+#include "G4ParticleHPUnionisedGrid.hh"
 #include "G4Neutron.hh"
 #include "G4ElementTable.hh"
 #include "G4ParticleHPData.hh"
@@ -79,6 +81,11 @@ G4ParticleHPInelasticData::G4ParticleHPInelasticData(G4ParticleDefinition* proje
   SetMaxKinEnergy( 20*CLHEP::MeV );                                   
 
    onFlightDB = true;
+   theBroadening = 0;
+   theGrid = 0;
+   lastMaterial = 0;
+   lastEnergy = 0.0;
+   lastBin = -1;
    theCrossSections = 0;
    theProjectile=projectile;
 
@@ -95,6 +102,10 @@ G4ParticleHPInelasticData::~G4ParticleHPInelasticData()
      delete theCrossSections;
      theCrossSections = NULL;
    }
+   if ( !G4Threading::IsWorkerThread() ) {
+     delete theBroadening;
+     delete theGrid;
+   }
 }
 
 G4bool G4ParticleHPInelasticData::IsIsoApplicable( const G4DynamicParticle* dp , 
@@ -116,6 +127,28 @@ G4double G4ParticleHPInelasticData::GetIsoCrossSection( const G4DynamicParticle*
                                    const G4Element* element ,
                                    const G4Material* material )
 {
+   if ( theGrid != NULL ) 
+   {
+      // direct lookup on the unionised grid of the material, if the cross 
+      // section does not depend on the motion of the target at the step
+      const G4PhysicsVector* physVec = 0;
+      if ( !onFlightDB ) 
+         physVec = (*theCrossSections)( element->GetIndex() );
+      else if ( theBroadening != NULL ) 
+         physVec = theBroadening->GetVector( element->GetIndex() , material->GetTemperature() );
+      if ( physVec != NULL ) 
+      {
+         G4double eKin = dp->GetKineticEnergy();
+         if ( material != lastMaterial || eKin != lastEnergy ) 
+         {
+            lastMaterial = material;
+            lastEnergy = eKin;
+            lastBin = theGrid->FindBin( material , eKin );
+         }
+         if ( lastBin >= 0 ) return theGrid->GetValue( physVec , material , element , lastBin , eKin );
+      }
+   }
+
    G4double xs = GetCrossSection( dp , element , material->GetTemperature() );
    return xs;
    //return GetCrossSection( dp , element , material->GetTemperature() );
@@ -147,6 +180,9 @@ void G4ParticleHPInelasticData::BuildPhysicsTable( const G4ParticleDefinition& p
 
    if ( G4Threading::IsWorkerThread() ) {
       theCrossSections = G4ParticleHPManager::GetInstance()->GetInelasticCrossSections( &projectile );
+      theBroadening = G4ParticleHPManager::GetInstance()->GetBroadenedCrossSections( theCrossSections );
+      theGrid = G4ParticleHPManager::GetInstance()->GetUnionisedGrid( theCrossSections );
+      lastMaterial = 0;
       return;
    } else {
       if ( theHPData == NULL ) theHPData = G4ParticleHPData::Instance( const_cast<G4ParticleDefinition*> ( &projectile ) ); 
@@ -178,6 +214,45 @@ void G4ParticleHPInelasticData::BuildPhysicsTable( const G4ParticleDefinition& p
     theCrossSections->push_back(physVec);
   }
 
+   if ( onFlightDB && G4ParticleHPManager::GetInstance()->GetDopplerPreBroadening() )
+   {
+      if ( theBroadening == NULL ) theBroadening = new G4ParticleHPThermalBroadening();
+      theBroadening->Build( theCrossSections , projectile.GetPDGMass() );
+      if ( GetVerboseLevel() > 0 ) 
+         G4cout << "Doppler broadened cross sections of inelastic reaction of " << (&projectile)->GetParticleName() 
+                << " are computed at initialisation for " << theBroadening->NumberOfVectors() 
+                << " combinations of element and material temperature." << G4endl;
+   }
+   else
+   {
+      delete theBroadening;
+      theBroadening = 0;
+   }
+   G4ParticleHPManager::GetInstance()->RegisterBroadenedCrossSections( theCrossSections , theBroadening );
+
+   G4int gridType = G4ParticleHPManager::GetInstance()->GetUnionisedGridType();
+   if ( gridType == G4ParticleHPUnionisedGrid::fullUnion || gridType == G4ParticleHPUnionisedGrid::hashedUnion )
+   {
+      if ( theGrid != NULL && theGrid->GetType() != gridType ) 
+      {
+         delete theGrid;
+         theGrid = 0;
+      }
+      if ( theGrid == NULL ) theGrid = new G4ParticleHPUnionisedGrid( G4ParticleHPUnionisedGrid::GridType( gridType ) );
+      theGrid->Build( theCrossSections );
+      if ( GetVerboseLevel() > 0 ) 
+         G4cout << ( gridType == G4ParticleHPUnionisedGrid::fullUnion ? "Full" : "Hashed" ) 
+                << " unionised energy grids for cross sections of inelastic reaction of " << (&projectile)->GetParticleName() 
+                << " use " << theGrid->MemoryUsage()/1024 << " kB." << G4endl;
+   }
+   else
+   {
+      delete theGrid;
+      theGrid = 0;
+   }
+   lastMaterial = 0;
+   G4ParticleHPManager::GetInstance()->RegisterUnionisedGrid( theCrossSections , theGrid );
+
    G4ParticleHPManager::GetInstance()->RegisterInelasticCrossSections( &projectile , theCrossSections );
 }
 
@@ -258,6 +333,13 @@ GetCrossSection(const G4DynamicParticle* projectile, const G4Element*anE, G4doub
 
   }   
 
+  if ( theBroadening != NULL )
+  {
+     // Doppler broadening done at initialisation
+     const G4PhysicsVector* broadened = theBroadening->GetVector( index , aT );
+     if ( broadened != NULL ) return broadened->GetValue( eKinetic , outOfRange );
+  }
+
   G4ReactionProduct theNeutron( projectile->GetDefinition() );
   theNeutron.SetMomentum( projectile->GetMomentum() );
   theNeutron.SetKineticEnergy( eKinetic );
@@ -33,6 +33,7 @@
 #include "G4ParticleHPThreadLocalManager.hh"
 #include "G4ParticleHPMessenger.hh"
 #include "G4HadronicException.hh"
+#include "G4ParticleHPDataPack.hh"
 
 //G4ThreadLocal G4ParticleHPManager* G4ParticleHPManager::instance = NULL;
 G4ParticleHPManager* G4ParticleHPManager::instance = G4ParticleHPManager::GetInstance();
@@ -43,6 +44,8 @@ G4ParticleHPManager::G4ParticleHPManager()
 ,USE_ONLY_PHOTONEVAPORATION(false)
 ,SKIP_MISSING_ISOTOPES(false)
 ,NEGLECT_DOPPLER(false)
+,DOPPLER_PRE_BROADENING(false)
+,UNIONISED_GRID_TYPE(0)
 ,DO_NOT_ADJUST_FINAL_STATE(false)
 ,PRODUCE_FISSION_FRAGMENTS(false)
 ,theElasticCrossSections(NULL)
@@ -64,12 +67,26 @@ G4ParticleHPManager::G4ParticleHPManager()
    if ( getenv( "G4NEUTRONHP_DO_NOT_ADJUST_FINAL_STATE" ) || getenv("G4PHP_DO_NOT_ADJUST_FINAL_STATE") ) DO_NOT_ADJUST_FINAL_STATE = true;
    if ( getenv( "G4NEUTRONHP_USE_ONLY_PHOTONEVAPORATION" ) ) USE_ONLY_PHOTONEVAPORATION = true;
    if ( getenv( "G4NEUTRONHP_NEGLECT_DOPPLER" ) || getenv("G4PHP_NEGLECT_DOPPLER") ) NEGLECT_DOPPLER = true;
+   if ( getenv( "G4PHP_DOPPLER_PRE_BROADENING" ) ) DOPPLER_PRE_BROADENING = true;
+   if ( getenv( "G4PHP_DATA_PACK" ) ) UseDataPack( getenv( "G4PHP_DATA_PACK" ) );
+   if ( getenv( "G4PHP_UNIONISED_GRID" ) ) {
+      G4String gridType = getenv( "G4PHP_UNIONISED_GRID" );
+      if ( gridType == "full" ) UNIONISED_GRID_TYPE = 1;
+      else if ( gridType == "hashed" ) UNIONISED_GRID_TYPE = 2;
+      else if ( gridType != "none" ) {
+         G4ExceptionDescription ed;
+         ed << "Unknown value \"" << gridType << "\" of G4PHP_UNIONISED_GRID, "
+            << "expected none, full or hashed. The unionised grid is not used.";
+         G4Exception( "G4ParticleHPManager::G4ParticleHPManager()" , "Illegal value" , JustWarning , ed );
+      }
+   }
    if ( getenv( "G4NEUTRONHP_SKIP_MISSING_ISOTOPES" ) ) SKIP_MISSING_ISOTOPES = true;
    if ( getenv( "G4NEUTRONHP_PRODUCE_FISSION_FRAGMENTS" ) ) PRODUCE_FISSION_FRAGMENTS = true;
 }
 G4ParticleHPManager::~G4ParticleHPManager()
 {
    delete messenger;
+   for ( size_t i = 0 ; i < theDataPacks.size() ; ++i ) delete theDataPacks[i];
 }
 void G4ParticleHPManager::OpenReactionWhiteBoard()
 {
@@ -102,8 +119,16 @@ void G4ParticleHPManager::GetDataStream( G4String filename , std::istringstream&
    G4String* data=NULL;
    G4String compfilename(filename);
    compfilename += ".z";
-   std::ifstream* in = new std::ifstream ( compfilename , std::ios::binary | std::ios::ate );
-   if ( in->good() )
+   const char* packdata = NULL;
+   size_t packsize = 0;
+   G4bool inPack = FindInDataPacks( filename , packdata , packsize );
+   std::ifstream* in = inPack ? new std::ifstream() : new std::ifstream ( compfilename , std::ios::binary | std::ios::ate );
+   if ( inPack )
+   {
+// Use the mapped data pack, content is already inflated; it is copied
+// since std::istringstream cannot read from an external buffer
+      data = new G4String ( packdata , packsize );
+   } else if ( in->good() )
    {
 // Use the compressed file 
       G4int file_size = in->tellg();
@@ -166,6 +191,10 @@ void G4ParticleHPManager::GetDataStream( G4String filename , std::istringstream&
 // Checking existance of data file 
 void G4ParticleHPManager::GetDataStream2( G4String filename , std::istringstream& iss ) 
 {
+   const char* packdata = NULL;
+   size_t packsize = 0;
+   if ( FindInDataPacks( filename , packdata , packsize ) ) return;
+
    G4String compfilename(filename);
    compfilename += ".z";
    std::ifstream* in = new std::ifstream ( compfilename , std::ios::binary | std::ios::ate );
@@ -187,6 +216,33 @@ void G4ParticleHPManager::GetDataStream2( G4String filename , std::istringstream
    delete in;
 }
 
+G4bool G4ParticleHPManager::FindInDataPacks( const G4String& filename , const char*& data , size_t& size )
+{
+   for ( size_t i = 0 ; i < theDataPacks.size() ; ++i ) {
+      if ( theDataPacks[i]->Find( filename , data , size ) ) return true;
+   }
+   return false;
+}
+
+G4bool G4ParticleHPManager::UseDataPack( const G4String& packFile , const G4String& dataDir )
+{
+   G4ParticleHPDataPack* pack = new G4ParticleHPDataPack( packFile , dataDir );
+   if ( !pack->IsValid() ) {
+      delete pack;
+      return false;
+   }
+   if ( verboseLevel > 0 ) 
+      G4cout << "ParticleHP data files of " << pack->GetDataDirectory() << " are taken from the data pack " 
+             << packFile << " (" << pack->NumberOfFiles() << " files)." << G4endl;
+   theDataPacks.push_back( pack );
+   return true;
+}
+
+G4bool G4ParticleHPManager::WriteDataPack( const G4String& dataDir , const G4String& packFile )
+{
+   return G4ParticleHPDataPack::Write( dataDir , packFile );
+}
+
 void G4ParticleHPManager::SetVerboseLevel( G4int newValue )
 {
    G4cout << "You are setting a new verbose level for Particle HP package." << G4endl;
@@ -221,6 +277,28 @@ void G4ParticleHPManager::RegisterInelasticCrossSections( const G4ParticleDefini
    theInelasticCrossSections.insert( std::pair<const G4ParticleDefinition* , G4PhysicsTable* >( particle , val ) ); 
 }
 
+G4ParticleHPThermalBroadening* G4ParticleHPManager::GetBroadenedCrossSections( const G4PhysicsTable* zeroKelvin ){ 
+   if ( theBroadenedCrossSections.end() != theBroadenedCrossSections.find( zeroKelvin ) )
+      return theBroadenedCrossSections.find( zeroKelvin )->second; 
+   else 
+      return NULL; 
+}
+
+void G4ParticleHPManager::RegisterBroadenedCrossSections( const G4PhysicsTable* zeroKelvin , G4ParticleHPThermalBroadening* val ){ 
+   theBroadenedCrossSections[ zeroKelvin ] = val; 
+}
+
+G4ParticleHPUnionisedGrid* G4ParticleHPManager::GetUnionisedGrid( const G4PhysicsTable* zeroKelvin ){ 
+   if ( theUnionisedGrids.end() != theUnionisedGrids.find( zeroKelvin ) )
+      return theUnionisedGrids.find( zeroKelvin )->second; 
+   else 
+      return NULL; 
+}
+
+void G4ParticleHPManager::RegisterUnionisedGrid( const G4PhysicsTable* zeroKelvin , G4ParticleHPUnionisedGrid* val ){ 
+   theUnionisedGrids[ zeroKelvin ] = val; 
+}
+
 std::vector<G4ParticleHPChannelList*>* G4ParticleHPManager::GetInelasticFinalStates(const G4ParticleDefinition* particle) { 
    if ( theInelasticFSs.end() != theInelasticFSs.find( particle ) )
       return theInelasticFSs.find( particle )->second;
@@ -29,6 +29,9 @@
 #include "G4UIdirectory.hh"
 #include "G4UIcmdWithAString.hh"
 #include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+#include <sstream>
 
 G4ParticleHPMessenger::G4ParticleHPMessenger( G4ParticleHPManager* man )
 :manager(man)
@@ -56,6 +59,47 @@ G4ParticleHPMessenger::G4ParticleHPMessenger( G4ParticleHPManager* man )
    NeglectDopplerCmd->SetCandidates("true false");
    NeglectDopplerCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
 
+   PreBroadeningCmd = new G4UIcmdWithAString("/process/had/particle_hp/Doppler_pre_broadening",this);
+   PreBroadeningCmd->SetGuidance("Compute Doppler broadened cross sections at initialisation for the temperatures of materials,");
+   PreBroadeningCmd->SetGuidance("instead of the on the fly Monte Carlo integration over the thermal motion of the target nucleus.");
+   PreBroadeningCmd->SetGuidance("Ignored if Doppler broadening is neglected.");
+   PreBroadeningCmd->SetParameterName("choice",false);
+   PreBroadeningCmd->SetCandidates("true false");
+   PreBroadeningCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+   UnionisedGridCmd = new G4UIcmdWithAString("/process/had/particle_hp/unionised_grid",this);
+   UnionisedGridCmd->SetGuidance("Lookup of element cross sections on a unionised energy grid of each material.");
+   UnionisedGridCmd->SetGuidance("  none   - search in the vector of each element (default)");
+   UnionisedGridCmd->SetGuidance("  full   - union of energy points of all elements, fastest, largest memory");
+   UnionisedGridCmd->SetGuidance("  hashed - equal bins in log(E) with short search per element, small memory");
+   UnionisedGridCmd->SetGuidance("Used if Doppler broadening is neglected or done at initialisation.");
+   UnionisedGridCmd->SetParameterName("choice",false);
+   UnionisedGridCmd->SetCandidates("none full hashed");
+   UnionisedGridCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+   UseDataPackCmd = new G4UIcommand("/process/had/particle_hp/use_data_pack",this);
+   UseDataPackCmd->SetGuidance("Take data files from a data pack written by write_data_pack.");
+   UseDataPackCmd->SetGuidance("The pack is mapped in memory and shared by all threads and jobs on the node.");
+   UseDataPackCmd->SetGuidance("  packFile : name of the data pack");
+   UseDataPackCmd->SetGuidance("  dataDir  : data directory, if it is not the one used for writing the pack");
+   G4UIparameter* param = new G4UIparameter("packFile",'s',false);
+   UseDataPackCmd->SetParameter(param);
+   param = new G4UIparameter("dataDir",'s',true);
+   param->SetDefaultValue("");
+   UseDataPackCmd->SetParameter(param);
+   UseDataPackCmd->AvailableForStates(G4State_PreInit);
+
+   WriteDataPackCmd = new G4UIcommand("/process/had/particle_hp/write_data_pack",this);
+   WriteDataPackCmd->SetGuidance("Write all files of a data directory (e.g. G4NDL) in a single data pack.");
+   WriteDataPackCmd->SetGuidance("Compressed files are stored inflated.");
+   WriteDataPackCmd->SetGuidance("  dataDir  : data directory");
+   WriteDataPackCmd->SetGuidance("  packFile : name of the data pack");
+   param = new G4UIparameter("dataDir",'s',false);
+   WriteDataPackCmd->SetParameter(param);
+   param = new G4UIparameter("packFile",'s',false);
+   WriteDataPackCmd->SetParameter(param);
+   WriteDataPackCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
    DoNotAdjustFSCmd = new G4UIcmdWithAString("/process/had/particle_hp/do_not_adjust_final_state",this);
    DoNotAdjustFSCmd->SetGuidance("Disable to adjust final state for getting better conservation.");
    DoNotAdjustFSCmd->SetParameterName("choice",false);
@@ -82,6 +126,10 @@ G4ParticleHPMessenger::~G4ParticleHPMessenger()
    delete PhotoEvaCmd;
    delete SkipMissingCmd;
    delete NeglectDopplerCmd;
+   delete PreBroadeningCmd;
+   delete UnionisedGridCmd;
+   delete UseDataPackCmd;
+   delete WriteDataPackCmd;
    delete DoNotAdjustFSCmd;
    delete ProduceFissionFragementCmd;
    delete VerboseCmd;
@@ -101,12 +149,33 @@ void G4ParticleHPMessenger::SetNewValue(G4UIcommand* command,G4String newValue)
    if ( command == NeglectDopplerCmd ) { 
       manager->SetNeglectDoppler( bValue ); 
    }
+   if ( command == PreBroadeningCmd ) { 
+      manager->SetDopplerPreBroadening( bValue ); 
+   }
+   if ( command == UnionisedGridCmd ) { 
+      G4int type = 0;
+      if ( newValue == "full" ) type = 1;
+      if ( newValue == "hashed" ) type = 2;
+      manager->SetUnionisedGridType( type ); 
+   }
    if ( command == DoNotAdjustFSCmd ) { 
       manager->SetDoNotAdjustFinalState( bValue ); 
    }
    if ( command == ProduceFissionFragementCmd ) { 
       manager->SetProduceFissionFragments( bValue ); 
    }
+   if ( command == UseDataPackCmd ) {
+      G4String packFile, dataDir;
+      std::istringstream is( newValue );
+      is >> packFile >> dataDir;
+      manager->UseDataPack( packFile , dataDir );
+   }
+   if ( command == WriteDataPackCmd ) {
+      G4String dataDir, packFile;
+      std::istringstream is( newValue );
+      is >> dataDir >> packFile;
+      manager->WriteDataPack( dataDir , packFile );
+   }
    if ( command == VerboseCmd ) {
       manager->SetVerboseLevel( VerboseCmd->ConvertToInt( newValue ) ); 
    }
@@ -0,0 +1,190 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 261019 First implementation of Doppler pre-broadening
+//
+#include "G4ParticleHPThermalBroadening.hh"
+#include "G4PhysicalConstants.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4PhysicsTable.hh"
+#include "G4LPhysicsFreeVector.hh"
+#include "G4Material.hh"
+#include "G4Element.hh"
+#include "G4NucleiProperties.hh"
+#include <algorithm>
+#include <cmath>
+
+G4ParticleHPThermalBroadening::G4ParticleHPThermalBroadening()
+{;}
+
+G4ParticleHPThermalBroadening::~G4ParticleHPThermalBroadening()
+{
+   Clear();
+}
+
+void G4ParticleHPThermalBroadening::Clear()
+{
+   for ( size_t i = 0 ; i < theTable.size() ; ++i ) {
+      for ( size_t j = 0 ; j < theTable[i].size() ; ++j ) delete theTable[i][j].second;
+   }
+   theTable.clear();
+}
+
+size_t G4ParticleHPThermalBroadening::NumberOfVectors() const
+{
+   size_t n = 0;
+   for ( size_t i = 0 ; i < theTable.size() ; ++i ) n += theTable[i].size();
+   return n;
+}
+
+G4double G4ParticleHPThermalBroadening::
+TargetMassRatio( const G4Element* anE , G4double massOfProjectile )
+{
+   // same target mass as used in the on the fly Doppler broadening
+   G4double eps = 0.0001;
+   G4double theA = anE->GetN();
+   G4double theZ = anE->GetZ();
+   return G4NucleiProperties::GetNuclearMass( static_cast<G4int>(theA+eps) , static_cast<G4int>(theZ+eps) ) / massOfProjectile;
+}
+
+void G4ParticleHPThermalBroadening::
+Build( const G4PhysicsTable* zeroKelvinTable , G4double massOfProjectile )
+{
+   Clear();
+   if ( zeroKelvinTable == NULL ) return;
+   theTable.resize( zeroKelvinTable->size() );
+
+   const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
+   for ( size_t im = 0 ; im < theMaterialTable->size() ; ++im ) {
+      const G4Material* aMat = (*theMaterialTable)[im];
+      G4double aT = aMat->GetTemperature();
+      const G4ElementVector* theElementVector = aMat->GetElementVector();
+      for ( size_t ie = 0 ; ie < aMat->GetNumberOfElements() ; ++ie ) {
+         const G4Element* anE = (*theElementVector)[ie];
+         size_t index = anE->GetIndex();
+         if ( index >= theTable.size() || (*zeroKelvinTable)(index) == NULL ) continue;
+         if ( GetVector( index , aT ) != NULL ) continue;
+         G4PhysicsVector* physVec = Broaden( (*zeroKelvinTable)(index) , 
+                                             TargetMassRatio( anE , massOfProjectile ) , aT );
+         theTable[index].push_back( std::pair< G4double , G4PhysicsVector* >( aT , physVec ) );
+      }
+   }
+}
+
+G4PhysicsVector* G4ParticleHPThermalBroadening::
+Broaden( const G4PhysicsVector* zeroKelvin , G4double theA , G4double aT )
+{
+   // Free gas kernel in reduced velocities x = v/vT and y = vrel/vT,
+   // vT^2 = 2kT/M, so that x^2 = A*E/kT:
+   // sigma(x) = 1/(sqrt(pi) x^2) Int_0^inf dy y^2 sigma(y) 
+   //            * [ exp(-(y-x)^2) - exp(-(y+x)^2) ]
+   // The integral is done piecewise between the points of the 0 K grid,
+   // where the cross section is linear in energy, by Simpson rule 
+   // with a step in y not larger than 0.25
+
+   const G4double range = 4.0;
+   const G4double maxStep = 0.25;
+
+   size_t len = zeroKelvin->GetVectorLength();
+   G4LPhysicsFreeVector* theResult = new G4LPhysicsFreeVector( len , 
+      len > 0 ? zeroKelvin->Energy(0) : 0. , len > 0 ? zeroKelvin->Energy(len-1) : 0. );
+   if ( len == 0 ) return theResult;
+
+   std::vector<G4double> en( len );
+   std::vector<G4double> xs( len );
+   for ( size_t i = 0 ; i < len ; ++i ) {
+      en[i] = zeroKelvin->Energy(i);
+      xs[i] = std::max( 0.0 , (*zeroKelvin)[i] );
+   }
+
+   G4double kT = k_Boltzmann*aT;
+   if ( kT <= 0.0 || theA <= 0.0 ) {
+      for ( size_t i = 0 ; i < len ; ++i ) theResult->PutValues( i , en[i] , (*zeroKelvin)[i] );
+      return theResult;
+   }
+   G4double eUnit = kT/theA;
+   G4double norm = 1.0/std::sqrt( pi );
+
+   std::vector<G4double> yPoints;
+   for ( size_t i = 0 ; i < len ; ++i ) {
+      G4double x = std::sqrt( en[i]/eUnit );
+      if ( x <= 0.0 ) { 
+         theResult->PutValues( i , en[i] , (*zeroKelvin)[i] );
+         continue;
+      }
+      G4double yLow = std::max( 0.0 , x - range );
+      G4double yHigh = x + range;
+
+      // integration points: window edges and grid points inside
+      size_t first = std::upper_bound( en.begin() , en.end() , yLow*yLow*eUnit ) - en.begin();
+      yPoints.clear();
+      yPoints.push_back( yLow );
+      size_t last = first;
+      while ( last < len && en[last] < yHigh*yHigh*eUnit ) { 
+         yPoints.push_back( std::sqrt( en[last]/eUnit ) );
+         ++last;
+      }
+      yPoints.push_back( yHigh );
+
+      G4double sum = 0.0;
+      for ( size_t k = 0 ; k+1 < yPoints.size() ; ++k ) {
+         G4double ya = yPoints[k];
+         G4double yb = yPoints[k+1];
+         if ( yb <= ya ) continue;
+
+         // grid interval containing this piece; constant outside the grid
+         G4int j = G4int(first + k) - 1;
+         G4double e1 = 0.0, s1 = 0.0, slope = 0.0;
+         if ( j < 0 ) { 
+            s1 = xs[0]; 
+         } else if ( j >= G4int(len) - 1 ) {
+            s1 = xs[len-1];
+         } else {
+            e1 = en[j];
+            s1 = xs[j];
+            slope = ( xs[j+1] - xs[j] )/( en[j+1] - en[j] ); 
+         }
+
+         G4int nStep = 2*G4int( std::ceil( 0.5*(yb-ya)/maxStep ) );
+         G4double h = (yb-ya)/nStep;
+         for ( G4int n = 0 ; n <= nStep ; ++n ) {
+            G4double y = ya + n*h;
+            G4double sig = s1;
+            if ( slope != 0.0 ) sig += slope*( y*y*eUnit - e1 );
+            G4double kernel;
+            if ( x < 2.0 ) { 
+               kernel = 2.0*std::exp( -(y*y + x*x) )*std::sinh( 2.0*x*y );
+            } else {
+               kernel = std::exp( -(y-x)*(y-x) ) - std::exp( -(y+x)*(y+x) );
+            }
+            G4double w = ( n == 0 || n == nStep ) ? 1.0 : ( (n%2 == 1) ? 4.0 : 2.0 );
+            sum += w*h/3.0*y*y*sig*kernel;
+         }
+      }
+      theResult->PutValues( i , en[i] , norm*sum/(x*x) );
+   }
+   return theResult;
+}
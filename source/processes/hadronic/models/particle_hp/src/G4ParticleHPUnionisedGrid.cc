@@ -0,0 +1,160 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+// 261019 First implementation of unionised energy grid
+//
+#include "G4ParticleHPUnionisedGrid.hh"
+#include "G4PhysicsTable.hh"
+#include "G4Material.hh"
+#include "G4Element.hh"
+
+G4ParticleHPUnionisedGrid::G4ParticleHPUnionisedGrid( GridType type , G4int nHashBins )
+:theType(type)
+,nBins(std::max(1,nHashBins))
+,logEmin(0.0)
+,invLogStep(0.0)
+{;}
+
+G4ParticleHPUnionisedGrid::~G4ParticleHPUnionisedGrid()
+{;}
+
+size_t G4ParticleHPUnionisedGrid::MemoryUsage() const
+{
+   size_t mem = 0;
+   for ( size_t i = 0 ; i < thePoints.size() ; ++i ) {
+      mem += thePoints[i].size()*sizeof(G4int) + theElements[i].size()*sizeof(G4int);
+   }
+   for ( size_t i = 0 ; i < theEnergies.size() ; ++i ) mem += theEnergies[i].size()*sizeof(G4double);
+   return mem;
+}
+
+void G4ParticleHPUnionisedGrid::Build( const G4PhysicsTable* elementTable )
+{
+   theEnergies.clear();
+   thePoints.clear();
+   theElements.clear();
+   if ( elementTable == NULL || theType == noUnion ) return;
+
+   const G4MaterialTable* theMaterialTable = G4Material::GetMaterialTable();
+   size_t nMaterials = theMaterialTable->size();
+   theEnergies.resize( nMaterials );
+   thePoints.resize( nMaterials );
+   theElements.resize( nMaterials );
+
+   // elements of materials having data
+   G4double emin = DBL_MAX;
+   G4double emax = 0.0;
+   for ( size_t im = 0 ; im < nMaterials ; ++im ) {
+      const G4Material* aMat = (*theMaterialTable)[im];
+      const G4ElementVector* theElementVector = aMat->GetElementVector();
+      for ( size_t ie = 0 ; ie < aMat->GetNumberOfElements() ; ++ie ) {
+         size_t index = (*theElementVector)[ie]->GetIndex();
+         const G4PhysicsVector* v = ( index < elementTable->size() ) ? (*elementTable)(index) : 0;
+         if ( v == NULL || v->GetVectorLength() == 0 ) continue;
+         theElements[im].push_back( index );
+         for ( size_t i = 0 ; i < v->GetVectorLength() ; ++i ) {
+            if ( v->Energy(i) > 0.0 ) { emin = std::min( emin , v->Energy(i) ); break; }
+         }
+         emax = std::max( emax , v->GetMaxEnergy() );
+      }
+   }
+   if ( emax <= emin ) return;
+
+   logEmin = std::log( emin );
+   invLogStep = nBins/( std::log( emax ) - logEmin );
+
+   for ( size_t im = 0 ; im < nMaterials ; ++im ) {
+      size_t nEl = theElements[im].size();
+      if ( nEl == 0 ) continue;
+
+      // points of the grid of this material
+      std::vector<G4double> grid;
+      if ( theType == fullUnion ) {
+         for ( size_t k = 0 ; k < nEl ; ++k ) {
+            const G4PhysicsVector* v = (*elementTable)(theElements[im][k]);
+            for ( size_t i = 0 ; i < v->GetVectorLength() ; ++i ) grid.push_back( v->Energy(i) );
+         }
+         std::sort( grid.begin() , grid.end() );
+         grid.erase( std::unique( grid.begin() , grid.end() ) , grid.end() );
+      } else {
+         grid.resize( nBins + 1 );
+         for ( G4int b = 0 ; b <= nBins ; ++b ) grid[b] = std::exp( logEmin + b/invLogStep );
+         grid[nBins] = emax;
+      }
+
+      // last point of each element not above the grid point
+      size_t nPoints = grid.size();
+      std::vector<G4int>& points = thePoints[im];
+      points.resize( nPoints*nEl );
+      for ( size_t k = 0 ; k < nEl ; ++k ) {
+         const G4PhysicsVector* v = (*elementTable)(theElements[im][k]);
+         size_t len = v->GetVectorLength();
+         size_t j = 0;
+         for ( size_t u = 0 ; u < nPoints ; ++u ) {
+            while ( j+1 < len && v->Energy(j+1) <= grid[u] ) ++j;
+            points[u*nEl + k] = j;
+         }
+      }
+      if ( theType == fullUnion ) theEnergies[im].swap( grid );
+   }
+}
+
+G4int G4ParticleHPUnionisedGrid::
+FindPoint( const G4PhysicsVector* v , G4double energy , G4int iLow , G4int iHigh )
+{
+   while ( iHigh - iLow > 1 ) {
+      G4int iMid = ( iLow + iHigh )/2;
+      if ( v->Energy(iMid) <= energy ) iLow = iMid;
+      else iHigh = iMid;
+   }
+   return ( v->Energy(iHigh) <= energy ) ? iHigh : iLow;
+}
+
+G4double G4ParticleHPUnionisedGrid::
+GetValue( const G4PhysicsVector* v , const G4Material* aMat , 
+          const G4Element* anE , G4int bin , G4double energy ) const
+{
+   size_t len = v->GetVectorLength();
+   if ( len == 0 ) return 0.0;
+   if ( energy <= v->Energy(0) ) return (*v)[0];
+
+   size_t im = aMat->GetIndex();
+   const std::vector<G4int>& elements = theElements[im];
+   size_t nEl = elements.size();
+   size_t slot = 0;
+   while ( slot < nEl && elements[slot] != (G4int)anE->GetIndex() ) ++slot;
+   if ( bin < 0 || slot == nEl ) return v->Value( energy );
+
+   G4int i = thePoints[im][bin*nEl + slot];
+   if ( theType == hashedUnion ) {
+      i = FindPoint( v , energy , i , thePoints[im][(bin+1)*nEl + slot] );
+   }
+   if ( i >= G4int(len) - 1 ) return (*v)[len-1];
+
+   G4double e1 = v->Energy(i);
+   G4double e2 = v->Energy(i+1);
+   return (*v)[i] + ( (*v)[i+1] - (*v)[i] )*( energy - e1 )/( e2 - e1 );
+}
@@ -53,6 +53,7 @@
 #include "G4SystemOfUnits.hh"
 
 #include "G4DiffractiveExcitation.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4FTFParameters.hh"
 #include "G4ElasticHNScattering.hh"
 
@@ -265,7 +266,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
   G4double ProbExc( 0.0 ); 
   if ( QeExc + QeNoExc != 0.0 ) ProbExc = QeExc/(QeExc + QeNoExc);
   G4double DeltaProbAtQuarkExchange = theParameters->GetDeltaProbAtQuarkExchange();
-  G4double DeltaMass = G4ParticleTable::GetParticleTable()->FindParticle( 2224 )->GetPDGMass();
+  G4double DeltaMass = G4PDGCodeTable::FindParticle( 2224 )->GetPDGMass();
 
   G4double ProbOfDiffraction = ProbProjectileDiffraction + ProbTargetDiffraction;
 
@@ -462,7 +463,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
        #endif
 
 //     --------------------------------------------------------------------------------- Proj 
-       TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode );
+       TestParticle = G4PDGCodeTable::FindParticle( NewProjCode );
        if(!TestParticle) continue;
 
 //MminProjectile=TestParticle->GetPDGMass();            // ??????????????????????
@@ -506,7 +507,7 @@ G4bool G4DiffractiveExcitation::ExciteParticipants( G4VSplitableHadron*    proje
          NewTargCode +=2;                                              // Save initial nucleon
        } else {}
 
-       TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode );
+       TestParticle = G4PDGCodeTable::FindParticle( NewTargCode );
 
        if(!TestParticle) continue;
        
@@ -712,7 +713,7 @@ M0target = MtestTr;
        }
 */
 //     --------------------------------------------------------------------------------- Proj 
-       TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode );
+       TestParticle = G4PDGCodeTable::FindParticle( NewProjCode );
        if(!TestParticle) continue;
 
        MminProjectile=BrW.GetMinimumMass(TestParticle);
@@ -722,7 +723,7 @@ M0target = MtestTr;
        MtestPr = BrW.SampleMass(TestParticle,TestParticle->GetPDGMass() + 5.0*TestParticle->GetPDGWidth()); 
 
 //     --------------------------------------------------------------------------------- Targ 
-       TestParticle = G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode );
+       TestParticle = G4PDGCodeTable::FindParticle( NewTargCode );
        if(!TestParticle) continue;
 
        MminTarget=BrW.GetMinimumMass(TestParticle);
@@ -768,8 +769,8 @@ M0target = MtestTr;
 
     if ( PZcms2 < 0 ) return false;  // It can be if energy is not sufficient for Delta
 
-    projectile->SetDefinition( G4ParticleTable::GetParticleTable()->FindParticle( NewProjCode ) ); 
-    target->SetDefinition( G4ParticleTable::GetParticleTable()->FindParticle( NewTargCode ) ); 
+    projectile->SetDefinition( G4PDGCodeTable::FindParticle( NewProjCode ) ); 
+    target->SetDefinition( G4PDGCodeTable::FindParticle( NewTargCode ) ); 
 
     PZcms = std::sqrt( PZcms2 );
     Pprojectile.setPz( PZcms );
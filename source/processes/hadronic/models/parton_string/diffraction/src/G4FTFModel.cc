@@ -42,6 +42,7 @@
 #include <utility> 
 
 #include "G4FTFModel.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4ios.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
@@ -3022,7 +3023,7 @@ GenerateDeltaIsobar( const G4double sqrtS,                  // input parameter
       G4int newPdgCode = pdgCode/10; newPdgCode = newPdgCode*10 + 4; // Delta
       if ( splitableHadron->GetDefinition()->GetPDGEncoding() < 0 ) newPdgCode *= -1;
       const G4ParticleDefinition* ptr = 
-        G4ParticleTable::GetParticleTable()->FindParticle( newPdgCode );
+        G4PDGCodeTable::FindParticle( newPdgCode );
       splitableHadron->SetDefinition( ptr );
       G4double massDelta = std::sqrt( sqr( splitableHadron->GetDefinition()->GetPDGMass() )
                                       + splitableHadron->Get4Momentum().perp2() );
@@ -43,6 +43,7 @@
 #include "G4ThreeVector.hh"
 #include "G4LorentzVector.hh"
 #include "G4ParticleDefinition.hh"
+#include "G4Allocator.hh"
 
 class G4ExcitedString;
 
@@ -62,6 +63,11 @@ class G4FragmentingString
       ~G4FragmentingString();
 
       G4FragmentingString& operator=(const G4FragmentingString &);
+
+      //  new/delete operators are overloded to use G4Allocator
+      inline void *operator new(size_t);
+      inline void operator delete(void *aString);
+
       int operator==(const G4FragmentingString &right) const;
 
       int operator!=(const G4FragmentingString &right) const;
@@ -108,6 +114,27 @@ class G4FragmentingString
       DecaySide decaying; 
 };
 
+#if defined G4HADRONIC_ALLOC_EXPORT
+  extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4FragmentingString> *pFragmentingStringAllocator;
+#else
+  extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4FragmentingString> *pFragmentingStringAllocator;
+#endif
+
+inline
+void * G4FragmentingString::operator new(size_t)
+{
+	if (!pFragmentingStringAllocator) {
+	  pFragmentingStringAllocator = new G4Allocator<G4FragmentingString>;
+	}
+	return (void *) pFragmentingStringAllocator->MallocSingle();
+}
+
+inline
+void G4FragmentingString::operator delete(void * aString)
+{
+	pFragmentingStringAllocator->FreeSingle((G4FragmentingString *) aString);
+}
+
 inline
 int G4FragmentingString::operator==(const G4FragmentingString &right) const
 {
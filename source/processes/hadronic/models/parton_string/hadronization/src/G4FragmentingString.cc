@@ -39,6 +39,8 @@
 #include "G4FragmentingString.hh"
 #include "G4ExcitedString.hh"
 
+G4ThreadLocal G4Allocator<G4FragmentingString> *pFragmentingStringAllocator = 0;
+
 //---------------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------------
@@ -35,6 +35,7 @@
 // -----------------------------------------------------------------------------
 
 #include "G4HadronBuilder.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
 #include "G4HadronicException.hh"
@@ -150,7 +151,7 @@ G4ParticleDefinition * G4HadronBuilder::Meson(G4ParticleDefinition * black,
 	   
 	   
 	G4ParticleDefinition * MesonDef=
-		G4ParticleTable::GetParticleTable()->FindParticle(PDGEncoding);
+		G4PDGCodeTable::FindParticle(PDGEncoding);
 #ifdef G4VERBOSE
 	if (MesonDef == 0 ) {
 		G4cerr << " G4HadronBuilder - Warning: No particle for PDGcode= "
@@ -253,7 +254,7 @@ G4ParticleDefinition * G4HadronBuilder::Barion(G4ParticleDefinition * black,
 
 
 	G4ParticleDefinition * BarionDef=
-		G4ParticleTable::GetParticleTable()->FindParticle(PDGEncoding);
+		G4PDGCodeTable::FindParticle(PDGEncoding);
 #ifdef G4VERBOSE
 	if (BarionDef == 0 ) {
 		G4cerr << " G4HadronBuilder - Warning: No particle for PDGcode= "
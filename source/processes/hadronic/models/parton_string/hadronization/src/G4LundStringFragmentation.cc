@@ -33,6 +33,7 @@
 //      History: first implementation, Maxim Komogorov, 10-Jul-1998
 // -----------------------------------------------------------------------------
 #include "G4LundStringFragmentation.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "Randomize.hh"
@@ -1166,7 +1167,7 @@ Diquark_AntiDiquark_aboveThreshold_lastSplitting(G4FragmentingString * & string,
                 G4int loopCounter = 0;
 		do  // while(Meson[AbsIDquark-1][ProdQ-1][StateQ]<>0);
 		{
-			LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+			LeftHadron=G4PDGCodeTable::FindParticle(
 							-Baryon[ADi_q1-1][ADi_q2-1][ProdQ-1][StateADiQ]);
 			G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1177,7 +1178,7 @@ Diquark_AntiDiquark_aboveThreshold_lastSplitting(G4FragmentingString * & string,
                         G4int internalLoopCounter = 0;
 			do // while(Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]<>0);
 			{
-				RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(
+				RightHadron=G4PDGCodeTable::FindParticle(
 								+Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]);
 				G4double RightHadronMass=RightHadron->GetPDGMass();
 
@@ -1283,7 +1284,7 @@ Quark_Diquark_lastSplitting(G4FragmentingString * & string,
                 G4int loopCounter = 0;
 		do  // while(Meson[AbsIDquark-1][ProdQ-1][StateQ]<>0);
 		{
-			LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(SignQ*
+			LeftHadron=G4PDGCodeTable::FindParticle(SignQ*
 							Meson[AbsIDquark-1][ProdQ-1][StateQ]);
 			G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1292,7 +1293,7 @@ Quark_Diquark_lastSplitting(G4FragmentingString * & string,
                         G4int internalLoopCounter = 0;
 			do // while(Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]<>0);
 			{
-				RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(SignDiQ*
+				RightHadron=G4PDGCodeTable::FindParticle(SignDiQ*
 								Baryon[Di_q1-1][Di_q2-1][ProdQ-1][StateDiQ]);
 				G4double RightHadronMass=RightHadron->GetPDGMass();
 
@@ -1385,7 +1386,7 @@ Quark_AntiQuark_lastSplitting(G4FragmentingString * & string,
                 G4int loopCounter = 0;
 		do  // while(Meson[AbsIDquark-1][ProdQ-1][StateQ]<>0);
 		{
-			LeftHadron=G4ParticleTable::GetParticleTable()->FindParticle(SignQ*
+			LeftHadron=G4PDGCodeTable::FindParticle(SignQ*
 						       Meson[AbsIDquark-1][ProdQ-1][StateQ]);
 			G4double LeftHadronMass=LeftHadron->GetPDGMass();
 
@@ -1394,7 +1395,7 @@ Quark_AntiQuark_lastSplitting(G4FragmentingString * & string,
                         G4int internalLoopCounter = 0;
 			do // while(Meson[AbsIDanti_quark-1][ProdQ-1][StateAQ]<>0);
 			{
-				RightHadron=G4ParticleTable::GetParticleTable()->FindParticle(SignAQ*
+				RightHadron=G4PDGCodeTable::FindParticle(SignAQ*
 								Meson[AbsIDanti_quark-1][ProdQ-1][StateAQ]);
 				G4double RightHadronMass=RightHadron->GetPDGMass();
 
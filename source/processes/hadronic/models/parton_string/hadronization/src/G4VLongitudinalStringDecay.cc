@@ -33,6 +33,7 @@
 //               redesign  Gunter Folger, August/September 2001
 // -----------------------------------------------------------------------------
 #include "G4VLongitudinalStringDecay.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4PhysicalConstants.hh"
 #include "G4SystemOfUnits.hh"
 #include "G4ios.hh"
@@ -280,7 +281,7 @@ G4double G4VLongitudinalStringDecay::FragmentationMass(
 
 G4ParticleDefinition* G4VLongitudinalStringDecay::FindParticle(G4int Encoding) 
    {
-   G4ParticleDefinition* ptr = G4ParticleTable::GetParticleTable()->FindParticle(Encoding);
+   G4ParticleDefinition* ptr = G4PDGCodeTable::FindParticle(Encoding);
       if (ptr == NULL)
        {
        G4cout << "Particle with encoding "<<Encoding<<" does not exist!!!"<<G4endl;
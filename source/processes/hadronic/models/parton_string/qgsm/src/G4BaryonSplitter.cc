@@ -28,6 +28,7 @@
 // Numbers verified and errors corrected, HPW Dec 1999
 
 #include "G4BaryonSplitter.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4ParticleTable.hh"
 
 G4BaryonSplitter::
@@ -74,7 +75,7 @@ G4BaryonSplitter()
 G4bool G4BaryonSplitter::
 SplitBarion(G4int PDGCode, G4int* q_or_qqbar, G4int* qbar_or_qq)
 {
-	const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+	const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4PDGCodeTable::FindParticle(PDGCode));
 
 	if(aBaryon==NULL)
 	{
@@ -92,7 +93,7 @@ SplitBarion(G4int PDGCode, G4int* q_or_qqbar, G4int* qbar_or_qq)
 const G4SPBaryon & G4BaryonSplitter::
 GetSPBaryon(G4int PDGCode)
 {
-	return *theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+	return *theBaryons.GetBaryon(G4PDGCodeTable::FindParticle(PDGCode));
 }
 
 
@@ -100,7 +101,7 @@ GetSPBaryon(G4int PDGCode)
 G4bool G4BaryonSplitter::
 FindDiquark(G4int PDGCode, G4int Quark, G4int* Diquark)
 {
-	const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4ParticleTable::GetParticleTable()->FindParticle(PDGCode));
+	const G4SPBaryon * aBaryon = theBaryons.GetBaryon(G4PDGCodeTable::FindParticle(PDGCode));
 	if(aBaryon)
 	{
 		aBaryon->FindDiquark(Quark, *Diquark);
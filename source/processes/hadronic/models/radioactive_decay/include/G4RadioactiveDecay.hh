@@ -76,7 +76,7 @@ class G4RadioactiveDecaymessenger;
 
 typedef std::vector<G4RadioactiveDecayRateVector> G4RadioactiveDecayRateTable;
 typedef std::vector<G4RadioactiveDecayRate> G4RadioactiveDecayRates;
-typedef std::map<G4String, G4DecayTable*> DecayTableMap;
+typedef std::map<const G4ParticleDefinition*, G4DecayTable*> DecayTableMap;
 
 
 class G4RadioactiveDecay : public G4VRestDiscreteProcess 
@@ -164,6 +164,14 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     // Allow the user to replace the radio-active decay data provided in Geant4
     // by its own data file for a given isotope
 
+    G4int WriteBinaryDatabase(const G4String& filename);
+    // Compile the data files of G4RADIOACTIVEDATA for the isotopes within
+    // theNucleusLimits into one binary file
+
+    G4bool LoadBinaryDatabase(const G4String& filename);
+    // Read the binary file at initialisation; decay tables of its isotopes
+    // are then built without access to the data files
+
 
     inline void  SetVerboseLevel(G4int value) {verboseLevel = value;}
     // Sets the VerboseLevel which controls duggering display
@@ -210,6 +218,20 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     inline G4int GetSplitNuclei () {return NSplit;}
     //  Returns the N number used for the Nuclei spliting bias scheme
 
+    inline void SetDecayChainMode (G4bool r) {decayChainMode = r;}
+    // Controls whether, in analogue mode, daughter nuclei decaying within
+    // the chain time window are decayed in place; only their radiation
+    // products are tracked, with the sampled decay times
+
+    inline G4bool IsDecayChainMode () const {return decayChainMode;}
+
+    inline void SetChainTimeWindow (G4double t) {chainTimeWindow = t;}
+    // Sets the time after the first decay within which daughters are
+    // decayed in place; daughters surviving it are tracked as ions at rest
+    // from the end of the window
+
+    inline G4double GetChainTimeWindow () const {return chainTimeWindow;}
+
     inline void SetDecayDirection(const G4ThreeVector& theDir) {
       forceDecayDirection = theDir.unit();
     }
@@ -259,6 +281,11 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
 
     G4int GetDecayTimeBin(const G4double aDecayTime);
 
+    // Decay the daughter nuclei in products within the chain time window,
+    // collect the remaining products and their times in chainProducts
+    void CollapseDecayChain(G4DecayProducts* products, G4double decayTime,
+                            G4double& energyDeposit);
+
   private:
 
     G4RadioactiveDecay(const G4RadioactiveDecay &right);
@@ -278,6 +305,12 @@ class G4RadioactiveDecay : public G4VRestDiscreteProcess
     G4bool applyICM;
     G4bool applyARM;
 
+    // Decay chain mode
+    G4bool decayChainMode;
+    G4double chainTimeWindow;
+    std::vector<G4DynamicParticle*> chainProducts;
+    std::vector<G4double> chainTimes;
+
     // Parameters for pre-collimated (biased) decay products
     G4ThreeVector forceDecayDirection;
     G4double      forceDecayHalfAngle;
@@ -0,0 +1,130 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+#ifndef G4RadioactiveDecayDatabase_h
+#define G4RadioactiveDecayDatabase_h 1
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// MODULE:              G4RadioactiveDecayDatabase.hh
+//
+// Date:                19/10/26
+//
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// DESCRIPTION
+// -----------
+//
+// Decay records of the RadioactiveDecay database (z<Z>.a<A> files) for
+// a range of nuclides, compiled into one binary file indexed by the 
+// nuclide key 1000*A+Z. The binary file is read at once and shared by
+// all threads, so that decay tables are built without file access 
+// during the run. The same parser is used for the text files.
+//
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+////////////////////////////////////////////////////////////////////////////////
+//
+#include "globals.hh"
+#include "G4NucleusLimits.hh"
+#include "G4Threading.hh"
+#include <vector>
+#include <iostream>
+
+////////////////////////////////////////////////////////////////////////////////
+//
+class G4RadioactiveDecayDatabase
+{
+  // class description
+  // Binary, integer-keyed store of radioactive decay records.
+  // class description - end
+
+  public:
+
+    // One data line of a parent level: decay mode, daughter level (keV),
+    // branching ratio, Q value (keV) and beta decay type
+    struct Record {
+      G4double a;
+      G4double b;
+      G4double c;
+      G4int    mode;
+      G4int    betaType;
+    };
+
+    // Parent level with excitation energy (keV) and its records
+    struct Level {
+      G4double energy;
+      G4int    first;
+      G4int    n;
+    };
+
+    static G4RadioactiveDecayDatabase* GetInstance();
+
+    ~G4RadioactiveDecayDatabase();
+
+  public: // with description
+
+    static G4int WriteBinaryFile(const G4String& dirName,
+                                 const G4String& fileName,
+                                 const G4NucleusLimits& limits);
+    // Compiles the text files of dirName for nuclides within limits into
+    // fileName. Returns the number of nuclides written, -1 on error.
+
+    G4bool LoadBinaryFile(const G4String& fileName);
+    // Reads all data of the binary file, the file already loaded is kept.
+    // Must be called before the event loop.
+
+    inline G4bool IsLoaded() const { return !nuclides.empty(); }
+
+    G4bool GetRecords(G4int Z, G4int A, G4double levelEnergy, 
+                      G4double tolerance, std::vector<Record>& records,
+                      G4bool& found) const;
+    // Returns false if the nuclide is not in the binary database, 
+    // otherwise fills the records of the level if it is found
+
+    static void ParseFile(std::istream& in, std::vector<Level>& levels,
+                          std::vector<Record>& records);
+    // Reads all parent levels of one text file
+
+  private:
+
+    G4RadioactiveDecayDatabase();
+    G4RadioactiveDecayDatabase(const G4RadioactiveDecayDatabase&);
+    G4RadioactiveDecayDatabase& operator=(const G4RadioactiveDecayDatabase&);
+
+    struct Nuclide {
+      G4int key;
+      G4int first;
+      G4int n;
+    };
+
+    static G4RadioactiveDecayDatabase* theInstance;
+    static G4Mutex databaseMutex;
+
+    G4String loadedFile;
+    std::vector<Nuclide> nuclides;   // sorted by key
+    std::vector<Level>   levels;
+    std::vector<Record>  records;
+};
+
+#endif
@@ -101,6 +101,8 @@ public: //with description
   G4UIcmdWithABool               *analoguemcCmd;
   G4UIcmdWithABool               *fbetaCmd;
   G4UIcmdWithABool               *brbiasCmd;
+  G4UIcmdWithABool               *chainModeCmd;
+  G4UIcmdWithADoubleAndUnit      *chainWindowCmd;
   G4UIcmdWithAnInteger           *splitnucleiCmd;
   G4UIcmdWithAnInteger           *verboseCmd;
   G4UIcmdWithAString             *avolumeCmd;
@@ -114,6 +116,9 @@ public: //with description
   G4UIcommand					 *userDecayDataCmd;
   G4UIcommand					 *userEvaporationDataCmd;
 
+  G4UIcmdWithAString             *writeBinaryDataCmd;
+  G4UIcmdWithAString             *loadBinaryDataCmd;
+
   G4UIcmdWith3Vector             *colldirCmd;
   G4UIcmdWithADoubleAndUnit      *collangleCmd;
 
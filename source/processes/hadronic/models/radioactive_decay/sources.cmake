@@ -74,6 +74,7 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_radioactivedecay
 	G4ProtonDecayChannel.hh
         G4RIsotopeTable.hh
         G4RadioactiveDecay.hh
+        G4RadioactiveDecayDatabase.hh
         G4RadioactiveDecayMode.hh
         G4RadioactiveDecayRate.hh
         G4RadioactiveDecayRateVector.hh
@@ -96,6 +97,7 @@ GEANT4_DEFINE_MODULE(NAME G4hadronic_radioactivedecay
         G4ProtonDecay.cc
         G4RIsotopeTable.cc
         G4RadioactiveDecay.cc
+        G4RadioactiveDecayDatabase.cc
         G4RadioactiveDecayMode.cc
         G4RadioactiveDecayRate.cc
         G4RadioactiveDecayRateVector.cc
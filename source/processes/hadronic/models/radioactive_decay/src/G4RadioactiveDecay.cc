@@ -44,6 +44,13 @@
 // CHANGE HISTORY
 // --------------
 //
+// 19 Oct  2026, decay chain mode: daughters decaying within a time window
+//                are decayed in place, only their products are tracked
+//
+// 19 Oct  2026, optional binary database of decay records 
+//                (G4RadioactiveDecayDatabase), decay tables keyed by
+//                particle definition instead of name
+//
 // 13 Oct  2015, L.G. Sarmiento Neutron emission added
 //
 // 06 Aug  2014, L.G. Sarmiento Proton decay mode added mimicking the alpha decay
@@ -99,6 +106,7 @@
 ///////////////////////////////////////////////////////////////////////////////
 //
 #include "G4RadioactiveDecay.hh"
+#include "G4RadioactiveDecayDatabase.hh"
 #include "G4RadioactiveDecaymessenger.hh"
 
 #include "G4SystemOfUnits.hh"
@@ -201,6 +209,8 @@ G4RadioactiveDecay::G4RadioactiveDecay(const G4String& processName)
   applyICM    = true ;
   applyARM    = true ;
   halflifethreshold = nanosecond;
+  decayChainMode  = false;
+  chainTimeWindow = DBL_MAX;
 
   // RDM applies to all logical volumes by default
   isAllVolumesMode = true;
@@ -242,13 +252,12 @@ G4bool G4RadioactiveDecay::IsApplicable(const G4ParticleDefinition& aParticle)
 
 G4DecayTable* G4RadioactiveDecay::GetDecayTable(const G4ParticleDefinition* aNucleus)
 {
-  G4String key = aNucleus->GetParticleName();
-  DecayTableMap::iterator table_ptr = dkmap->find(key);
+  DecayTableMap::iterator table_ptr = dkmap->find(aNucleus);
 
   G4DecayTable* theDecayTable = 0;
   if (table_ptr == dkmap->end() ) {              // If table not there,     
     theDecayTable = LoadDecayTable(*aNucleus);   // load from file and
-    (*dkmap)[key] = theDecayTable;               // store in library 
+    (*dkmap)[aNucleus] = theDecayTable;          // store in library 
   } else {
     theDecayTable = table_ptr->second;
   }
@@ -748,8 +757,7 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
 #ifdef G4MULTITHREADED
   G4AutoLock lk(&G4RadioactiveDecay::radioactiveDecayMutex);
 
-  G4String key = theParentNucleus.GetParticleName();
-  DecayTableMap::iterator master_table_ptr = master_dkmap->find(key);
+  DecayTableMap::iterator master_table_ptr = master_dkmap->find(&theParentNucleus);
 
   if (master_table_ptr != master_dkmap->end() ) {   // If table is there              
     return master_table_ptr->second;
@@ -759,27 +767,54 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
   // Create and initialise variables used in the method.
   theDecayTable = new G4DecayTable();
 
+  // Decay records of the parent level are taken from the binary database 
+  // if it contains the nuclide, otherwise they are read from the data file
+  std::vector<G4RadioactiveDecayDatabase::Record> records;
+  G4bool found(false);
+  G4bool hasData(false);
+
   //Check if data have been provided by the user
   G4String file= theUserRadioactiveDataFiles[1000*A+Z];
 
-  if (file =="") {
-    if (!getenv("G4RADIOACTIVEDATA") ) {
-      G4cout << "Please setenv G4RADIOACTIVEDATA to point to the radioactive decay data files."
-             << G4endl;
-      throw G4HadronicException(__FILE__, __LINE__, " Please setenv G4RADIOACTIVEDATA to point to the radioactive decay data files.");
+  if (file == "" &&
+      G4RadioactiveDecayDatabase::GetInstance()->GetRecords(Z, A, levelEnergy,
+                                                            levelTolerance,
+                                                            records, found) ) {
+    hasData = true;
+  } else {
+    if (file =="") {
+      if (!getenv("G4RADIOACTIVEDATA") ) {
+        G4cout << "Please setenv G4RADIOACTIVEDATA to point to the radioactive decay data files."
+               << G4endl;
+        throw G4HadronicException(__FILE__, __LINE__, " Please setenv G4RADIOACTIVEDATA to point to the radioactive decay data files.");
+      }
+      G4String dirName = getenv("G4RADIOACTIVEDATA");
+
+      std::ostringstream os;
+      os <<dirName <<"/z" <<Z <<".a" <<A <<'\0';
+      file = os.str();
     }
-    G4String dirName = getenv("G4RADIOACTIVEDATA");
 
-    std::ostringstream os;
-    os <<dirName <<"/z" <<Z <<".a" <<A <<'\0';
-    file = os.str();
+    std::ifstream DecaySchemeFile(file);
+    if (DecaySchemeFile) {
+      hasData = true;
+      std::vector<G4RadioactiveDecayDatabase::Level> levels;
+      std::vector<G4RadioactiveDecayDatabase::Record> allRecords;
+      G4RadioactiveDecayDatabase::ParseFile(DecaySchemeFile, levels, allRecords);
+      for (size_t i = 0; i < levels.size(); i++) {
+        if (std::abs(levels[i].energy*keV - levelEnergy) < levelTolerance) {
+          records.assign(allRecords.begin() + levels[i].first,
+                         allRecords.begin() + levels[i].first + levels[i].n);
+          found = true;
+          break;
+        }
+      }
+    }
+    DecaySchemeFile.close();
   }
 
-  std::ifstream DecaySchemeFile(file);
-
-  G4bool found(false);
-  if (DecaySchemeFile) { 
-    // Initialise variables used for reading in radioactive decay data.
+  if (hasData) { 
+    // Initialise variables used for building the decay channels
     const G4int nMode = 9;
     G4bool modeFirstRecord[nMode];
     G4double modeTotalBR[nMode] = {0.0};
@@ -789,241 +824,193 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
       modeSumBR[i] = 0.0;
     }
 
-    G4bool complete(false);
-    char inputChars[100]={' '};
-    G4String inputLine;
-    G4String recordType("");
     G4RadioactiveDecayMode theDecayMode;
     G4double a(0.0);
     G4double b(0.0);
     G4double c(0.0);
     G4BetaDecayType betaType(allowed);
 
-    // Loop through each data file record until you identify the decay
-    // data relating to the nuclide of concern.
+    // Loop over the decay records of the parent level
+    for (size_t ir = 0; ir < records.size(); ir++) {
+      theDecayMode = G4RadioactiveDecayMode(records[ir].mode);
+      a = records[ir].a/1000.;
+      b = records[ir].b;
+      c = records[ir].c/1000.;
+      betaType = G4BetaDecayType(records[ir].betaType);
 
-    G4int loop = 0;
-    G4ExceptionDescription ed;
-    ed << " While count exceeded " << G4endl;
- 
-    while (!complete && !DecaySchemeFile.getline(inputChars, 100).eof()) {  /* Loop checking, 01.09.2015, D.Wright */
-      loop++;
-      if (loop > 100000) {
-        G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_100", JustWarning, ed);
+      switch (theDecayMode) {
+
+        case IT:   // Isomeric transition
+        {
+          G4ITDecay* anITChannel = new G4ITDecay(&theParentNucleus, b,
+                                                 c*MeV, a*MeV);
+//                anITChannel->DumpNuclearInfo();
+          anITChannel->SetHLThreshold(halflifethreshold);
+          anITChannel->SetARM(applyARM);
+          theDecayTable->Insert(anITChannel);
+        }
         break;
-      }
- 
-      inputLine = inputChars;
-      inputLine = inputLine.strip(1);
-      if (inputChars[0] != '#' && inputLine.length() != 0) {
-        std::istringstream tmpStream(inputLine);
-
-        if (inputChars[0] == 'P') {
-          // Nucleus is a parent type.  Check excitation level to see if it
-          // matches that of theParentNucleus
-          tmpStream >> recordType >> a >> b;
-          if (found) {
-            complete = true;
-          } else {
-            found = (std::abs(a*keV - levelEnergy) < levelTolerance);
-          }
 
-        } else if (found) {
-          // The right part of the radioactive decay data file has been found.  Search
-          // through it to determine the mode of decay of the subsequent records.
-          if (inputChars[0] == 'W') {
-#ifdef G4VERBOSE
-            if (GetVerboseLevel() > 0) {
-              // a comment line identified and print out the message
-              G4cout << " Warning in G4RadioactiveDecay::LoadDecayTable " << G4endl;
-              G4cout << "   In data file " << file << G4endl;
-              G4cout << "   " << inputLine << G4endl;
-            }
-#endif
+        case BetaMinus:
+        {
+          if (modeFirstRecord[1]) {
+            modeFirstRecord[1] = false;
+            modeTotalBR[1] = b;
           } else {
-            tmpStream >> theDecayMode >> a >> b >> c >> betaType;
-            // Allowed transitions are the default. Forbidden transitions are
-            // indicated in the last column.
-            if (inputLine.length() < 80) betaType = allowed;
-            a /= 1000.;
-            c /= 1000.;
-
-            switch (theDecayMode) {
-
-              case IT:   // Isomeric transition
-              {
-                G4ITDecay* anITChannel = new G4ITDecay(&theParentNucleus, b,
-                                                       c*MeV, a*MeV);
-//                anITChannel->DumpNuclearInfo();
-                anITChannel->SetHLThreshold(halflifethreshold);
-                anITChannel->SetARM(applyARM);
-                theDecayTable->Insert(anITChannel);
-              }
-              break;
-
-              case BetaMinus:
-              {
-                if (modeFirstRecord[1]) {
-                  modeFirstRecord[1] = false;
-                  modeTotalBR[1] = b;
-                } else {
-                  if (c > 0.) {
-                    G4BetaMinusDecay* aBetaMinusChannel =
-                      new G4BetaMinusDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                           betaType);
+            if (c > 0.) {
+              G4BetaMinusDecay* aBetaMinusChannel =
+                new G4BetaMinusDecay(&theParentNucleus, b, c*MeV, a*MeV,
+                                     betaType);
 //                    aBetaMinusChannel->DumpNuclearInfo();
-                    aBetaMinusChannel->SetHLThreshold(halflifethreshold);
-                    theDecayTable->Insert(aBetaMinusChannel);
-                    modeSumBR[1] += b;
-                  } // c > 0
-                } // if not first record
-              }
-              break;
-
-              case BetaPlus:
-              {
-                if (modeFirstRecord[2]) {
-                  modeFirstRecord[2] = false;
-                  modeTotalBR[2] = b;
-                } else {
-                  G4BetaPlusDecay* aBetaPlusChannel =
-                    new G4BetaPlusDecay(&theParentNucleus, b, c*MeV, a*MeV,
-                                        betaType);
+              aBetaMinusChannel->SetHLThreshold(halflifethreshold);
+              theDecayTable->Insert(aBetaMinusChannel);
+              modeSumBR[1] += b;
+            } // c > 0
+          } // if not first record
+        }
+        break;
+
+        case BetaPlus:
+        {
+          if (modeFirstRecord[2]) {
+            modeFirstRecord[2] = false;
+            modeTotalBR[2] = b;
+          } else {
+            G4BetaPlusDecay* aBetaPlusChannel =
+              new G4BetaPlusDecay(&theParentNucleus, b, c*MeV, a*MeV,
+                                  betaType);
 //                  aBetaPlusChannel->DumpNuclearInfo();
-                  aBetaPlusChannel->SetHLThreshold(halflifethreshold);
-                  theDecayTable->Insert(aBetaPlusChannel);
-                  modeSumBR[2] += b;
-                } // if not first record
-              }
-              break;
+            aBetaPlusChannel->SetHLThreshold(halflifethreshold);
+            theDecayTable->Insert(aBetaPlusChannel);
+            modeSumBR[2] += b;
+          } // if not first record
+        }
+        break;
 
-              case KshellEC:  // K-shell electron capture
+        case KshellEC:  // K-shell electron capture
 
-                if (modeFirstRecord[3]) {
-                  modeFirstRecord[3] = false;
-                  modeTotalBR[3] = b;
-                } else {
-                  G4ECDecay* aKECChannel = new G4ECDecay(&theParentNucleus, b,
-                                                         c*MeV, a*MeV, KshellEC);
+          if (modeFirstRecord[3]) {
+            modeFirstRecord[3] = false;
+            modeTotalBR[3] = b;
+          } else {
+            G4ECDecay* aKECChannel = new G4ECDecay(&theParentNucleus, b,
+                                                   c*MeV, a*MeV, KshellEC);
 //                  aKECChannel->DumpNuclearInfo();
-                  aKECChannel->SetHLThreshold(halflifethreshold);
-                  aKECChannel->SetARM(applyARM);
-                  theDecayTable->Insert(aKECChannel);
-                  modeSumBR[3] += b;
-                }
-                break;
-
-              case LshellEC:  // L-shell electron capture
-
-                if (modeFirstRecord[4]) {
-                  modeFirstRecord[4] = false;
-                  modeTotalBR[4] = b;
-                } else {
-                  G4ECDecay* aLECChannel = new G4ECDecay(&theParentNucleus, b,
-                                                         c*MeV, a*MeV, LshellEC);
+            aKECChannel->SetHLThreshold(halflifethreshold);
+            aKECChannel->SetARM(applyARM);
+            theDecayTable->Insert(aKECChannel);
+            modeSumBR[3] += b;
+          }
+          break;
+
+        case LshellEC:  // L-shell electron capture
+
+          if (modeFirstRecord[4]) {
+            modeFirstRecord[4] = false;
+            modeTotalBR[4] = b;
+          } else {
+            G4ECDecay* aLECChannel = new G4ECDecay(&theParentNucleus, b,
+                                                   c*MeV, a*MeV, LshellEC);
 //                  aLECChannel->DumpNuclearInfo();
-                  aLECChannel->SetHLThreshold(halflifethreshold);
-                  aLECChannel->SetARM(applyARM);
-                  theDecayTable->Insert(aLECChannel);
-                  modeSumBR[4] += b;
-                }
-                break;
-
-              case MshellEC:  // M-shell electron capture
-                              // In this implementation it is added to L-shell case
-                if (modeFirstRecord[5]) {
-                  modeFirstRecord[5] = false;
-                  modeTotalBR[5] = b;
-                } else {
-                  G4ECDecay* aMECChannel = new G4ECDecay(&theParentNucleus, b,
-                                                         c*MeV, a*MeV, MshellEC);
+            aLECChannel->SetHLThreshold(halflifethreshold);
+            aLECChannel->SetARM(applyARM);
+            theDecayTable->Insert(aLECChannel);
+            modeSumBR[4] += b;
+          }
+          break;
+
+        case MshellEC:  // M-shell electron capture
+                        // In this implementation it is added to L-shell case
+          if (modeFirstRecord[5]) {
+            modeFirstRecord[5] = false;
+            modeTotalBR[5] = b;
+          } else {
+            G4ECDecay* aMECChannel = new G4ECDecay(&theParentNucleus, b,
+                                                   c*MeV, a*MeV, MshellEC);
 //                  aMECChannel->DumpNuclearInfo();
-                  aMECChannel->SetHLThreshold(halflifethreshold);
-                  aMECChannel->SetARM(applyARM);
-                  theDecayTable->Insert(aMECChannel);
-                  modeSumBR[5] += b;
-                }
-                break;
-
-              case Alpha:
-            	if (modeFirstRecord[6]) {
-                  modeFirstRecord[6] = false;
-                  modeTotalBR[6] = b;
-                } else {
-                  G4AlphaDecay* anAlphaChannel =
-                     new G4AlphaDecay(&theParentNucleus, b, c*MeV, a*MeV);
+            aMECChannel->SetHLThreshold(halflifethreshold);
+            aMECChannel->SetARM(applyARM);
+            theDecayTable->Insert(aMECChannel);
+            modeSumBR[5] += b;
+          }
+          break;
+
+        case Alpha:
+          if (modeFirstRecord[6]) {
+            modeFirstRecord[6] = false;
+            modeTotalBR[6] = b;
+          } else {
+            G4AlphaDecay* anAlphaChannel =
+               new G4AlphaDecay(&theParentNucleus, b, c*MeV, a*MeV);
 //                  anAlphaChannel->DumpNuclearInfo();
-                  anAlphaChannel->SetHLThreshold(halflifethreshold);
-                  theDecayTable->Insert(anAlphaChannel);
-                  modeSumBR[6] += b;
-                }
-                break;
-
-	      case Proton:
-            	  if (modeFirstRecord[7]) {
-                  modeFirstRecord[7] = false;
-                  modeTotalBR[7] = b;
-                } else {
-                  G4ProtonDecay* aProtonChannel =
-                     new G4ProtonDecay(&theParentNucleus, b, c*MeV, a*MeV);
+            anAlphaChannel->SetHLThreshold(halflifethreshold);
+            theDecayTable->Insert(anAlphaChannel);
+            modeSumBR[6] += b;
+          }
+          break;
+
+        case Proton:
+          if (modeFirstRecord[7]) {
+            modeFirstRecord[7] = false;
+            modeTotalBR[7] = b;
+          } else {
+            G4ProtonDecay* aProtonChannel =
+               new G4ProtonDecay(&theParentNucleus, b, c*MeV, a*MeV);
 //                  aProtonChannel->DumpNuclearInfo();
-                  aProtonChannel->SetHLThreshold(halflifethreshold);
-                  theDecayTable->Insert(aProtonChannel);
-                  modeSumBR[7] += b;
-                }
-                break;
-
-              case Neutron:
-            	  if (modeFirstRecord[8]) {
-                  modeFirstRecord[8] = false;
-                  modeTotalBR[8] = b;
-                } else {
-                  G4NeutronDecay* aNeutronChannel =
-                     new G4NeutronDecay(&theParentNucleus, b, c*MeV, a*MeV);
+            aProtonChannel->SetHLThreshold(halflifethreshold);
+            theDecayTable->Insert(aProtonChannel);
+            modeSumBR[7] += b;
+          }
+          break;
+
+        case Neutron:
+          if (modeFirstRecord[8]) {
+            modeFirstRecord[8] = false;
+            modeTotalBR[8] = b;
+          } else {
+            G4NeutronDecay* aNeutronChannel =
+               new G4NeutronDecay(&theParentNucleus, b, c*MeV, a*MeV);
 //                  aNeutronChannel->DumpNuclearInfo();
-                  aNeutronChannel->SetHLThreshold(halflifethreshold);
-                  theDecayTable->Insert(aNeutronChannel);
-                  modeSumBR[8] += b;
-                }
-                break;
-              case BDProton:
-                  // Not yet implemented
-                  // G4cout << " beta-delayed proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case BDNeutron:
-                  // Not yet implemented
-                  // G4cout << " beta-delayed neutron decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case Beta2Minus:
-                  // Not yet implemented
-                  // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case Beta2Plus:
-                  // Not yet implemented
-                  // G4cout << " Double beta+ decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case Proton2:
-                  // Not yet implemented
-                  // G4cout << " Double proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case Neutron2:
-                  // Not yet implemented
-                  // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
-                  break;
-              case SpFission:
-            	  // Not yet implemented
-            	  //G4cout<<"Sp fission channel"<<a<<'\t'<<b<<'\t'<<c<<std::endl;
-            	  break;
-              case RDM_ERROR:
-
-              default:
-                G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_000",
-                            FatalException, "Selected decay mode does not exist");
-            }  // switch
-	  }  // if char == W
-        }  // if char == P
-      }  // if char != #
-    }  // While
+            aNeutronChannel->SetHLThreshold(halflifethreshold);
+            theDecayTable->Insert(aNeutronChannel);
+            modeSumBR[8] += b;
+          }
+          break;
+        case BDProton:
+            // Not yet implemented
+            // G4cout << " beta-delayed proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case BDNeutron:
+            // Not yet implemented
+            // G4cout << " beta-delayed neutron decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case Beta2Minus:
+            // Not yet implemented
+            // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case Beta2Plus:
+            // Not yet implemented
+            // G4cout << " Double beta+ decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case Proton2:
+            // Not yet implemented
+            // G4cout << " Double proton decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case Neutron2:
+            // Not yet implemented
+            // G4cout << " Double beta- decay, a = " << a << ", b = " << b << ", c = " << c << G4endl;
+            break;
+        case SpFission:
+          // Not yet implemented
+          //G4cout<<"Sp fission channel"<<a<<'\t'<<b<<'\t'<<c<<std::endl;
+          break;
+        case RDM_ERROR:
+
+        default:
+          G4Exception("G4RadioactiveDecay::LoadDecayTable()", "HAD_RDM_000",
+                      FatalException, "Selected decay mode does not exist");
+      }  // switch
+    }  // for records
 
     // Go through the decay table and make sure that the branching ratios are
     // correctly normalised.
@@ -1043,8 +1030,7 @@ G4RadioactiveDecay::LoadDecayTable(const G4ParticleDefinition& theParentNucleus)
 	theChannel->SetBR(theBR*modeTotalBR[theDecayMode]/modeSumBR[theDecayMode]);
       }
     }
-  }   // if (DecaySchemeFile)	
-  DecaySchemeFile.close();
+  }   // if (hasData)
 
   if (!found && levelEnergy > 0) {
     // Case where IT cascade for excited isotopes has no entries in RDM database
@@ -1088,6 +1074,39 @@ G4RadioactiveDecay::AddUserDecayDataFile(G4int Z, G4int A, G4String filename)
 }
 
 
+G4int
+G4RadioactiveDecay::WriteBinaryDatabase(const G4String& filename)
+{
+  if (!getenv("G4RADIOACTIVEDATA") ) {
+    G4cout << "Please setenv G4RADIOACTIVEDATA to point to the radioactive decay data files."
+           << G4endl;
+    return -1;
+  }
+  G4String dirName = getenv("G4RADIOACTIVEDATA");
+  G4int n = G4RadioactiveDecayDatabase::WriteBinaryFile(dirName, filename,
+                                                        theNucleusLimits);
+  if (n >= 0) {
+    G4cout << "G4RadioactiveDecay: " << n << " isotopes of " << dirName
+           << " are written to " << filename << G4endl;
+  }
+  return n;
+}
+
+
+G4bool
+G4RadioactiveDecay::LoadBinaryDatabase(const G4String& filename)
+{
+  G4bool ok = G4RadioactiveDecayDatabase::GetInstance()->LoadBinaryFile(filename);
+#ifdef G4VERBOSE
+  if (ok && GetVerboseLevel() > 0) {
+    G4cout << "G4RadioactiveDecay: decay data are read from " << filename
+           << G4endl;
+  }
+#endif
+  return ok;
+}
+
+
 void
 G4RadioactiveDecay::SetDecayRate(G4int theZ, G4int theA, G4double theE, 
                                  G4int theG, std::vector<G4double> theRates, 
@@ -1649,6 +1668,10 @@ G4RadioactiveDecay::DecayIt(const G4Track& theTrack, const G4Step&)
 
       // Add products in theParticleChangeForRadDecay.
       G4int numberOfSecondaries = products->entries();
+      if (decayChainMode) {
+        CollapseDecayChain(products, finalGlobalTime, energyDeposit);
+        numberOfSecondaries = chainProducts.size();
+      }
       fParticleChangeForRadDecay.SetNumberOfSecondaries(numberOfSecondaries);
 #ifdef G4VERBOSE
       if (GetVerboseLevel()>1) {
@@ -1664,8 +1687,9 @@ G4RadioactiveDecay::DecayIt(const G4Track& theTrack, const G4Step&)
       }
 #endif
       for (index=0; index < numberOfSecondaries; index++) {
-        G4Track* secondary = new G4Track(products->PopProducts(),
-                                         finalGlobalTime, currentPosition);
+        G4Track* secondary = decayChainMode ?
+          new G4Track(chainProducts[index], chainTimes[index], currentPosition) :
+          new G4Track(products->PopProducts(), finalGlobalTime, currentPosition);
         secondary->SetGoodForTrackingFlag();
         secondary->SetTouchableHandle(theTrack.GetTouchableHandle());
         fParticleChangeForRadDecay.AddSecondary(secondary);
@@ -1893,6 +1917,86 @@ G4RadioactiveDecay::DoDecay(const G4ParticleDefinition& theParticleDef)
 }
 
 
+// Decay chain mode: a daughter nucleus which decays within chainTimeWindow
+// of the first decay is stopped at the decay point, its recoil energy is
+// deposited locally and it is decayed here with a decay time sampled from
+// its mean life. Sampling each member in turn follows the Bateman solution
+// of the chain, so the emitted radiation keeps analogue weights and times
+// while no track is created for the intermediate nuclei. Stable daughters
+// are returned as ions at their creation time. A daughter which survives
+// the window is returned at rest at the end of the window, its recoil
+// energy being deposited locally; since the decay law has no memory, the
+// decay time resampled from there when it is tracked is unbiased.
+
+void G4RadioactiveDecay::CollapseDecayChain(G4DecayProducts* products,
+                                            G4double decayTime,
+                                            G4double& energyDeposit)
+{
+  chainProducts.clear();
+  chainTimes.clear();
+
+  std::vector<G4DynamicParticle*> pending;
+  std::vector<G4double> pendingTimes;
+  while (products->entries() > 0) {
+    pending.push_back(products->PopProducts());
+    pendingTimes.push_back(decayTime);
+  }
+
+  // Protection against loops in the decay data
+  const G4int maxChainDecays = 1000;
+  G4int nDecays = 0;
+
+  while (!pending.empty()) {
+    G4DynamicParticle* daughter = pending.back();
+    G4double time = pendingTimes.back();
+    pending.pop_back();
+    pendingTimes.pop_back();
+
+    const G4ParticleDefinition* theDef = daughter->GetDefinition();
+    if (theDef->GetBaryonNumber() >= 5 && nDecays < maxChainDecays &&
+        IsApplicable(*theDef)) {
+      G4DecayTable* theDecayTable = GetDecayTable(theDef);
+      if (theDecayTable != 0 && theDecayTable->entries() > 0) {
+        G4double temptime = -std::log(G4UniformRand())
+                            *theDef->GetPDGLifeTime();
+        if (temptime < 0.) temptime = 0.;
+
+        if (time + temptime - decayTime <= chainTimeWindow) {
+          G4DecayProducts* daughterProducts = DoDecay(*theDef);
+          if (daughterProducts != 0 && daughterProducts->entries() > 1) {
+#ifdef G4VERBOSE
+            if (GetVerboseLevel() > 1) {
+              G4cout << "G4RadioactiveDecay::CollapseDecayChain : "
+                     << theDef->GetParticleName() << " decayed at "
+                     << (time + temptime)/ns << "[ns]" << G4endl;
+            }
+#endif
+            // Products are in the rest frame of the stopped daughter
+            energyDeposit += daughter->GetKineticEnergy();
+            delete daughter;
+            ++nDecays;
+            while (daughterProducts->entries() > 0) {
+              pending.push_back(daughterProducts->PopProducts());
+              pendingTimes.push_back(time + temptime);
+            }
+            delete daughterProducts;
+            continue;
+          }
+          delete daughterProducts;
+        } else {
+          // survived the window: it cannot decay before its end
+          energyDeposit += daughter->GetKineticEnergy();
+          daughter->SetKineticEnergy(0.0);
+          time = decayTime + chainTimeWindow;
+        }
+      }
+    }
+    chainProducts.push_back(daughter);
+    chainTimes.push_back(time);
+  }
+}
+
+
 // Apply directional bias for "visible" daughters (e+-, gamma, n, p, alpha)
 
 void G4RadioactiveDecay::CollimateDecay(G4DecayProducts* products) {
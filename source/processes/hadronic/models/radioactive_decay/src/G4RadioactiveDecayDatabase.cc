@@ -0,0 +1,253 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+//
+// MODULE:              G4RadioactiveDecayDatabase.cc
+//
+// Date:                19/10/26
+//
+// %%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%%
+////////////////////////////////////////////////////////////////////////////////
+//
+#include "G4RadioactiveDecayDatabase.hh"
+#include "G4RadioactiveDecayMode.hh"
+#include "G4BetaDecayType.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4AutoLock.hh"
+#include "G4ios.hh"
+
+#include <fstream>
+#include <sstream>
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+  // file identifier and format version
+  const char binaryTag[8] = {'G','4','R','D','B','I','N','1'};
+}
+
+G4Mutex G4RadioactiveDecayDatabase::databaseMutex = G4MUTEX_INITIALIZER;
+
+G4RadioactiveDecayDatabase* G4RadioactiveDecayDatabase::GetInstance()
+{
+  static G4RadioactiveDecayDatabase theDatabase;
+  return &theDatabase;
+}
+
+G4RadioactiveDecayDatabase::G4RadioactiveDecayDatabase()
+{}
+
+G4RadioactiveDecayDatabase::~G4RadioactiveDecayDatabase()
+{}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Same reading as was done in G4RadioactiveDecay::LoadDecayTable, but all
+// parent levels are kept. Warning records are skipped.
+
+void G4RadioactiveDecayDatabase::ParseFile(std::istream& in,
+                                           std::vector<Level>& theLevels,
+                                           std::vector<Record>& theRecords)
+{
+  char inputChars[100]={' '};
+  G4String inputLine;
+  G4String recordType("");
+  G4RadioactiveDecayMode theDecayMode;
+  G4double a(0.0);
+  G4double b(0.0);
+  G4double c(0.0);
+  G4BetaDecayType betaType(allowed);
+
+  G4int loop = 0;
+  G4ExceptionDescription ed;
+  ed << " While count exceeded " << G4endl;
+
+  while (!in.getline(inputChars, 100).eof()) {  /* Loop checking, 01.09.2015, D.Wright */
+    loop++;
+    if (loop > 100000) {
+      G4Exception("G4RadioactiveDecayDatabase::ParseFile()", "HAD_RDM_100", JustWarning, ed);
+      break;
+    }
+
+    inputLine = inputChars;
+    inputLine = inputLine.strip(1);
+    if (inputChars[0] == '#' || inputLine.length() == 0) continue;
+    std::istringstream tmpStream(inputLine);
+
+    if (inputChars[0] == 'P') {
+      tmpStream >> recordType >> a >> b;
+      Level level;
+      level.energy = a;
+      level.first = theRecords.size();
+      level.n = 0;
+      theLevels.push_back(level);
+
+    } else if (!theLevels.empty() && inputChars[0] != 'W') {
+      tmpStream >> theDecayMode >> a >> b >> c >> betaType;
+      // Allowed transitions are the default. Forbidden transitions are
+      // indicated in the last column.
+      if (inputLine.length() < 80) betaType = allowed;
+      Record record;
+      record.a = a;
+      record.b = b;
+      record.c = c;
+      record.mode = theDecayMode;
+      record.betaType = betaType;
+      theRecords.push_back(record);
+      theLevels.back().n++;
+    }
+  }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+
+G4int G4RadioactiveDecayDatabase::WriteBinaryFile(const G4String& dirName,
+                                                  const G4String& fileName,
+                                                  const G4NucleusLimits& limits)
+{
+  std::vector<Nuclide> theNuclides;
+  std::vector<Level>   theLevels;
+  std::vector<Record>  theRecords;
+
+  for (G4int Z = std::max(1, limits.GetZMin()); Z <= limits.GetZMax(); ++Z) {
+    for (G4int A = std::max(Z, limits.GetAMin()); A <= limits.GetAMax(); ++A) {
+      std::ostringstream os;
+      os << dirName << "/z" << Z << ".a" << A;
+      std::ifstream in(os.str().c_str());
+      if (!in) continue;
+
+      Nuclide nuclide;
+      nuclide.key = 1000*A + Z;
+      nuclide.first = theLevels.size();
+      ParseFile(in, theLevels, theRecords);
+      nuclide.n = theLevels.size() - nuclide.first;
+      theNuclides.push_back(nuclide);
+    }
+  }
+  // keys are increasing in A for each Z, the index is sorted by key
+  std::sort(theNuclides.begin(), theNuclides.end(), 
+            [](const Nuclide& n1, const Nuclide& n2) { return n1.key < n2.key; });
+
+  std::ofstream out(fileName, std::ios::out | std::ios::binary);
+  if (!out) {
+    G4ExceptionDescription ed;
+    ed << "Cannot open file " << fileName;
+    G4Exception("G4RadioactiveDecayDatabase::WriteBinaryFile()", "HAD_RDM_101",
+                JustWarning, ed);
+    return -1;
+  }
+  G4int nN = theNuclides.size();
+  G4int nL = theLevels.size();
+  G4int nR = theRecords.size();
+  out.write(binaryTag, sizeof(binaryTag));
+  out.write((const char*)&nN, sizeof(G4int));
+  out.write((const char*)&nL, sizeof(G4int));
+  out.write((const char*)&nR, sizeof(G4int));
+  if (nN > 0) out.write((const char*)&theNuclides[0], nN*sizeof(Nuclide));
+  if (nL > 0) out.write((const char*)&theLevels[0], nL*sizeof(Level));
+  if (nR > 0) out.write((const char*)&theRecords[0], nR*sizeof(Record));
+  out.close();
+  return nN;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+
+G4bool G4RadioactiveDecayDatabase::LoadBinaryFile(const G4String& fileName)
+{
+  G4AutoLock lk(&databaseMutex);
+  if (fileName == loadedFile) return true;
+
+  std::ifstream in(fileName, std::ios::in | std::ios::binary);
+  char tag[sizeof(binaryTag)];
+  G4int nN(-1), nL(-1), nR(-1);
+  if (in) {
+    in.read(tag, sizeof(binaryTag));
+    in.read((char*)&nN, sizeof(G4int));
+    in.read((char*)&nL, sizeof(G4int));
+    in.read((char*)&nR, sizeof(G4int));
+  }
+  if (!in || std::memcmp(tag, binaryTag, sizeof(binaryTag)) != 0 ||
+      nN < 0 || nL < 0 || nR < 0) {
+    G4ExceptionDescription ed;
+    ed << "File " << fileName << " is not a radioactive decay binary database";
+    G4Exception("G4RadioactiveDecayDatabase::LoadBinaryFile()", "HAD_RDM_102",
+                JustWarning, ed);
+    return false;
+  }
+
+  std::vector<Nuclide> theNuclides(nN);
+  std::vector<Level>   theLevels(nL);
+  std::vector<Record>  theRecords(nR);
+  if (nN > 0) in.read((char*)&theNuclides[0], nN*sizeof(Nuclide));
+  if (nL > 0) in.read((char*)&theLevels[0], nL*sizeof(Level));
+  if (nR > 0) in.read((char*)&theRecords[0], nR*sizeof(Record));
+  if (!in) {
+    G4ExceptionDescription ed;
+    ed << "File " << fileName << " is truncated";
+    G4Exception("G4RadioactiveDecayDatabase::LoadBinaryFile()", "HAD_RDM_102",
+                JustWarning, ed);
+    return false;
+  }
+
+  nuclides.swap(theNuclides);
+  levels.swap(theLevels);
+  records.swap(theRecords);
+  loadedFile = fileName;
+  return true;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+
+G4bool G4RadioactiveDecayDatabase::GetRecords(G4int Z, G4int A,
+                                              G4double levelEnergy,
+                                              G4double tolerance,
+                                              std::vector<Record>& theRecords,
+                                              G4bool& found) const
+{
+  found = false;
+  if (nuclides.empty()) return false;
+
+  G4int key = 1000*A + Z;
+  std::vector<Nuclide>::const_iterator it = 
+    std::lower_bound(nuclides.begin(), nuclides.end(), key,
+                     [](const Nuclide& n, G4int k) { return n.key < k; });
+  if (it == nuclides.end() || it->key != key) return false;
+
+  for (G4int i = it->first; i < it->first + it->n; ++i) {
+    const Level& level = levels[i];
+    if (std::abs(level.energy*keV - levelEnergy) < tolerance) {
+      theRecords.assign(records.begin() + level.first,
+                        records.begin() + level.first + level.n);
+      found = true;
+      break;
+    }
+  }
+  return true;
+}
@@ -117,6 +117,21 @@ G4RadioactiveDecaymessenger::G4RadioactiveDecaymessenger
   brbiasCmd->SetParameterName("BRBias",true);
   brbiasCmd->SetDefaultValue(true);
   //
+  // Commands to decay daughter nuclei in place in analogue mode
+  //
+  chainModeCmd = new G4UIcmdWithABool ("/grdm/decayChain",this);
+  chainModeCmd->SetGuidance("True: daughters decaying within the chain time window");
+  chainModeCmd->SetGuidance("are decayed in place and are not tracked as ions");
+  chainModeCmd->SetParameterName("DecayChain",true);
+  chainModeCmd->SetDefaultValue(true);
+
+  chainWindowCmd = new G4UIcmdWithADoubleAndUnit ("/grdm/chainTimeWindow",this);
+  chainWindowCmd->SetGuidance("Time after the first decay within which daughters");
+  chainWindowCmd->SetGuidance("are decayed in place in the decay chain mode");
+  chainWindowCmd->SetParameterName("ChainTimeWindow",false);
+  chainWindowCmd->SetRange("ChainTimeWindow>=0.");
+  chainWindowCmd->SetUnitCategory("Time");
+  //
   // Command contols whether ICM will be applied or not
   //
   icmCmd = new G4UIcmdWithABool ("/grdm/applyICM",this);
@@ -224,6 +239,22 @@ G4RadioactiveDecaymessenger::G4RadioactiveDecaymessenger
   userEvaporationDataCmd->SetParameter(A_para);
   userEvaporationDataCmd->SetParameter(FileName_para);
 
+  //
+  // These commands compile the decay data files into one binary file
+  // and read it before the run
+  //
+  writeBinaryDataCmd = new G4UIcmdWithAString("/grdm/writeBinaryDatabase",this);
+  writeBinaryDataCmd->SetGuidance("Write decay data of isotopes within nucleusLimits");
+  writeBinaryDataCmd->SetGuidance("from G4RADIOACTIVEDATA into one binary file");
+  writeBinaryDataCmd->SetParameterName("FileName",false);
+  writeBinaryDataCmd->SetToBeBroadcasted(false);
+
+  loadBinaryDataCmd = new G4UIcmdWithAString("/grdm/loadBinaryDatabase",this);
+  loadBinaryDataCmd->SetGuidance("Read decay data from the binary file, data files");
+  loadBinaryDataCmd->SetGuidance("are used only for isotopes not in the binary file");
+  loadBinaryDataCmd->SetParameterName("FileName",false);
+  loadBinaryDataCmd->AvailableForStates(G4State_PreInit, G4State_Idle);
+
 
 }
 ////////////////////////////////////////////////////////////////////////////////
@@ -237,6 +268,8 @@ G4RadioactiveDecaymessenger::~G4RadioactiveDecaymessenger ()
   delete analoguemcCmd;
   delete fbetaCmd;
   delete brbiasCmd;
+  delete chainModeCmd;
+  delete chainWindowCmd;
   delete splitnucleiCmd;
   delete verboseCmd;
   delete avolumeCmd;
@@ -248,6 +281,8 @@ G4RadioactiveDecaymessenger::~G4RadioactiveDecaymessenger ()
   delete hlthCmd;
   delete userDecayDataCmd;
   delete userEvaporationDataCmd;
+  delete writeBinaryDataCmd;
+  delete loadBinaryDataCmd;
   delete colldirCmd;
   delete collangleCmd;
 
@@ -272,6 +307,10 @@ void G4RadioactiveDecaymessenger::SetNewValue (G4UIcommand *command, G4String ne
       DeselectAllVolumes();}
   else if  (command==brbiasCmd) {theRadioactiveDecayContainer->
       SetBRBias(brbiasCmd->GetNewBoolValue(newValues));}
+  else if  (command==chainModeCmd) {theRadioactiveDecayContainer->
+      SetDecayChainMode(chainModeCmd->GetNewBoolValue(newValues));}
+  else if  (command==chainWindowCmd) {theRadioactiveDecayContainer->
+      SetChainTimeWindow(chainWindowCmd->GetNewDoubleValue(newValues));}
   else if (command==sourcetimeprofileCmd) {theRadioactiveDecayContainer->
       SetSourceTimeProfile(newValues);}
   else if (command==decaybiasprofileCmd) {theRadioactiveDecayContainer->
@@ -303,6 +342,10 @@ void G4RadioactiveDecaymessenger::SetNewValue (G4UIcommand *command, G4String ne
 	  is >> Z>>A>>file_name;
 	  G4NuclearLevelStore::GetInstance()->AddUserEvaporationDataFile(Z,A,file_name);
   }
+  else if (command==writeBinaryDataCmd) {theRadioactiveDecayContainer->
+      WriteBinaryDatabase(newValues);}
+  else if (command==loadBinaryDataCmd) {theRadioactiveDecayContainer->
+      LoadBinaryDatabase(newValues);}
   else if (command==colldirCmd) {theRadioactiveDecayContainer->
       SetDecayDirection(colldirCmd->GetNew3VectorValue(newValues));}
   else if (command==collangleCmd) {theRadioactiveDecayContainer->
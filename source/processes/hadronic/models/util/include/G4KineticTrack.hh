@@ -50,7 +50,7 @@
 #include "G4VDecayChannel.hh"
 #include "G4Log.hh"
 
-// #include "G4Allocator.hh"
+#include "G4Allocator.hh"
 
 class G4KineticTrackVector;
 
@@ -77,10 +77,10 @@ class G4KineticTrack : public G4VKineticNucleon
       G4int operator==(const G4KineticTrack& right) const;
 
       G4int operator!=(const G4KineticTrack& right) const;
-/*
+      //  new/delete operators are overloded to use G4Allocator
       inline void *operator new(size_t);
       inline void operator delete(void *aTrack);
-*/
+
       const G4ParticleDefinition* GetDefinition() const;
       void SetDefinition(const G4ParticleDefinition* aDefinition);
 
@@ -189,23 +189,26 @@ public:
       G4double theProjectilePotential;
 };
 
-// extern G4Allocator<G4KineticTrack> theKTAllocator;
-
+#if defined G4HADRONIC_ALLOC_EXPORT
+  extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator;
+#else
+  extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator;
+#endif
 
 // Class G4KineticTrack 
-/*
+
 inline void * G4KineticTrack::operator new(size_t)
 {
-  void * aT;
-  aT = (void *) theKTAllocator.MallocSingle();
-  return aT;
+  if (!pKineticTrackAllocator) {
+    pKineticTrackAllocator = new G4Allocator<G4KineticTrack>;
+  }
+  return (void *) pKineticTrackAllocator->MallocSingle();
 }
 
 inline void G4KineticTrack::operator delete(void * aT)
 {
-  theKTAllocator.FreeSingle((G4KineticTrack *) aT);
+  pKineticTrackAllocator->FreeSingle((G4KineticTrack *) aT);
 }
-*/
 
 inline const G4ParticleDefinition* G4KineticTrack::GetDefinition() const
 {
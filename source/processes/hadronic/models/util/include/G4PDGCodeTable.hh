@@ -0,0 +1,76 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// ------------------------------------------------------------
+//      GEANT 4 class header file
+//
+//      ---------------- G4PDGCodeTable ----------------
+//       direct-indexed lookup of particle definitions by PDG code,
+//       used in inner loops of the parton string models
+// ------------------------------------------------------------
+//
+// Quarks, diquarks and hadrons built from them have |PDG code| below
+// 10000.  The definitions for these codes are kept in a per-thread
+// array, filled from G4ParticleTable the first time each code is
+// requested, so that later lookups avoid the map search (and the
+// worker-thread checks) in G4ParticleTable::FindParticle().  Other
+// codes are passed to G4ParticleTable directly.
+
+#ifndef G4PDGCodeTable_h
+#define G4PDGCodeTable_h 1
+
+#include "globals.hh"
+#include "G4ParticleTable.hh"
+#include <vector>
+
+class G4ParticleDefinition;
+
+class G4PDGCodeTable
+{
+  public:
+    static inline G4ParticleDefinition* FindParticle(G4int aPDGcode);
+
+  private:
+    G4PDGCodeTable();
+
+    static G4ParticleDefinition* Fill(G4int aPDGcode);
+
+    enum { maxCode = 10000 };
+
+    static G4ThreadLocal std::vector<G4ParticleDefinition*>* theTable;
+};
+
+inline G4ParticleDefinition* G4PDGCodeTable::FindParticle(G4int aPDGcode)
+{
+  if (aPDGcode > -maxCode && aPDGcode < maxCode && theTable) {
+    G4ParticleDefinition* ptr = (*theTable)[aPDGcode+maxCode];
+    if (ptr) { return ptr; }
+  }
+  return Fill(aPDGcode);
+}
+
+#endif
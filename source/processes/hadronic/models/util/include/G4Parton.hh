@@ -42,6 +42,7 @@
 #include "G4LorentzVector.hh"
 #include <iostream>
 #include "G4ParticleTable.hh"
+#include "G4Allocator.hh"
 #include "Randomize.hh"
 
 class G4Parton
@@ -65,6 +66,10 @@ class G4Parton
 
       G4Parton & operator=(const G4Parton &right);
 
+      //  new/delete operators are overloded to use G4Allocator
+      inline void *operator new(size_t);
+      inline void operator delete(void *aParton);
+
       int operator==(const G4Parton &right) const;
 
       int operator!=(const G4Parton &right) const;
@@ -111,6 +116,23 @@ class G4Parton
       
 };
 
+#if defined G4HADRONIC_ALLOC_EXPORT
+  extern G4DLLEXPORT G4ThreadLocal G4Allocator<G4Parton> *pPartonAllocator;
+#else
+  extern G4DLLIMPORT G4ThreadLocal G4Allocator<G4Parton> *pPartonAllocator;
+#endif
+
+inline void * G4Parton::operator new(size_t)
+{
+	if (!pPartonAllocator) { pPartonAllocator = new G4Allocator<G4Parton>; }
+	return (void *) pPartonAllocator->MallocSingle();
+}
+
+inline void G4Parton::operator delete(void * aParton)
+{
+	pPartonAllocator->FreeSingle((G4Parton *) aParton);
+}
+
 inline int G4Parton::operator==(const G4Parton &right) const
 {
 	return this==&right;
@@ -68,6 +68,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_mod_util
         G4Nucleon.hh
         G4Parton.hh
         G4PartonVector.hh
+        G4PDGCodeTable.hh
         G4PolynomialPDF.hh
         G4SampleResonance.hh
 	G4VHadDecayAlgorithm.hh
@@ -93,6 +94,7 @@ GEANT4_DEFINE_MODULE(NAME G4had_mod_util
         G4NuclearShellModelDensity.cc
         G4Nucleon.cc
         G4Parton.cc
+        G4PDGCodeTable.cc
         G4PolynomialPDF.cc
         G4SampleResonance.cc
 	G4VHadDecayAlgorithm.cc
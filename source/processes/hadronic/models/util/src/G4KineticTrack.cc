@@ -60,6 +60,8 @@
 
 static G4ThreadLocal G4double  G4KineticTrack_Gmass, G4KineticTrack_xmass1;
 
+G4ThreadLocal G4Allocator<G4KineticTrack> *pKineticTrackAllocator = 0;
+
 //
 //   Default constructor
 //
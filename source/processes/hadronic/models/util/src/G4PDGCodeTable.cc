@@ -0,0 +1,53 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+// $Id$
+//
+// ------------------------------------------------------------
+//      GEANT 4 class implementation file
+//
+//      ---------------- G4PDGCodeTable ----------------
+//       direct-indexed lookup of particle definitions by PDG code
+// ------------------------------------------------------------
+
+#include "G4PDGCodeTable.hh"
+#include "G4AutoDelete.hh"
+
+G4ThreadLocal std::vector<G4ParticleDefinition*>* G4PDGCodeTable::theTable = 0;
+
+G4ParticleDefinition* G4PDGCodeTable::Fill(G4int aPDGcode)
+{
+  G4ParticleDefinition* ptr =
+    G4ParticleTable::GetParticleTable()->FindParticle(aPDGcode);
+  if (ptr && aPDGcode > -maxCode && aPDGcode < maxCode) {
+    if (!theTable) {
+      theTable = new std::vector<G4ParticleDefinition*>(2*maxCode+1,
+                   (G4ParticleDefinition*)0);
+      G4AutoDelete::Register(theTable);
+    }
+    (*theTable)[aPDGcode+maxCode] = ptr;
+  }
+  return ptr;
+}
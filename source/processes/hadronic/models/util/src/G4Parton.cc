@@ -34,13 +34,16 @@
 // ------------------------------------------------------------
 
 #include "G4Parton.hh"
+#include "G4PDGCodeTable.hh"
 #include "G4HadronicException.hh"
 
+G4ThreadLocal G4Allocator<G4Parton> *pPartonAllocator = 0;
+
 G4Parton::G4Parton(G4int PDGcode)
 {
 	PDGencoding=PDGcode;
 	theX = 0;
-	theDefinition=G4ParticleTable::GetParticleTable()->FindParticle(PDGencoding);
+	theDefinition=G4PDGCodeTable::FindParticle(PDGencoding);
 	if (theDefinition == NULL)
 	{
 	  G4cout << "Encoding = "<<PDGencoding<<G4endl;
@@ -59,7 +59,9 @@
 #include "G4Track.hh"
 #include "G4Step.hh"
 #include "G4ParticleChangeForTransport.hh"
+#include <chrono>
 class G4SafetyHelper; 
+class G4LooperPolicy;
 
 class G4CoupledTransportation : public G4VProcess 
 {
@@ -124,6 +126,10 @@ class G4CoupledTransportation : public G4VProcess
      inline void ResetKilledStatistics( G4int report = 1);      
      // Statistics for tracks killed (currently due to looping in field)
 
+     // Per-particle thresholds, budgets per track, the action taken on
+     //   abandoned loopers and the per-region accounting are configured
+     //   in the shared G4LooperPolicy (UI commands in /process/looper/)
+
      static G4bool EnableUseMagneticMoment(G4bool useMoment=true); 
      // Whether to deflect particles with force due to magnetic moment
 
@@ -219,6 +225,13 @@ class G4CoupledTransportation : public G4VProcess
      G4double fSumEnergyKilled;
      G4double fMaxEnergyKilled;
 
+  // Shared policy for abandoning loopers and state of the current track
+     G4LooperPolicy* fLooperPolicy;
+     G4int    fNoLoopingSteps;      // Looping steps of this track (total)
+     G4double fLoopingStartTime;    // Global time of first looping step
+     std::chrono::steady_clock::time_point fLooperClock;
+                         // Start of track on this thread, if accounting
+
      G4SafetyHelper* fpSafetyHelper;  // To pass it the safety value obtained
 
   // Verbosity 
@@ -0,0 +1,226 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+// $Id$
+//
+// ----------------------------------------------------------------------
+// Class G4LooperPolicy
+//
+// Class description:
+//
+// Shared (process-wide) configuration of how G4Transportation and
+// G4CoupledTransportation treat tracks which are looping in a field,
+// together with run-level accounting of what those tracks cost.
+//
+// A looping track is abandoned when
+//   - its energy is below the 'important' energy, which can be set
+//     per particle type (default: the threshold of the transportation), or
+//   - it has been looping for more than the allowed number of consecutive
+//     trials (threshold of the transportation), or
+//   - the budget of looping steps or of looping (lab) time allowed per
+//     track is exhausted (both unlimited by default).
+// An abandoned track is then, according to the action,
+//   fLooperKill     - killed, its energy is lost (default, old behaviour),
+//   fLooperDeposit  - killed, its kinetic energy is deposited locally,
+//   fLooperHandOff  - given to a user G4VLooperHandler, e.g. a fast
+//                     simulation; killed if there is none or it declines.
+//
+// If accounting is enabled, the number of abandoned loopers, their energy
+// and the time spent on them are summed per region on all threads. The time
+// of a track is measured with a steady clock by the transportation of the
+// thread which tracks it, from the start of the track until it is abandoned.
+// The configuration is set on the master in PreInit or Idle state
+// (UI commands in /process/looper/) and is read-only during the run.
+
+// Created: October 2026
+// ----------------------------------------------------------------------
+#ifndef G4LooperPolicy_hh
+#define G4LooperPolicy_hh 1
+
+#include "globals.hh"
+#include <map>
+#include <iostream>
+
+class G4Track;
+class G4Region;
+class G4ParticleDefinition;
+class G4ParticleChangeForTransport;
+class G4VLooperHandler;
+class G4LooperPolicyMessenger;
+
+enum G4LooperAction
+{
+  fLooperKill = 0,
+  fLooperDeposit,
+  fLooperHandOff
+};
+
+class G4LooperPolicy
+{
+  public:  // with description
+
+    static G4LooperPolicy* Instance();
+
+    ~G4LooperPolicy();
+
+    inline void SetAction(G4LooperAction val);
+    inline G4LooperAction GetAction() const;
+
+    void SetImportantEnergy(const G4ParticleDefinition*, G4double val);
+    inline G4double GetImportantEnergy(const G4ParticleDefinition*,
+                                       G4double defaultValue) const;
+      // Per particle energy below which a looper is abandoned at once
+
+    inline void SetMaxLoopingSteps(G4int val);
+    inline G4int GetMaxLoopingSteps() const;
+    inline void SetMaxLoopingTime(G4double val);
+    inline G4double GetMaxLoopingTime() const;
+      // Budget per track; zero or negative value means unlimited
+
+    inline G4bool IsBudgetExhausted(G4int loopingSteps,
+                                    G4double loopingTime) const;
+
+    inline void SetHandler(G4VLooperHandler* ptr);
+    inline G4VLooperHandler* GetHandler() const;
+      // Handler for fLooperHandOff, not owned
+
+    inline void SetAccounting(G4bool val);
+    inline G4bool IsAccountingActive() const;
+
+    G4LooperAction Abandon(const G4Track& track, G4double kineticEnergy,
+                           G4double trackTime,
+                           G4ParticleChangeForTransport* change);
+      // Apply the action to the track via the particle change and
+      // record it. Returns the action actually taken.
+
+    void ResetStatistics();
+    void DumpStatistics(std::ostream& out = G4cout) const;
+
+  private:
+
+    G4LooperPolicy();
+
+    G4LooperPolicy(const G4LooperPolicy&);
+    G4LooperPolicy& operator=(const G4LooperPolicy&);
+
+    struct G4LooperRegionStat
+    {
+      G4LooperRegionStat() : fNumber(0), fNumberHandedOff(0),
+        fEnergyKilled(0.), fEnergyDeposited(0.), fEnergyHandedOff(0.),
+        fMaxEnergy(0.), fTrackTime(0.) {}
+      G4int    fNumber;
+      G4int    fNumberHandedOff;
+      G4double fEnergyKilled;
+      G4double fEnergyDeposited;
+      G4double fEnergyHandedOff;
+      G4double fMaxEnergy;
+      G4double fTrackTime;
+    };
+
+    static G4LooperPolicy* fInstance;
+
+    G4LooperPolicyMessenger* fMessenger;
+    G4VLooperHandler*        fHandler;
+
+    G4LooperAction fAction;
+    G4int          fMaxLoopingSteps;
+    G4double       fMaxLoopingTime;
+    G4bool         fAccounting;
+
+    std::map<const G4ParticleDefinition*,G4double> fImportantEnergy;
+    std::map<const G4Region*,G4LooperRegionStat>  fStatistics;
+      // Shared by all threads, protected by a mutex
+};
+
+inline void G4LooperPolicy::SetAction(G4LooperAction val)
+{
+  fAction = val;
+}
+
+inline G4LooperAction G4LooperPolicy::GetAction() const
+{
+  return fAction;
+}
+
+inline G4double
+G4LooperPolicy::GetImportantEnergy(const G4ParticleDefinition* part,
+                                   G4double defaultValue) const
+{
+  if(fImportantEnergy.empty()) { return defaultValue; }
+  std::map<const G4ParticleDefinition*,G4double>::const_iterator pos
+    = fImportantEnergy.find(part);
+  return (pos == fImportantEnergy.end()) ? defaultValue : pos->second;
+}
+
+inline void G4LooperPolicy::SetMaxLoopingSteps(G4int val)
+{
+  fMaxLoopingSteps = val;
+}
+
+inline G4int G4LooperPolicy::GetMaxLoopingSteps() const
+{
+  return fMaxLoopingSteps;
+}
+
+inline void G4LooperPolicy::SetMaxLoopingTime(G4double val)
+{
+  fMaxLoopingTime = val;
+}
+
+inline G4double G4LooperPolicy::GetMaxLoopingTime() const
+{
+  return fMaxLoopingTime;
+}
+
+inline G4bool G4LooperPolicy::IsBudgetExhausted(G4int loopingSteps,
+                                                G4double loopingTime) const
+{
+  return ((fMaxLoopingSteps > 0 && loopingSteps >= fMaxLoopingSteps) ||
+          (fMaxLoopingTime > 0.0 && loopingTime >= fMaxLoopingTime));
+}
+
+inline void G4LooperPolicy::SetHandler(G4VLooperHandler* ptr)
+{
+  fHandler = ptr;
+}
+
+inline G4VLooperHandler* G4LooperPolicy::GetHandler() const
+{
+  return fHandler;
+}
+
+inline void G4LooperPolicy::SetAccounting(G4bool val)
+{
+  fAccounting = val;
+}
+
+inline G4bool G4LooperPolicy::IsAccountingActive() const
+{
+  return fAccounting;
+}
+
+#endif
@@ -0,0 +1,82 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+// $Id$
+//
+// ----------------------------------------------------------------------
+// Class G4LooperPolicyMessenger
+//
+// Class description:
+//
+// Messenger for the commands of G4LooperPolicy in /process/looper/.
+// The policy is shared by all threads, so commands are not broadcast
+// to the workers.
+
+// Created: October 2026
+// ----------------------------------------------------------------------
+#ifndef G4LooperPolicyMessenger_hh
+#define G4LooperPolicyMessenger_hh 1
+
+#include "globals.hh"
+#include "G4UImessenger.hh"
+
+class G4LooperPolicy;
+class G4UIdirectory;
+class G4UIcommand;
+class G4UIcmdWithABool;
+class G4UIcmdWithAnInteger;
+class G4UIcmdWithADoubleAndUnit;
+class G4UIcmdWithAString;
+class G4UIcmdWithoutParameter;
+
+class G4LooperPolicyMessenger : public G4UImessenger
+{
+  public:
+
+    G4LooperPolicyMessenger(G4LooperPolicy*);
+    virtual ~G4LooperPolicyMessenger();
+
+    void SetNewValue(G4UIcommand*, G4String);
+
+  private:
+
+    G4LooperPolicyMessenger(const G4LooperPolicyMessenger&);
+    G4LooperPolicyMessenger& operator=(const G4LooperPolicyMessenger&);
+
+    G4LooperPolicy* thePolicy;
+
+    G4UIdirectory*             dir;
+    G4UIcmdWithAString*        actCmd;
+    G4UIcommand*               enCmd;
+    G4UIcmdWithAnInteger*      stepCmd;
+    G4UIcmdWithADoubleAndUnit* timeCmd;
+    G4UIcmdWithABool*          accCmd;
+    G4UIcmdWithoutParameter*   printCmd;
+    G4UIcmdWithoutParameter*   resetCmd;
+};
+
+#endif
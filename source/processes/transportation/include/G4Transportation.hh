@@ -53,7 +53,9 @@
 #include "G4Track.hh"
 #include "G4Step.hh"
 #include "G4ParticleChangeForTransport.hh"
+#include <chrono>
 class G4SafetyHelper; 
+class G4LooperPolicy;
 class G4CoupledTransportation;
 
 class G4Transportation : public G4VProcess 
@@ -121,6 +123,10 @@ class G4Transportation : public G4VProcess
      inline void ResetKilledStatistics( G4int report = 1);      
      // Statistics for tracks killed (currently due to looping in field)
 
+     // Per-particle thresholds, budgets per track, the action taken on
+     //   abandoned loopers and the per-region accounting are configured
+     //   in the shared G4LooperPolicy (UI commands in /process/looper/)
+
      inline void EnableShortStepOptimisation(G4bool optimise=true); 
      // Whether short steps < safety will avoid to call Navigator (if field=0)
 
@@ -202,6 +208,13 @@ class G4Transportation : public G4VProcess
      G4double fSumEnergyKilled;
      G4double fMaxEnergyKilled;
 
+  // Shared policy for abandoning loopers and state of the current track
+     G4LooperPolicy* fLooperPolicy;
+     G4int    fNoLoopingSteps;      // Looping steps of this track (total)
+     G4double fLoopingStartTime;    // Global time of first looping step
+     std::chrono::steady_clock::time_point fLooperClock;
+                         // Start of track on this thread, if accounting
+
   // Whether to avoid calling G4Navigator for short step ( < safety)
   //   If using it, the safety estimate for endpoint will likely be smaller.
      G4bool   fShortStepOptimisation; 
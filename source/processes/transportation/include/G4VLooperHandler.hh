@@ -0,0 +1,70 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+// $Id$
+//
+// ----------------------------------------------------------------------
+// Class G4VLooperHandler
+//
+// Class description:
+//
+// Interface for a user object to which G4Transportation and
+// G4CoupledTransportation hand a track that is looping in a field,
+// once the looper policy (see G4LooperPolicy) has decided to abandon it
+// and its action is fLooperHandOff.
+// A typical implementation passes the remaining energy to a fast
+// simulation (parameterised shower or hit generation) and proposes the
+// final state of the track in the particle change.
+// If HandleLooper() returns false the track is killed as usual.
+
+// Created: October 2026
+// ----------------------------------------------------------------------
+#ifndef G4VLooperHandler_hh
+#define G4VLooperHandler_hh 1
+
+#include "globals.hh"
+
+class G4Track;
+class G4ParticleChangeForTransport;
+
+class G4VLooperHandler
+{
+  public:  // with description
+
+    G4VLooperHandler() {}
+    virtual ~G4VLooperHandler() {}
+
+    virtual G4bool HandleLooper(const G4Track& track,
+                                G4double kineticEnergy,
+                                G4ParticleChangeForTransport* change) = 0;
+      // Called on the worker thread transporting the track.
+      // The implementation must set the track status in 'change'
+      // (e.g. fStopAndKill after depositing or parameterising the
+      // energy) and return true if it took responsibility for the track.
+};
+
+#endif
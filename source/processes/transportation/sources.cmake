@@ -43,6 +43,8 @@ GEANT4_DEFINE_MODULE(NAME G4transportation
     HEADERS
         G4CoupledTransportation.hh
         G4CoupledTransportation.icc
+        G4LooperPolicy.hh
+        G4LooperPolicyMessenger.hh
         G4NeutronKiller.hh
         G4NeutronKillerMessenger.hh
         G4StepLimiter.hh
@@ -50,10 +52,13 @@ GEANT4_DEFINE_MODULE(NAME G4transportation
         G4Transportation.hh
         G4Transportation.icc
         G4UserSpecialCuts.hh
+        G4VLooperHandler.hh
         G4VTrackTerminator.hh
 	G4TransportationProcessType.hh
     SOURCES
         G4CoupledTransportation.cc
+        G4LooperPolicy.cc
+        G4LooperPolicyMessenger.cc
         G4NeutronKiller.cc
         G4NeutronKillerMessenger.cc
         G4StepLimiter.cc
@@ -30,6 +30,7 @@
 //  GEANT 4 class implementation
 // =======================================================================
 // Modified:
+//   19 Oct  2026: Looper policy - per particle threshold, budgets, actions
 //   10 Jan  2015, M.Kelsey: Use G4DynamicParticle mass, NOT PDGMass
 //            13 May  2006, J. Apostolakis: Revised for parallel navigation (PathFinder)
 //            19 Jan  2006, P.MoraDeFreitas: Fix for suspended tracks (StartTracking)
@@ -56,6 +57,7 @@
 #include "G4Field.hh"
 #include "G4FieldTrack.hh"
 #include "G4FieldManagerStore.hh"
+#include "G4LooperPolicy.hh"
 
 class G4VSensitiveDetector;
 
@@ -85,6 +87,9 @@ G4CoupledTransportation::G4CoupledTransportation( G4int verbosity )
     fThresholdTrials( 10 ), 
     fNoLooperTrials( 0 ),
     fSumEnergyKilled( 0.0 ), fMaxEnergyKilled( 0.0 ), 
+    fLooperPolicy( 0 ),
+    fNoLoopingSteps( 0 ),
+    fLoopingStartTime( -1.0 ),
     fVerboseLevel( verbosity )
 {
   // set Process Sub Type
@@ -107,6 +112,7 @@ G4CoupledTransportation::G4CoupledTransportation( G4int verbosity )
   }
   fPathFinder=  G4PathFinder::GetInstance(); 
   fpSafetyHelper = transportMgr->GetSafetyHelper();  // New 
+  fLooperPolicy = G4LooperPolicy::Instance();
 
   // Following assignment is to fix small memory leak from simple use of 'new'
   static G4ThreadLocal G4TouchableHandle* pNullTouchableHandle = 0;
@@ -644,12 +650,28 @@ G4CoupledTransportation::AlongStepDoIt( const G4Track& track,
   {
      G4double endEnergy= fTransportEndKineticEnergy;
 
-     if( (endEnergy < fThreshold_Important_Energy) 
-          || (fNoLooperTrials >= fThresholdTrials ) )
+     ++fNoLoopingSteps;
+     if( fLoopingStartTime < 0.0 ) { fLoopingStartTime= startTime; }
+
+     G4double importantEnergy= fLooperPolicy->
+       GetImportantEnergy( track.GetParticleDefinition(),
+                           fThreshold_Important_Energy );
+
+     if( (endEnergy < importantEnergy) 
+          || (fNoLooperTrials >= fThresholdTrials )
+          || fLooperPolicy->IsBudgetExhausted( fNoLoopingSteps,
+                               fCandidateEndGlobalTime - fLoopingStartTime ) )
      {
-        // Kill the looping particle 
+        // Abandon the looping particle: kill it, deposit its energy
+        //   or hand it off, as the looper policy requires
         //
-        fParticleChange.ProposeTrackStatus( fStopAndKill )  ;
+        G4double trackTime= 0.0;
+        if( fLooperPolicy->IsAccountingActive() )
+        {
+          trackTime= std::chrono::duration<G4double>(
+                     std::chrono::steady_clock::now() - fLooperClock ).count();
+        }
+        fLooperPolicy->Abandon( track, endEnergy, trackTime, &fParticleChange );
 
         // 'Bare' statistics
         fSumEnergyKilled += endEnergy; 
@@ -923,6 +945,10 @@ G4CoupledTransportation::StartTracking(G4Track* aTrack)
   
   // reset looping counter -- for motion in field  
   fNoLooperTrials= 0; 
+  fNoLoopingSteps= 0;
+  fLoopingStartTime= -1.0;
+  if( fLooperPolicy->IsAccountingActive() )
+  { fLooperClock= std::chrono::steady_clock::now(); }
   // Must clear this state .. else it depends on last track's value
   //  --> a better solution would set this from state of suspended track TODO ? 
   // Was if( aTrack->GetCurrentStepNumber()==1 ) { .. }
@@ -0,0 +1,219 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+// $Id$
+//
+// ----------------------------------------------------------------------
+// Class G4LooperPolicy
+//
+// Created: October 2026
+// ----------------------------------------------------------------------
+
+#include "G4LooperPolicy.hh"
+#include "G4LooperPolicyMessenger.hh"
+#include "G4VLooperHandler.hh"
+
+#include "G4Track.hh"
+#include "G4ParticleChangeForTransport.hh"
+#include "G4ParticleDefinition.hh"
+#include "G4VPhysicalVolume.hh"
+#include "G4LogicalVolume.hh"
+#include "G4Region.hh"
+#include "G4RegionStore.hh"
+#include "G4SystemOfUnits.hh"
+#include "G4AutoLock.hh"
+
+#include <iomanip>
+
+namespace { G4Mutex looperPolicyMutex = G4MUTEX_INITIALIZER; }
+
+G4LooperPolicy* G4LooperPolicy::fInstance = 0;
+
+//////////////////////////////////////////////////////////////////////////
+
+G4LooperPolicy* G4LooperPolicy::Instance()
+{
+  if(0 == fInstance) {
+    static G4LooperPolicy policy;
+    fInstance = &policy;
+  }
+  return fInstance;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+G4LooperPolicy::G4LooperPolicy()
+  : fHandler(0), fAction(fLooperKill), fMaxLoopingSteps(0),
+    fMaxLoopingTime(0.0), fAccounting(false)
+{
+  fMessenger = new G4LooperPolicyMessenger(this);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+G4LooperPolicy::~G4LooperPolicy()
+{
+  delete fMessenger;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void G4LooperPolicy::SetImportantEnergy(const G4ParticleDefinition* part,
+                                        G4double val)
+{
+  if(0 == part) { return; }
+  if(val < 0.0) { fImportantEnergy.erase(part); }
+  else          { fImportantEnergy[part] = val; }
+}
+
+//////////////////////////////////////////////////////////////////////////
+//
+// Called only when a looping track is abandoned, so the lock taken for
+// accounting is not on the path of normal steps.
+
+G4LooperAction G4LooperPolicy::Abandon(const G4Track& track,
+                                       G4double kineticEnergy,
+                                       G4double trackTime,
+                                       G4ParticleChangeForTransport* change)
+{
+  G4LooperAction action = fAction;
+  if(fLooperHandOff == action)
+  {
+    if(0 == fHandler || !fHandler->HandleLooper(track, kineticEnergy, change))
+    {
+      action = fLooperKill;
+    }
+  }
+  if(fLooperHandOff != action)
+  {
+    change->ProposeTrackStatus( fStopAndKill );
+  }
+  if(fLooperDeposit == action)
+  {
+    change->SetMomentumChanged(true);
+    change->ProposeEnergy(0.0);
+    change->ProposeLocalEnergyDeposit(kineticEnergy);
+  }
+
+  if(fAccounting)
+  {
+    const G4Region* region = 0;
+    const G4VPhysicalVolume* pv = track.GetVolume();
+    if(pv) { region = pv->GetLogicalVolume()->GetRegion(); }
+
+    G4AutoLock l(&looperPolicyMutex);
+    G4LooperRegionStat& stat = fStatistics[region];
+    ++stat.fNumber;
+    if(fLooperKill == action)         { stat.fEnergyKilled += kineticEnergy; }
+    else if(fLooperDeposit == action) { stat.fEnergyDeposited += kineticEnergy; }
+    else
+    {
+      ++stat.fNumberHandedOff;
+      stat.fEnergyHandedOff += kineticEnergy;
+    }
+    if(kineticEnergy > stat.fMaxEnergy) { stat.fMaxEnergy = kineticEnergy; }
+    stat.fTrackTime += trackTime;
+  }
+  return action;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void G4LooperPolicy::ResetStatistics()
+{
+  G4AutoLock l(&looperPolicyMutex);
+  fStatistics.clear();
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void G4LooperPolicy::DumpStatistics(std::ostream& out) const
+{
+  G4AutoLock l(&looperPolicyMutex);
+
+  static const char* actionName[3] = { "kill", "deposit", "handOff" };
+  out << "======= G4LooperPolicy: tracks looping in field ========" << G4endl;
+  out << " Action: " << actionName[fAction];
+  if(fMaxLoopingSteps > 0) 
+  { out << "; max looping steps per track: " << fMaxLoopingSteps; }
+  if(fMaxLoopingTime > 0.0) 
+  { out << "; max looping time per track: " << fMaxLoopingTime/ns << " ns"; }
+  out << G4endl;
+  std::map<const G4ParticleDefinition*,G4double>::const_iterator ie;
+  for(ie = fImportantEnergy.begin(); ie != fImportantEnergy.end(); ++ie)
+  {
+    out << " Important energy for " << ie->first->GetParticleName()
+        << ": " << ie->second/MeV << " MeV" << G4endl;
+  }
+  if(!fAccounting) 
+  {
+    out << " Accounting is not enabled (/process/looper/accounting)" << G4endl;
+    return;
+  }
+
+  // Print in the order of the region store, so that output is reproducible
+  G4RegionStore* regions = G4RegionStore::GetInstance();
+  std::size_t nreg = regions->size();
+  G4LooperRegionStat total;
+  G4int prec = out.precision(5);
+  out << std::setw(24) << "Region" << std::setw(10) << "Loopers"
+      << std::setw(14) << "Killed(MeV)" << std::setw(14) << "Deposit(MeV)"
+      << std::setw(14) << "HandOff(MeV)" << std::setw(12) << "Max(MeV)"
+      << std::setw(12) << "Time(s)" << G4endl;
+  for(std::size_t i=0; i<=nreg; ++i)
+  {
+    const G4Region* reg = (i < nreg) ? (*regions)[i] : 0;
+    std::map<const G4Region*,G4LooperRegionStat>::const_iterator pos
+      = fStatistics.find(reg);
+    if(pos == fStatistics.end()) { continue; }
+    const G4LooperRegionStat& stat = pos->second;
+    out << std::setw(24) << (reg ? reg->GetName() : G4String("unknown"))
+        << std::setw(10) << stat.fNumber
+        << std::setw(14) << stat.fEnergyKilled/MeV
+        << std::setw(14) << stat.fEnergyDeposited/MeV
+        << std::setw(14) << stat.fEnergyHandedOff/MeV
+        << std::setw(12) << stat.fMaxEnergy/MeV
+        << std::setw(12) << stat.fTrackTime << G4endl;
+    total.fNumber += stat.fNumber;
+    total.fEnergyKilled += stat.fEnergyKilled;
+    total.fEnergyDeposited += stat.fEnergyDeposited;
+    total.fEnergyHandedOff += stat.fEnergyHandedOff;
+    total.fMaxEnergy = std::max(total.fMaxEnergy, stat.fMaxEnergy);
+    total.fTrackTime += stat.fTrackTime;
+  }
+  out << std::setw(24) << "Total"
+      << std::setw(10) << total.fNumber
+      << std::setw(14) << total.fEnergyKilled/MeV
+      << std::setw(14) << total.fEnergyDeposited/MeV
+      << std::setw(14) << total.fEnergyHandedOff/MeV
+      << std::setw(12) << total.fMaxEnergy/MeV
+      << std::setw(12) << total.fTrackTime << G4endl;
+  out << " Time is the time spent by the tracking thread on the abandoned"
+      << " tracks since their start" << G4endl;
+  out << "========================================================" << G4endl;
+  out.precision(prec);
+}
@@ -0,0 +1,162 @@
+//
+// ********************************************************************
+// * License and Disclaimer                                           *
+// *                                                                  *
+// * The  Geant4 software  is  copyright of the Copyright Holders  of *
+// * the Geant4 Collaboration.  It is provided  under  the terms  and *
+// * conditions of the Geant4 Software License,  included in the file *
+// * LICENSE and available at  http://cern.ch/geant4/license .  These *
+// * include a list of copyright holders.                             *
+// *                                                                  *
+// * Neither the authors of this software system, nor their employing *
+// * institutes,nor the agencies providing financial support for this *
+// * work  make  any representation or  warranty, express or implied, *
+// * regarding  this  software system or assume any liability for its *
+// * use.  Please see the license in the file  LICENSE  and URL above *
+// * for the full disclaimer and the limitation of liability.         *
+// *                                                                  *
+// * This  code  implementation is the result of  the  scientific and *
+// * technical work of the GEANT4 collaboration.                      *
+// * By using,  copying,  modifying or  distributing the software (or *
+// * any work based  on the software)  you  agree  to acknowledge its *
+// * use  in  resulting  scientific  publications,  and indicate your *
+// * acceptance of all terms of the Geant4 Software license.          *
+// ********************************************************************
+//
+//
+//
+// $Id$
+//
+// ----------------------------------------------------------------------
+// Class G4LooperPolicyMessenger
+//
+// Created: October 2026
+// ----------------------------------------------------------------------
+
+#include "G4LooperPolicyMessenger.hh"
+#include "G4LooperPolicy.hh"
+
+#include "G4UIdirectory.hh"
+#include "G4UIcommand.hh"
+#include "G4UIparameter.hh"
+#include "G4UIcmdWithABool.hh"
+#include "G4UIcmdWithAnInteger.hh"
+#include "G4UIcmdWithADoubleAndUnit.hh"
+#include "G4UIcmdWithAString.hh"
+#include "G4UIcmdWithoutParameter.hh"
+#include "G4ParticleTable.hh"
+
+#include <sstream>
+
+//////////////////////////////////////////////////////////////////////////
+
+G4LooperPolicyMessenger::G4LooperPolicyMessenger(G4LooperPolicy* ptr)
+  : thePolicy(ptr)
+{
+  dir = new G4UIdirectory("/process/looper/", false);
+  dir->SetGuidance("Treatment of particles looping in a field.");
+
+  actCmd = new G4UIcmdWithAString("/process/looper/action",this);
+  actCmd->SetGuidance("Action for an abandoned looping track:");
+  actCmd->SetGuidance("  kill    : kill it, its energy is lost (default)");
+  actCmd->SetGuidance("  deposit : kill it and deposit its energy locally");
+  actCmd->SetGuidance("  handOff : give it to the user G4VLooperHandler");
+  actCmd->SetParameterName("action",false);
+  actCmd->SetCandidates("kill deposit handOff");
+  actCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  enCmd = new G4UIcommand("/process/looper/importantEnergy",this);
+  enCmd->SetGuidance("Set for a particle the energy below which a looping");
+  enCmd->SetGuidance("track is abandoned without further trials.");
+  enCmd->SetGuidance("A negative value restores the default of the process.");
+  G4UIparameter* part = new G4UIparameter("particle",'s',false);
+  enCmd->SetParameter(part);
+  G4UIparameter* en = new G4UIparameter("energy",'d',false);
+  enCmd->SetParameter(en);
+  G4UIparameter* unit = new G4UIparameter("unit",'s',true);
+  unit->SetDefaultValue("MeV");
+  enCmd->SetParameter(unit);
+  enCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  stepCmd = new G4UIcmdWithAnInteger("/process/looper/maxSteps",this);
+  stepCmd->SetGuidance("Set the number of looping steps allowed per track.");
+  stepCmd->SetGuidance("Zero means no limit (default).");
+  stepCmd->SetParameterName("nsteps",false);
+  stepCmd->SetRange("nsteps>=0");
+  stepCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  timeCmd = new G4UIcmdWithADoubleAndUnit("/process/looper/maxTime",this);
+  timeCmd->SetGuidance("Set the (lab) time a track may spend looping.");
+  timeCmd->SetGuidance("Zero means no limit (default).");
+  timeCmd->SetParameterName("time",false);
+  timeCmd->SetUnitCategory("Time");
+  timeCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  accCmd = new G4UIcmdWithABool("/process/looper/accounting",this);
+  accCmd->SetGuidance("Enable/disable per region accounting of the energy");
+  accCmd->SetGuidance("and time spent on abandoned looping tracks.");
+  accCmd->SetParameterName("flag",true);
+  accCmd->SetDefaultValue(true);
+  accCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  printCmd = new G4UIcmdWithoutParameter("/process/looper/printStatistics",this);
+  printCmd->SetGuidance("Print the looper policy and the per region accounting.");
+  printCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+
+  resetCmd = new G4UIcmdWithoutParameter("/process/looper/resetStatistics",this);
+  resetCmd->SetGuidance("Reset the per region accounting of loopers.");
+  resetCmd->AvailableForStates(G4State_PreInit,G4State_Idle);
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+G4LooperPolicyMessenger::~G4LooperPolicyMessenger()
+{
+  delete actCmd;
+  delete enCmd;
+  delete stepCmd;
+  delete timeCmd;
+  delete accCmd;
+  delete printCmd;
+  delete resetCmd;
+  delete dir;
+}
+
+//////////////////////////////////////////////////////////////////////////
+
+void G4LooperPolicyMessenger::SetNewValue(G4UIcommand* command, 
+                                          G4String newValue)
+{
+  if (command == actCmd) {
+    G4LooperAction act = fLooperKill;
+    if(newValue == "deposit")      { act = fLooperDeposit; }
+    else if(newValue == "handOff") { act = fLooperHandOff; }
+    thePolicy->SetAction(act);
+  } else if (command == enCmd) {
+    G4String name(""), unt("MeV");
+    G4double val = 0.0;
+    std::istringstream is(newValue);
+    is >> name >> val >> unt;
+    const G4ParticleDefinition* part = 
+      G4ParticleTable::GetParticleTable()->FindParticle(name);
+    if(!part) {
+      G4ExceptionDescription ed;
+      ed << "Unknown particle <" << name << ">, command ignored";
+      G4Exception("G4LooperPolicyMessenger::SetNewValue","Transport0101",
+                  JustWarning, ed);
+      return;
+    }
+    thePolicy->SetImportantEnergy(part, 
+                                  val*G4UIcommand::ValueOf(unt.c_str()));
+  } else if (command == stepCmd) {
+    thePolicy->SetMaxLoopingSteps(stepCmd->GetNewIntValue(newValue));
+  } else if (command == timeCmd) {
+    thePolicy->SetMaxLoopingTime(timeCmd->GetNewDoubleValue(newValue));
+  } else if (command == accCmd) {
+    thePolicy->SetAccounting(accCmd->GetNewBoolValue(newValue));
+  } else if (command == printCmd) {
+    thePolicy->DumpStatistics();
+  } else if (command == resetCmd) {
+    thePolicy->ResetStatistics();
+  }
+}
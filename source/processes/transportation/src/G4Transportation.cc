@@ -40,6 +40,7 @@
 //
 // =======================================================================
 // Modified:
+//   19 Oct  2026: Looper policy - per particle threshold, budgets, actions
 //   10 Jan  2015, M.Kelsey: Use G4DynamicParticle mass, NOT PDGMass
 //   28 Oct  2011, P.Gumpl./J.Ap: Detect gravity field, use magnetic moment 
 //   20 Nov  2008, J.Apostolakis: Push safety to helper - after ComputeSafety
@@ -69,6 +70,7 @@
 #include "G4EquationOfMotion.hh"
 
 #include "G4FieldManagerStore.hh"
+#include "G4LooperPolicy.hh"
 
 class G4VSensitiveDetector;
 
@@ -104,6 +106,9 @@ G4Transportation::G4Transportation( G4int verbosity )
     fThresholdTrials( 10 ), 
     fNoLooperTrials( 0 ),
     fSumEnergyKilled( 0.0 ), fMaxEnergyKilled( 0.0 ), 
+    fLooperPolicy( 0 ),
+    fNoLoopingSteps( 0 ),
+    fLoopingStartTime( -1.0 ),
     fShortStepOptimisation( false ), // Old default: true (=fast short steps)
     fVerboseLevel( verbosity )
 {
@@ -121,6 +126,8 @@ G4Transportation::G4Transportation( G4int verbosity )
 
   fpSafetyHelper =   transportMgr->GetSafetyHelper();  // New 
 
+  fLooperPolicy = G4LooperPolicy::Instance();
+
   // Cannot determine whether a field exists here, as it would 
   //  depend on the relative order of creating the detector's 
   //  field and this process. That order is not guaranted.
@@ -583,12 +590,28 @@ G4VParticleChange* G4Transportation::AlongStepDoIt( const G4Track& track,
   {
       G4double endEnergy= fTransportEndKineticEnergy;
 
-      if( (endEnergy < fThreshold_Important_Energy) 
-          || (fNoLooperTrials >= fThresholdTrials ) )
+      ++fNoLoopingSteps;
+      if( fLoopingStartTime < 0.0 ) { fLoopingStartTime= startTime; }
+
+      G4double importantEnergy= fLooperPolicy->
+        GetImportantEnergy( track.GetParticleDefinition(),
+                            fThreshold_Important_Energy );
+
+      if( (endEnergy < importantEnergy) 
+          || (fNoLooperTrials >= fThresholdTrials )
+          || fLooperPolicy->IsBudgetExhausted( fNoLoopingSteps,
+                               fCandidateEndGlobalTime - fLoopingStartTime ) )
       {
-        // Kill the looping particle 
+        // Abandon the looping particle: kill it, deposit its energy
+        //   or hand it off, as the looper policy requires
         //
-        fParticleChange.ProposeTrackStatus( fStopAndKill )  ;
+        G4double trackTime= 0.0;
+        if( fLooperPolicy->IsAccountingActive() )
+        {
+          trackTime= std::chrono::duration<G4double>(
+                     std::chrono::steady_clock::now() - fLooperClock ).count();
+        }
+        fLooperPolicy->Abandon( track, endEnergy, trackTime, &fParticleChange );
 
         // 'Bare' statistics
         fSumEnergyKilled += endEnergy; 
@@ -788,6 +811,10 @@ G4Transportation::StartTracking(G4Track* aTrack)
   
   // reset looping counter -- for motion in field
   fNoLooperTrials= 0; 
+  fNoLoopingSteps= 0;
+  fLoopingStartTime= -1.0;
+  if( fLooperPolicy->IsAccountingActive() )
+  { fLooperClock= std::chrono::steady_clock::now(); }
   // Must clear this state .. else it depends on last track's value
   //  --> a better solution would set this from state of suspended track TODO ? 
   // Was if( aTrack->GetCurrentStepNumber()==1 ) { .. }
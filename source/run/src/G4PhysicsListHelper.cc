@@ -731,6 +731,16 @@ void G4PhysicsListHelper::ReadInDefaultOrderingParameter()
   theTable->push_back(tmp);
   sizeOfTable +=1;  
 
+  tmp.processTypeName = "GammaGeneralProc";
+  tmp.processType     = 2;
+  tmp.processSubType  = 16;
+  tmp.ordering[0]     = -1;
+  tmp.ordering[1]     = -1;
+  tmp.ordering[2]     =  1000;
+  tmp.isDuplicable =  false;
+  theTable->push_back(tmp);
+  sizeOfTable +=1;  
+
   tmp.processTypeName = "Cerenkov";
   tmp.processType     = 2;
   tmp.processSubType  = 21;
@@ -204,7 +204,10 @@ G4Step* G4ParticleChangeForTransport::UpdateStepForAlongStep(G4Step* pStep)
 
   //  Update the G4Step specific attributes
   //pStep->SetStepLength( theTrueStepLength );
-  //  pStep->AddTotalEnergyDeposit( theLocalEnergyDeposit );
+  // energy deposit is non-zero only for a track abandoned in field
+  if (theLocalEnergyDeposit != 0.0) {
+    pStep->AddTotalEnergyDeposit( theLocalEnergyDeposit );
+  }
   pStep->SetControlFlag( theSteppingControlFlag );
   return pStep;
   //  return UpdateStepInfo(pStep);